@@ -40,8 +40,33 @@ using gemm_batched_param_t =
     std::tuple<std::string, std::string, index_t, index_t, index_t, scalar_t,
                scalar_t, index_t>;
 
+template <typename scalar_t>
+using gemv_batched_param_t =
+    std::tuple<std::string, index_t, index_t, scalar_t, scalar_t, index_t>;
+
 using reduction_param_t = std::tuple<index_t, index_t>;
 
+using trsv_param_t = std::tuple<char, char, char, index_t, index_t>;
+
+using trmv_param_t = std::tuple<char, char, char, index_t>;
+
+template <typename scalar_t>
+using syr_param_t = std::tuple<char, index_t, scalar_t>;
+
+template <typename scalar_t>
+using trsm_param_t = std::tuple<char, char, char, char, index_t, index_t,
+                                scalar_t, index_t>;
+
+template <typename scalar_t>
+using trmm_param_t =
+    std::tuple<char, char, char, char, index_t, index_t, scalar_t>;
+
+template <typename scalar_t>
+using symm_param_t =
+    std::tuple<char, char, index_t, index_t, scalar_t, scalar_t>;
+
+using spmm_param_t = std::tuple<char, index_t, index_t, index_t>;
+
 namespace blas_benchmark {
 
 namespace utils {
@@ -295,6 +320,51 @@ inline std::vector<gemm_batched_param_t<scalar_t>> get_gemm_batched_params(
   }
 }
 
+/**
+ * @fn get_gemv_batched_params
+ * @brief Returns a vector containing the gemv_batched benchmark parameters,
+ * either read from a file according to the command-line args, or the default
+ * ones.
+ */
+template <typename scalar_t>
+inline std::vector<gemv_batched_param_t<scalar_t>> get_gemv_batched_params(
+    Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<gemv_batched_param_t<scalar_t>> gemv_batched_default;
+    constexpr index_t dmin = 16, dmax = 256;
+    scalar_t alpha = 1;
+    scalar_t beta = 0;
+    for (std::string t : {"n", "t"}) {
+      for (index_t m = dmin; m <= dmax; m *= 4) {
+        for (index_t n = dmin; n <= dmax; n *= 4) {
+          for (index_t batch_size : {64, 4096}) {
+            gemv_batched_default.push_back(
+                std::make_tuple(t, m, n, alpha, beta, batch_size));
+          }
+        }
+      }
+    }
+    return gemv_batched_default;
+  } else {
+    return parse_csv_file<gemv_batched_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 6) {
+            throw std::runtime_error(
+                "invalid number of parameters (6 expected)");
+          }
+          try {
+            return std::make_tuple(
+                v[0].c_str(), str_to_int<index_t>(v[1]),
+                str_to_int<index_t>(v[2]), str_to_scalar<scalar_t>(v[3]),
+                str_to_scalar<scalar_t>(v[4]), str_to_int<index_t>(v[5]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
 /**
  * @fn get_reduction_params
  * @brief Returns a vector containing the reduction benchmark parameters, either
@@ -332,6 +402,289 @@ static inline std::vector<reduction_param_t> get_reduction_params(
   }
 }
 
+/**
+ * @fn get_trsv_params
+ * @brief Returns a vector containing the trsv benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ * The last parameter is the size of the diagonal blocks.
+ */
+template <typename scalar_t>
+static inline std::vector<trsv_param_t> get_trsv_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<trsv_param_t> trsv_default;
+    // The number of elements of the matrix must fit in index_t
+    constexpr index_t dmin = 1024, dmax = 32768;
+    for (char uplo : {'u', 'l'}) {
+      for (char trans : {'n', 't'}) {
+        for (index_t n = dmin; n <= dmax; n *= 2) {
+          for (index_t block_size : {0, 64}) {
+            trsv_default.push_back(
+                std::make_tuple(uplo, trans, 'n', n, block_size));
+          }
+        }
+      }
+    }
+    return trsv_default;
+  } else {
+    return parse_csv_file<trsv_param_t>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 5) {
+            throw std::runtime_error(
+                "invalid number of parameters (5 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], v[1][0], v[2][0],
+                                   str_to_int<index_t>(v[3]),
+                                   str_to_int<index_t>(v[4]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_trmv_params
+ * @brief Returns a vector containing the trmv benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+static inline std::vector<trmv_param_t> get_trmv_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<trmv_param_t> trmv_default;
+    // The number of elements of the matrix must fit in index_t
+    constexpr index_t dmin = 1024, dmax = 32768;
+    for (char uplo : {'u', 'l'}) {
+      for (char trans : {'n', 't'}) {
+        for (index_t n = dmin; n <= dmax; n *= 2) {
+          trmv_default.push_back(std::make_tuple(uplo, trans, 'n', n));
+        }
+      }
+    }
+    return trmv_default;
+  } else {
+    return parse_csv_file<trmv_param_t>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 4) {
+            throw std::runtime_error(
+                "invalid number of parameters (4 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], v[1][0], v[2][0],
+                                   str_to_int<index_t>(v[3]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_syr_params
+ * @brief Returns a vector containing the syr and syr2 benchmark parameters,
+ * either read from a file according to the command-line args, or the default
+ * ones.
+ */
+template <typename scalar_t>
+static inline std::vector<syr_param_t<scalar_t>> get_syr_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<syr_param_t<scalar_t>> syr_default;
+    // The number of elements of the matrix must fit in index_t
+    constexpr index_t dmin = 1024, dmax = 32768;
+    scalar_t alpha = 1;
+    for (char uplo : {'u', 'l'}) {
+      for (index_t n = dmin; n <= dmax; n *= 2) {
+        syr_default.push_back(std::make_tuple(uplo, n, alpha));
+      }
+    }
+    return syr_default;
+  } else {
+    return parse_csv_file<syr_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 3) {
+            throw std::runtime_error(
+                "invalid number of parameters (3 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], str_to_int<index_t>(v[1]),
+                                   str_to_scalar<scalar_t>(v[2]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_trsm_params
+ * @brief Returns a vector containing the trsm benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ * The last parameter is the size of the diagonal blocks.
+ */
+template <typename scalar_t>
+static inline std::vector<trsm_param_t<scalar_t>> get_trsm_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<trsm_param_t<scalar_t>> trsm_default;
+    constexpr index_t dmin = 256, dmax = 2048;
+    scalar_t alpha = 1;
+    for (char side : {'l', 'r'}) {
+      for (char uplo : {'u', 'l'}) {
+        for (char trans : {'n', 't'}) {
+          for (index_t m = dmin; m <= dmax; m *= 2) {
+            for (index_t block_size = 8; block_size <= 64; block_size *= 2) {
+              trsm_default.push_back(std::make_tuple(
+                  side, uplo, trans, 'n', m, m, alpha, block_size));
+            }
+          }
+        }
+      }
+    }
+    return trsm_default;
+  } else {
+    return parse_csv_file<trsm_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 8) {
+            throw std::runtime_error(
+                "invalid number of parameters (8 expected)");
+          }
+          try {
+            return std::make_tuple(
+                v[0][0], v[1][0], v[2][0], v[3][0], str_to_int<index_t>(v[4]),
+                str_to_int<index_t>(v[5]), str_to_scalar<scalar_t>(v[6]),
+                str_to_int<index_t>(v[7]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_trmm_params
+ * @brief Returns a vector containing the trmm benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<trmm_param_t<scalar_t>> get_trmm_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<trmm_param_t<scalar_t>> trmm_default;
+    constexpr index_t dmin = 64, dmax = 2048;
+    scalar_t alpha = 1;
+    for (char side : {'l', 'r'}) {
+      for (char uplo : {'u', 'l'}) {
+        for (char trans : {'n', 't'}) {
+          for (index_t m = dmin; m <= dmax; m *= 2) {
+            trmm_default.push_back(
+                std::make_tuple(side, uplo, trans, 'n', m, m, alpha));
+          }
+        }
+      }
+    }
+    return trmm_default;
+  } else {
+    return parse_csv_file<trmm_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 7) {
+            throw std::runtime_error(
+                "invalid number of parameters (7 expected)");
+          }
+          try {
+            return std::make_tuple(
+                v[0][0], v[1][0], v[2][0], v[3][0], str_to_int<index_t>(v[4]),
+                str_to_int<index_t>(v[5]), str_to_scalar<scalar_t>(v[6]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_symm_params
+ * @brief Returns a vector containing the symm benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<symm_param_t<scalar_t>> get_symm_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<symm_param_t<scalar_t>> symm_default;
+    constexpr index_t dmin = 64, dmax = 2048;
+    scalar_t alpha = 1;
+    scalar_t beta = 0;
+    for (char side : {'l', 'r'}) {
+      for (char uplo : {'u', 'l'}) {
+        for (index_t m = dmin; m <= dmax; m *= 2) {
+          symm_default.push_back(
+              std::make_tuple(side, uplo, m, m, alpha, beta));
+        }
+      }
+    }
+    return symm_default;
+  } else {
+    return parse_csv_file<symm_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 6) {
+            throw std::runtime_error(
+                "invalid number of parameters (6 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], v[1][0], str_to_int<index_t>(v[2]),
+                                   str_to_int<index_t>(v[3]),
+                                   str_to_scalar<scalar_t>(v[4]),
+                                   str_to_scalar<scalar_t>(v[5]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_spmm_params
+ * @brief Returns a vector containing the spmm benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ * The parameters are the layout of the dense matrices, the order of the
+ * sparse matrix, the number of columns of the dense matrices and the number of
+ * nonzeros per row.
+ */
+template <typename scalar_t>
+static inline std::vector<spmm_param_t> get_spmm_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<spmm_param_t> spmm_default;
+    for (char layout : {'c', 'r'}) {
+      for (index_t m : {16384, 65536}) {
+        for (index_t n = 64; n <= 512; n *= 2) {
+          for (index_t row_nnz : {8, 32}) {
+            spmm_default.push_back(std::make_tuple(layout, m, n, row_nnz));
+          }
+        }
+      }
+    }
+    return spmm_default;
+  } else {
+    return parse_csv_file<spmm_param_t>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 4) {
+            throw std::runtime_error(
+                "invalid number of parameters (4 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], str_to_int<index_t>(v[1]),
+                                   str_to_int<index_t>(v[2]),
+                                   str_to_int<index_t>(v[3]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
 /**
  * @fn get_type_name
  * @brief Returns a string with the given type. The C++ specification doesn't
@@ -519,6 +872,19 @@ static inline void calc_avg_counters(benchmark::State& state) {
       state.counters["total_overall_time"] / state.iterations();
 }
 
+/**
+ * @fn calc_bandwidth_counters
+ * @brief Computes the effective bandwidth, in GB/s, from the bytes processed
+ * and the average and best wall times. Must be called after
+ * calc_avg_counters.
+ */
+static inline void calc_bandwidth_counters(benchmark::State& state) {
+  state.counters["avg_bandwidth"] =
+      state.counters["bytes_processed"] / state.counters["avg_overall_time"];
+  state.counters["best_bandwidth"] =
+      state.counters["bytes_processed"] / state.counters["best_overall_time"];
+}
+
 }  // namespace utils
 }  // namespace blas_benchmark
 
@@ -132,6 +132,7 @@ void run(benchmark::State& state, ExecutorType* executorPtr, int ti, index_t m,
   }
 
   blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_bandwidth_counters(state);
 }
 
 template <typename scalar_t>
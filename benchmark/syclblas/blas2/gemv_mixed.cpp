@@ -0,0 +1,175 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_mixed.cpp
+ *
+ **************************************************************************/
+
+#include "utils.hpp"
+
+// The matrix is stored in half precision, the vectors and the computations
+// use scalar_t
+using storage_t = cl::sycl::half;
+
+template <typename scalar_t>
+std::string get_name(std::string t, int m, int n) {
+  std::ostringstream str{};
+  str << "BM_GemvMixed<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << t << "/" << m << "/" << n;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, int ti, index_t m,
+         index_t n, scalar_t alpha, scalar_t beta, bool* success) {
+  // Standard test setup.
+  std::string ts = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(ti));
+  const char* t_str = ts.c_str();
+
+  index_t xlen = t_str[0] == 'n' ? n : m;
+  index_t ylen = t_str[0] == 'n' ? m : n;
+
+  index_t lda = m;
+  index_t incX = 1;
+  index_t incY = 1;
+
+  // The counters are double. We convert m and n to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+
+  {
+    double nflops_AtimesX = 2.0 * m_d * n_d;
+    double nflops_timesAlpha = ylen;
+    double nflops_addBetaY = (beta != 0) ? 2 * ylen : 0;
+    state.counters["n_fl_ops"] =
+        nflops_AtimesX + nflops_timesAlpha + nflops_addBetaY;
+  }
+  {
+    double mem_readA = m_d * n_d * sizeof(storage_t);
+    double mem_readX = xlen * sizeof(scalar_t);
+    double mem_writeY = ylen * sizeof(scalar_t);
+    double mem_readY = (beta != 0) ? ylen * sizeof(scalar_t) : 0;
+    state.counters["bytes_processed"] =
+        mem_readA + mem_readX + mem_writeY + mem_readY;
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  // Input matrix/vector, output vector.
+  std::vector<storage_t> m_a =
+      blas_benchmark::utils::random_data<storage_t>(m * n);
+  std::vector<scalar_t> v_x =
+      blas_benchmark::utils::random_data<scalar_t>(xlen);
+  std::vector<scalar_t> v_y =
+      blas_benchmark::utils::random_data<scalar_t>(ylen);
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<storage_t>(m_a, m * n);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_x, xlen);
+  auto v_y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_y, ylen);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results, the reference
+  // using the matrix converted back to scalar_t
+  std::vector<scalar_t> m_a_ref(m_a.begin(), m_a.end());
+  std::vector<scalar_t> v_y_ref = v_y;
+  reference_blas::gemv(t_str, m, n, alpha, m_a_ref.data(), m, v_x.data(), incX,
+                       beta, v_y_ref.data(), incY);
+  std::vector<scalar_t> v_y_temp = v_y;
+  {
+    auto v_y_temp_gpu =
+        blas::make_sycl_iterator_buffer<scalar_t>(v_y_temp, ylen);
+    auto event = _gemv(ex, *t_str, m, n, alpha, m_a_gpu, lda, v_x_gpu, incX,
+                       beta, v_y_temp_gpu, incY);
+    ex.get_policy_handler().wait();
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(v_y_temp, v_y_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _gemv(ex, *t_str, m, n, alpha, m_a_gpu, lda, v_x_gpu, incX,
+                       beta, v_y_gpu, incY);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_bandwidth_counters(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto gemv_params = blas_benchmark::utils::get_blas2_params<scalar_t>(args);
+
+  for (auto p : gemv_params) {
+    std::string ts;
+    index_t m, n;
+    scalar_t alpha, beta;
+    std::tie(ts, m, n, alpha, beta) = p;
+    int t = static_cast<int>(blas_benchmark::utils::to_transpose_enum(ts));
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, int t,
+                         index_t m, index_t n, scalar_t alpha, scalar_t beta,
+                         bool* success) {
+      run<scalar_t>(st, exPtr, t, m, n, alpha, beta, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(ts, m, n).c_str(),
+                                 BM_lambda, exPtr, t, m, n, alpha, beta,
+                                 success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  register_benchmark<float>(args, exPtr, success);
+#ifdef DOUBLE_SUPPORT
+  register_benchmark<double>(args, exPtr, success);
+#endif
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,165 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syr2.cpp
+ *
+ **************************************************************************/
+
+#include "utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(char uplo, int n) {
+  std::ostringstream str{};
+  str << "BM_Syr2<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << uplo << "/" << n;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, char uplo,
+         index_t n, scalar_t alpha, bool* success) {
+  // Standard test setup.
+  index_t lda = n;
+  index_t incX = 1;
+  index_t incY = 1;
+
+  // The counters are double. We convert n to double to avoid integer
+  // overflows for n_fl_ops and bytes_processed
+  double n_d = static_cast<double>(n);
+
+  state.counters["n"] = n_d;
+
+  // Only the triangle is updated, and only the work groups of its blocks are
+  // launched, so the counters don't include the other half of the matrix
+  {
+    // Two multiply-adds per element of the triangle
+    double nflops_AtimesX = 2 * n_d * (n_d + 1);
+    double nflops_timesAlpha = 2 * n_d;
+    state.counters["n_fl_ops"] = nflops_AtimesX + nflops_timesAlpha;
+  }
+  {
+    double mem_readA = n_d * (n_d + 1) / 2;
+    double mem_readX = n_d;
+    double mem_readY = n_d;
+    double mem_writeA = n_d * (n_d + 1) / 2;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readX + mem_readY + mem_writeA) * sizeof(scalar_t);
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  // Input matrix and vectors
+  std::vector<scalar_t> a = blas_benchmark::utils::random_data<scalar_t>(n * n);
+  std::vector<scalar_t> x = blas_benchmark::utils::random_data<scalar_t>(n);
+  std::vector<scalar_t> y = blas_benchmark::utils::random_data<scalar_t>(n);
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a, n * n);
+  auto x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x, n);
+  auto y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y, n);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> a_ref = a;
+  reference_blas::syr2(&uplo, n, alpha, x.data(), incX, y.data(), incY,
+                       a_ref.data(), lda);
+  std::vector<scalar_t> a_temp = a;
+  {
+    auto a_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_temp, n * n);
+    auto event =
+        _syr2(ex, uplo, n, alpha, x_gpu, incX, y_gpu, incY, a_temp_gpu, lda);
+    ex.get_policy_handler().wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(a_temp, a_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event =
+        _syr2(ex, uplo, n, alpha, x_gpu, incX, y_gpu, incY, a_gpu, lda);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  // Work groups of the triangle kernel, against the full grid of blocks
+  // launched when the blocks outside of the triangle were masked
+  {
+    const index_t local_size = ex.get_policy_handler().get_work_group_size();
+    const double n_wg = static_cast<double>((n - 1) / local_size + 1);
+    state.counters["full_grid_work_groups"] = n_wg * n_wg;
+    state.counters["work_groups"] =
+        blas_benchmark::utils::get_launched_work_groups(blas_method_def,
+                                                        "GerCol");
+  }
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_bandwidth_counters(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto syr2_params = blas_benchmark::utils::get_syr_params<scalar_t>(args);
+
+  for (auto p : syr2_params) {
+    char uplo;
+    index_t n;
+    scalar_t alpha;
+    std::tie(uplo, n, alpha) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, char uplo,
+                         index_t n, scalar_t alpha, bool* success) {
+      run<scalar_t>(st, exPtr, uplo, n, alpha, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(uplo, n).c_str(),
+                                 BM_lambda, exPtr, uplo, n, alpha, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  register_benchmark<float>(args, exPtr, success);
+#ifdef DOUBLE_SUPPORT
+  register_benchmark<double>(args, exPtr, success);
+#endif
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,172 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trmv.cpp
+ *
+ **************************************************************************/
+
+#include "utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(char uplo, char trans, char diag, int n) {
+  std::ostringstream str{};
+  str << "BM_Trmv<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << uplo << "/" << trans << "/" << diag << "/" << n;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, char uplo,
+         char trans, char diag, index_t n, bool* success) {
+  // Standard test setup.
+  index_t lda = n;
+  index_t incX = 1;
+
+  // The counters are double. We convert n to double to avoid integer
+  // overflows for n_fl_ops and bytes_processed
+  double n_d = static_cast<double>(n);
+
+  state.counters["n"] = n_d;
+
+  // Only the work groups of the blocks of the triangle are launched, so the
+  // counters don't include the other half of the matrix
+  {
+    // One multiply-add per element of the triangle
+    state.counters["n_fl_ops"] = n_d * n_d;
+  }
+  {
+    double mem_readA = n_d * (n_d + 1) / 2;
+    double mem_readX = n_d;
+    double mem_writeX = n_d;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readX + mem_writeX) * sizeof(scalar_t);
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  // Triangular matrix, scaled so that repeated products don't overflow
+  std::vector<scalar_t> a = blas_benchmark::utils::random_data<scalar_t>(n * n);
+  for (auto& e : a) {
+    e /= n_d;
+  }
+  // Input vector, overwritten with the product
+  std::vector<scalar_t> x_init =
+      blas_benchmark::utils::random_data<scalar_t>(n);
+  std::vector<scalar_t> x = x_init;
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a, n * n);
+  auto x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x, n);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> x_ref = x;
+  reference_blas::trmv(&uplo, &trans, &diag, n, a.data(), lda, x_ref.data(),
+                       incX);
+  std::vector<scalar_t> x_temp = x;
+  {
+    auto x_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_temp, n);
+    auto event =
+        _trmv(ex, uplo, trans, diag, n, a_gpu, lda, x_temp_gpu, incX);
+    ex.get_policy_handler().wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(x_temp, x_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    // The product is in place: restore x first so that repeated products
+    // don't drift. The copy is not part of the returned events.
+    auto copy_event =
+        ex.get_policy_handler().copy_to_device(x_init.data(), x_gpu, n);
+    ex.get_policy_handler().wait(copy_event);
+    auto event = _trmv(ex, uplo, trans, diag, n, a_gpu, lda, x_gpu, incX);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  // Work groups of the triangle kernel, against the full grid of blocks
+  // launched when the blocks outside of the triangle were masked
+  {
+    const index_t local_size = ex.get_policy_handler().get_work_group_size();
+    // One work group per row of the transposed product, blocks of
+    // local_size x local_size elements otherwise
+    const double n_wg = static_cast<double>((n - 1) / local_size + 1);
+    state.counters["full_grid_work_groups"] =
+        (trans == 'n') ? n_wg * n_wg : n_d;
+    state.counters["work_groups"] =
+        blas_benchmark::utils::get_launched_work_groups(blas_method_def,
+                                                        "Gemv");
+  }
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_bandwidth_counters(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto trmv_params = blas_benchmark::utils::get_trmv_params(args);
+
+  for (auto p : trmv_params) {
+    char uplo, trans, diag;
+    index_t n;
+    std::tie(uplo, trans, diag, n) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, char uplo,
+                         char trans, char diag, index_t n, bool* success) {
+      run<scalar_t>(st, exPtr, uplo, trans, diag, n, success);
+    };
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t>(uplo, trans, diag, n).c_str(), BM_lambda, exPtr,
+        uplo, trans, diag, n, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  register_benchmark<float>(args, exPtr, success);
+#ifdef DOUBLE_SUPPORT
+  register_benchmark<double>(args, exPtr, success);
+#endif
+}
+}  // namespace blas_benchmark
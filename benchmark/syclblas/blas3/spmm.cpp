@@ -0,0 +1,208 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename spmm.cpp
+ *
+ **************************************************************************/
+
+#include "utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(bool as_spmv, char layout, int m, int n, int row_nnz) {
+  std::ostringstream str{};
+  str << (as_spmv ? "BM_SpmmAsSpmv<" : "BM_Spmm<")
+      << blas_benchmark::utils::get_type_name<scalar_t>() << ">/" << layout
+      << "/" << m << "/" << n << "/" << row_nnz;
+  return str.str();
+}
+
+/*!
+ * @brief Runs the product of a square CSR matrix of order m, with row_nnz
+ * nonzeros per row, with a dense matrix of n columns. With as_spmv, the
+ * product is computed by a _csrmv per column, as a baseline for _spmm.
+ */
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, bool as_spmv,
+         char layout, index_t m, index_t n, index_t row_nnz, bool* success) {
+  // Standard test setup.
+  const bool col_major = layout == 'c';
+  const index_t k = m;
+  const index_t nnz = m * row_nnz;
+  const index_t ldb = col_major ? k : n;
+  const index_t ldc = col_major ? m : n;
+  const scalar_t alpha = 1;
+  const scalar_t beta = 0;
+
+  // The counters are double. We convert m, n and nnz to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double nnz_d = static_cast<double>(nnz);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+  state.counters["nnz"] = nnz_d;
+
+  {
+    // One multiply-add per nonzero and column
+    state.counters["n_fl_ops"] = 2 * nnz_d * n_d;
+  }
+  {
+    double mem_readA = nnz_d * (sizeof(scalar_t) + sizeof(index_t)) +
+                       (m_d + 1) * sizeof(index_t);
+    double mem_readB = nnz_d * n_d * sizeof(scalar_t);
+    double mem_writeC = m_d * n_d * sizeof(scalar_t);
+    state.counters["bytes_processed"] = mem_readA + mem_readB + mem_writeC;
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  // Sparse matrix of distinct columns in each row
+  std::vector<index_t> row_ptr(m + 1);
+  std::vector<index_t> col_ind(nnz);
+  for (index_t i = 0; i <= m; i++) {
+    row_ptr[i] = i * row_nnz;
+  }
+  for (index_t i = 0; i < m; i++) {
+    for (index_t l = 0; l < row_nnz; l++) {
+      col_ind[i * row_nnz + l] = (i * 31 + l * (k / row_nnz)) % k;
+    }
+  }
+  std::vector<scalar_t> values =
+      blas_benchmark::utils::random_data<scalar_t>(nnz);
+  std::vector<scalar_t> b =
+      blas_benchmark::utils::random_data<scalar_t>(k * n);
+  std::vector<scalar_t> c =
+      blas_benchmark::utils::const_data<scalar_t>(m * n, 0);
+
+  auto row_ptr_gpu = blas::make_sycl_iterator_buffer<index_t>(row_ptr, m + 1);
+  auto col_ind_gpu = blas::make_sycl_iterator_buffer<index_t>(col_ind, nnz);
+  auto values_gpu = blas::make_sycl_iterator_buffer<scalar_t>(values, nnz);
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b, k * n);
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c, m * n);
+
+  // Column j of a dense matrix and the increment between its elements
+  const index_t b_col_stride = col_major ? ldb : 1;
+  const index_t c_col_stride = col_major ? ldc : 1;
+  const index_t b_inc = col_major ? 1 : ldb;
+  const index_t c_inc = col_major ? 1 : ldc;
+
+  auto compute = [&](decltype(c_gpu) c_out) -> std::vector<cl::sycl::event> {
+    if (!as_spmv) {
+      return _spmm(ex, layout, m, n, k, nnz, alpha, row_ptr_gpu, col_ind_gpu,
+                   values_gpu, b_gpu, ldb, beta, c_out, ldc);
+    }
+    std::vector<cl::sycl::event> events;
+    for (index_t j = 0; j < n; j++) {
+      auto event = _csrmv(ex, m, k, nnz, alpha, row_ptr_gpu, col_ind_gpu,
+                          values_gpu, b_gpu + j * b_col_stride, b_inc, beta,
+                          c_out + j * c_col_stride, c_inc);
+      events.insert(events.end(), event.begin(), event.end());
+    }
+    return events;
+  };
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> c_ref = c;
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < m; i++) {
+      scalar_t acc = 0;
+      for (index_t l = row_ptr[i]; l < row_ptr[i + 1]; l++) {
+        const index_t col = col_ind[l];
+        acc += values[l] * b[col_major ? col + j * ldb : j + col * ldb];
+      }
+      c_ref[col_major ? i + j * ldc : j + i * ldc] = alpha * acc;
+    }
+  }
+  std::vector<scalar_t> c_temp = c;
+  {
+    auto c_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_temp, m * n);
+    auto event = compute(c_temp_gpu);
+    ex.get_policy_handler().wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(c_temp, c_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = compute(c_gpu);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_bandwidth_counters(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto spmm_params = blas_benchmark::utils::get_spmm_params<scalar_t>(args);
+
+  for (auto p : spmm_params) {
+    char layout;
+    index_t m, n, row_nnz;
+    std::tie(layout, m, n, row_nnz) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                         bool as_spmv, char layout, index_t m, index_t n,
+                         index_t row_nnz, bool* success) {
+      run<scalar_t>(st, exPtr, as_spmv, layout, m, n, row_nnz, success);
+    };
+    for (bool as_spmv : {false, true}) {
+      benchmark::RegisterBenchmark(
+          get_name<scalar_t>(as_spmv, layout, m, n, row_nnz).c_str(),
+          BM_lambda, exPtr, as_spmv, layout, m, n, row_nnz, success);
+    }
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  register_benchmark<float>(args, exPtr, success);
+#ifdef DOUBLE_SUPPORT
+  register_benchmark<double>(args, exPtr, success);
+#endif
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,163 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trmm.cpp
+ *
+ **************************************************************************/
+
+#include "utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(char side, char uplo, char trans, char diag, int m,
+                     int n) {
+  std::ostringstream str{};
+  str << "BM_Trmm<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << side << "/" << uplo << "/" << trans << "/" << diag << "/" << m << "/"
+      << n;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, char side,
+         char uplo, char trans, char diag, index_t m, index_t n,
+         scalar_t alpha, bool* success) {
+  // Standard test setup.
+  index_t k = side == 'l' ? m : n;
+  index_t lda = k;
+  index_t ldb = m;
+
+  // The counters are double. We convert m, n and k to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double k_d = static_cast<double>(k);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+
+  {
+    // One multiply-add per element of the triangle and column (or row) of B
+    double nflops_AtimesB = k_d * (k_d + 1) * (side == 'l' ? n_d : m_d);
+    double nflops_timesAlpha = m_d * n_d;
+    state.counters["n_fl_ops"] = nflops_AtimesB + nflops_timesAlpha;
+  }
+  {
+    double mem_readA = k_d * (k_d + 1) / 2;
+    double mem_readB = m_d * n_d;
+    double mem_writeB = m_d * n_d;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readB + mem_writeB) * sizeof(scalar_t);
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  std::vector<scalar_t> a = blas_benchmark::utils::random_data<scalar_t>(k * k);
+  // B is overwritten with the product
+  std::vector<scalar_t> b_init =
+      blas_benchmark::utils::random_data<scalar_t>(m * n);
+  std::vector<scalar_t> b = b_init;
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a, k * k);
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b, m * n);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> b_ref = b;
+  reference_blas::trmm(&side, &uplo, &trans, &diag, m, n, alpha, a.data(), lda,
+                       b_ref.data(), ldb);
+  std::vector<scalar_t> b_temp = b;
+  {
+    auto b_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_temp, m * n);
+    auto event = _trmm(ex, side, uplo, trans, diag, m, n, alpha, a_gpu, lda,
+                       b_temp_gpu, ldb);
+    ex.get_policy_handler().wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(b_temp, b_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    // The product is in place: restore B first so that repeated products
+    // don't overflow. The copy is not part of the returned events.
+    auto copy_event = ex.get_policy_handler().copy_to_device(b_init.data(),
+                                                             b_gpu, m * n);
+    ex.get_policy_handler().wait(copy_event);
+    auto event =
+        _trmm(ex, side, uplo, trans, diag, m, n, alpha, a_gpu, lda, b_gpu, ldb);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto trmm_params = blas_benchmark::utils::get_trmm_params<scalar_t>(args);
+
+  for (auto p : trmm_params) {
+    char side, uplo, trans, diag;
+    index_t m, n;
+    scalar_t alpha;
+    std::tie(side, uplo, trans, diag, m, n, alpha) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, char side,
+                         char uplo, char trans, char diag, index_t m,
+                         index_t n, scalar_t alpha, bool* success) {
+      run<scalar_t>(st, exPtr, side, uplo, trans, diag, m, n, alpha, success);
+    };
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t>(side, uplo, trans, diag, m, n).c_str(), BM_lambda,
+        exPtr, side, uplo, trans, diag, m, n, alpha, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  register_benchmark<float>(args, exPtr, success);
+#ifdef DOUBLE_SUPPORT
+  register_benchmark<double>(args, exPtr, success);
+#endif
+}
+}  // namespace blas_benchmark
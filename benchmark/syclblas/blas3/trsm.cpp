@@ -0,0 +1,182 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trsm.cpp
+ *
+ **************************************************************************/
+
+#include "utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(char side, char uplo, char trans, char diag, int m, int n,
+                     int block_size) {
+  std::ostringstream str{};
+  str << "BM_Trsm<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << side << "/" << uplo << "/" << trans << "/" << diag << "/" << m << "/"
+      << n << "/" << block_size;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, char side,
+         char uplo, char trans, char diag, index_t m, index_t n,
+         scalar_t alpha, index_t block_size, bool* success) {
+  // Standard test setup.
+  index_t k = side == 'l' ? m : n;
+  index_t lda = k;
+  index_t ldb = m;
+
+  // The counters are double. We convert m, n and k to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double k_d = static_cast<double>(k);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+  state.counters["block_size"] = static_cast<double>(block_size);
+
+  {
+    // One multiply-add per element of the triangle and right-hand side
+    double nflops_solve = k_d * k_d * (side == 'l' ? n_d : m_d);
+    double nflops_timesAlpha = m_d * n_d;
+    state.counters["n_fl_ops"] = nflops_solve + nflops_timesAlpha;
+  }
+  {
+    double mem_readA = k_d * (k_d + 1) / 2;
+    double mem_readB = m_d * n_d;
+    double mem_writeB = m_d * n_d;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readB + mem_writeB) * sizeof(scalar_t);
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  // Triangular matrix, scaled so that the solve is well conditioned
+  std::vector<scalar_t> a = blas_benchmark::utils::random_data<scalar_t>(k * k);
+  for (auto& e : a) {
+    e /= k_d;
+  }
+  for (index_t i = 0; i < k; i++) {
+    a[i * lda + i] += scalar_t{3};
+  }
+  // Right-hand sides, overwritten with the solution
+  std::vector<scalar_t> b_init =
+      blas_benchmark::utils::random_data<scalar_t>(m * n);
+  std::vector<scalar_t> b = b_init;
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a, k * k);
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b, m * n);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> b_ref = b;
+  reference_blas::trsm(&side, &uplo, &trans, &diag, m, n, alpha, a.data(), lda,
+                       b_ref.data(), ldb);
+  std::vector<scalar_t> b_temp = b;
+  {
+    auto b_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_temp, m * n);
+    auto event = _trsm(ex, side, uplo, trans, diag, m, n, alpha, a_gpu, lda,
+                       b_temp_gpu, ldb, block_size);
+    ex.get_policy_handler().wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(b_temp, b_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  // The solve is in place: B is restored before each solve so that repeated
+  // solves don't drift towards denormals, outside of the measured region
+  auto restore_b = [&]() {
+    auto copy_event = ex.get_policy_handler().copy_to_device(b_init.data(),
+                                                             b_gpu, m * n);
+    ex.get_policy_handler().wait(copy_event);
+  };
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _trsm(ex, side, uplo, trans, diag, m, n, alpha, a_gpu, lda,
+                       b_gpu, ldb, block_size);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  restore_b();
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    state.PauseTiming();
+    restore_b();
+    state.ResumeTiming();
+
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto trsm_params = blas_benchmark::utils::get_trsm_params<scalar_t>(args);
+
+  for (auto p : trsm_params) {
+    char side, uplo, trans, diag;
+    index_t m, n, block_size;
+    scalar_t alpha;
+    std::tie(side, uplo, trans, diag, m, n, alpha, block_size) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, char side,
+                         char uplo, char trans, char diag, index_t m,
+                         index_t n, scalar_t alpha, index_t block_size,
+                         bool* success) {
+      run<scalar_t>(st, exPtr, side, uplo, trans, diag, m, n, alpha,
+                    block_size, success);
+    };
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t>(side, uplo, trans, diag, m, n, block_size).c_str(),
+        BM_lambda, exPtr, side, uplo, trans, diag, m, n, alpha, block_size,
+        success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  register_benchmark<float>(args, exPtr, success);
+#ifdef DOUBLE_SUPPORT
+  register_benchmark<double>(args, exPtr, success);
+#endif
+}
+}  // namespace blas_benchmark
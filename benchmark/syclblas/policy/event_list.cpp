@@ -0,0 +1,132 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename event_list.cpp
+ *
+ **************************************************************************/
+
+#include "utils.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Count of the host allocations of the whole program
+static std::atomic<size_t> n_allocations{0};
+
+void* operator new(size_t size) {
+  n_allocations++;
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+template <typename event_list_t>
+std::string get_name(int n_kernels);
+
+template <>
+std::string get_name<std::vector<cl::sycl::event>>(int n_kernels) {
+  return "BM_EventList<std::vector>/" + std::to_string(n_kernels);
+}
+
+template <>
+std::string get_name<blas::codeplay_policy::event_t>(int n_kernels) {
+  return "BM_EventList<event_t>/" + std::to_string(n_kernels);
+}
+
+/*!
+ * @brief Event bookkeeping of an interface function launching n_kernels
+ * kernels: the events of each kernel are concatenated to the previous ones
+ * and the list is returned, as in _gemv_impl.
+ */
+template <typename event_list_t>
+event_list_t bookkeeping(const cl::sycl::event& event, int n_kernels) {
+  event_list_t ret{event};
+  for (int i = 1; i < n_kernels; i++) {
+    ret = blas::concatenate_vectors(ret, event_list_t{event});
+  }
+  return ret;
+}
+
+template <typename event_list_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, int n_kernels,
+         bool* success) {
+  constexpr int calls_per_iteration = 1000;
+  ExecutorType& ex = *executorPtr;
+
+  // A real event to copy around
+  std::vector<float> v(1);
+  auto v_gpu = blas::make_sycl_iterator_buffer<float>(v, 1);
+  auto event = ex.get_policy_handler().copy_to_device(v.data(), v_gpu, 1)[0];
+  event.wait();
+
+  state.counters["n_kernels"] = n_kernels;
+
+  size_t total_allocations = 0;
+  size_t total_events = 0;
+  for (auto _ : state) {
+    const size_t allocations_before = n_allocations;
+    for (int i = 0; i < calls_per_iteration; i++) {
+      auto events = bookkeeping<event_list_t>(event, n_kernels);
+      total_events += events.size();
+      benchmark::DoNotOptimize(events);
+    }
+    total_allocations += n_allocations - allocations_before;
+  }
+
+  const double calls =
+      static_cast<double>(state.iterations()) * calls_per_iteration;
+  state.counters["allocs_per_call"] = total_allocations / calls;
+  state.counters["events_per_call"] = total_events / calls;
+  state.SetItemsProcessed(state.iterations() * calls_per_iteration);
+
+  // The interface event list must not allocate while its events fit inline
+  if (std::is_same<event_list_t, blas::codeplay_policy::event_t>::value &&
+      static_cast<size_t>(n_kernels) <=
+          blas::codeplay_policy::event_t::inline_size &&
+      total_allocations != 0) {
+    state.SkipWithError("event_t allocated on the host");
+    *success = false;
+  }
+}
+
+template <typename event_list_t>
+void register_benchmark(ExecutorType* exPtr, bool* success) {
+  for (int n_kernels : {1, 2, 4, 8, 16}) {
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                         int n_kernels, bool* success) {
+      run<event_list_t>(st, exPtr, n_kernels, success);
+    };
+    benchmark::RegisterBenchmark(get_name<event_list_t>(n_kernels).c_str(),
+                                 BM_lambda, exPtr, n_kernels, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  register_benchmark<std::vector<cl::sycl::event>>(exPtr, success);
+  register_benchmark<blas::codeplay_policy::event_t>(exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -3,6 +3,7 @@
 
 #include <CL/sycl.hpp>
 #include <chrono>
+#include <string>
 #include <tuple>
 
 #include "common_utils.hpp"
@@ -37,6 +38,31 @@ inline cl_ulong time_event<cl::sycl::event>(cl::sycl::event& e) {
   return (end_time - start_time);
 }
 
+/**
+ * @fn get_launched_work_groups
+ * @brief Number of work groups launched by one call of blas_method for the
+ * kernels whose expression tree name contains tree_name, recorded with the
+ * kernel tracer.
+ */
+template <typename function_t>
+inline double get_launched_work_groups(function_t blas_method,
+                                       const std::string& tree_name) {
+  auto& tracer = blas::KernelTracer::get();
+  tracer.clear();
+  tracer.enable();
+  blas_method();
+  tracer.disable();
+  double work_groups = 0;
+  for (auto& record : tracer.get_records()) {
+    if (record.tree.find(tree_name) != std::string::npos) {
+      work_groups += static_cast<double>(record.global_size) /
+                     static_cast<double>(record.local_size);
+    }
+  }
+  tracer.clear();
+  return work_groups;
+}
+
 }  // namespace utils
 }  // namespace blas_benchmark
 
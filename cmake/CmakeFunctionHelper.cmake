@@ -35,6 +35,13 @@ if(DOUBLE_SUPPORT)
   set(data_list "float" "double")
 endif()
 
+#represent the list of lower precision storage types of the mixed precision
+#routines, the computations being done in the types of data_list
+set(mixed_storage_list "")
+if(HALF_SUPPORT)
+  set(mixed_storage_list "cl::sycl::half")
+endif()
+
 ## represent the list of bolean options
 set(boolean_list "true" "false")
 
@@ -332,6 +339,150 @@ message(STATUS "Adding SYCL to target ${func}")
 add_sycl_to_target(TARGET ${func} SOURCES ${FUNC_SRC})
 endfunction(generate_blas_ternary_objects)
 
+# blas ternary function with the first container (the matrix) stored in a
+# lower precision type, for generating source code
+function(generate_blas_ternary_mixed_objects blas_level func)
+set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+foreach(executor ${executor_list})
+  foreach(data ${data_list})
+    set(container_list "BufferIterator<${data},codeplay_policy>")
+    foreach(storage ${mixed_storage_list})
+      set(container0 "BufferIterator<${storage},codeplay_policy>")
+      foreach(index ${index_list})
+        foreach(container1 ${container_list})
+          foreach(container2 ${container_list})
+            foreach(increment ${index_list})
+              set(file_name "${func}_${executor}_${data}_${index}_${container0}_${container1}_${container2}_${increment}.cpp")
+              STRING(REGEX REPLACE "(\\*|<| |,|>|:)" "_" file_name ${file_name})
+              STRING(REGEX REPLACE "(___|__)" "_" file_name ${file_name})
+              add_custom_command(OUTPUT "${LOCATION}/${file_name}"
+                COMMAND ${PYTHON_EXECUTABLE} ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+                  ${PROJECT_SOURCE_DIR}/external/
+                  ${SYCLBLAS_SRC_GENERATOR}/gen
+                  ${blas_level}
+                  ${func}
+                  ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+                  ${executor}
+                  ${data}
+                  ${index}
+                  ${increment}
+                  ${container0}
+                  ${container1}
+                  ${container2}
+                  ${file_name}
+                MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+                DEPENDS ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+                WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+                VERBATIM
+              )
+              list(APPEND FUNC_SRC "${LOCATION}/${file_name}")
+            endforeach(increment)
+          endforeach(container2)
+        endforeach(container1)
+      endforeach(index)
+    endforeach(storage)
+  endforeach(data)
+endforeach(executor)
+add_library(${func}_mixed OBJECT ${FUNC_SRC})
+set_target_compile_def(${func}_mixed)
+target_include_directories(${func}_mixed PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE} ${THIRD_PARTIES_INCLUDE})
+message(STATUS "Adding SYCL to target ${func}_mixed")
+add_sycl_to_target(TARGET ${func}_mixed SOURCES ${FUNC_SRC})
+endfunction(generate_blas_ternary_mixed_objects)
+
+# blas function on complex vectors and matrices, all the containers holding
+# std::complex of the types of data_list, for generating source code
+function(generate_blas_complex_objects blas_level func)
+set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+foreach(executor ${executor_list})
+  foreach(data ${data_list})
+    set(container "BufferIterator<std::complex<${data}>,codeplay_policy>")
+    foreach(index ${index_list})
+      foreach(increment ${index_list})
+        set(file_name "${func}_${executor}_${data}_${index}_${container}_${increment}.cpp")
+        STRING(REGEX REPLACE "(\\*|<| |,|>|:)" "_" file_name ${file_name})
+        STRING(REGEX REPLACE "(___|__)" "_" file_name ${file_name})
+        add_custom_command(OUTPUT "${LOCATION}/${file_name}"
+          COMMAND ${PYTHON_EXECUTABLE} ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+            ${PROJECT_SOURCE_DIR}/external/
+            ${SYCLBLAS_SRC_GENERATOR}/gen
+            ${blas_level}
+            ${func}
+            ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+            ${executor}
+            ${data}
+            ${index}
+            ${increment}
+            ${container}
+            ${container}
+            ${container}
+            ${file_name}
+          MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+          DEPENDS ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+          WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+          VERBATIM
+        )
+        list(APPEND FUNC_SRC "${LOCATION}/${file_name}")
+      endforeach(increment)
+    endforeach(index)
+  endforeach(data)
+endforeach(executor)
+add_library(${func} OBJECT ${FUNC_SRC})
+set_target_compile_def(${func})
+target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE} ${THIRD_PARTIES_INCLUDE})
+message(STATUS "Adding SYCL to target ${func}")
+add_sycl_to_target(TARGET ${func} SOURCES ${FUNC_SRC})
+endfunction(generate_blas_complex_objects)
+
+# blas function on a sparse matrix, the first container holding its indices
+# and the two others its values and the vectors, for generating source code
+function(generate_blas_sparse_objects blas_level func)
+set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+foreach(executor ${executor_list})
+  foreach(data ${data_list})
+    set(container_list "BufferIterator<${data},codeplay_policy>")
+    foreach(index ${index_list})
+      set(container0 "BufferIterator<${index},codeplay_policy>")
+      foreach(container1 ${container_list})
+        foreach(container2 ${container_list})
+          foreach(increment ${index_list})
+            set(file_name "${func}_${executor}_${data}_${index}_${container0}_${container1}_${container2}_${increment}.cpp")
+            STRING(REGEX REPLACE "(\\*|<| |,|>|:)" "_" file_name ${file_name})
+            STRING(REGEX REPLACE "(___|__)" "_" file_name ${file_name})
+            add_custom_command(OUTPUT "${LOCATION}/${file_name}"
+              COMMAND ${PYTHON_EXECUTABLE} ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+                ${PROJECT_SOURCE_DIR}/external/
+                ${SYCLBLAS_SRC_GENERATOR}/gen
+                ${blas_level}
+                ${func}
+                ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+                ${executor}
+                ${data}
+                ${index}
+                ${increment}
+                ${container0}
+                ${container1}
+                ${container2}
+                ${file_name}
+              MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+              DEPENDS ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+              WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+              VERBATIM
+            )
+            list(APPEND FUNC_SRC "${LOCATION}/${file_name}")
+          endforeach(increment)
+        endforeach(container2)
+      endforeach(container1)
+    endforeach(index)
+  endforeach(data)
+endforeach(executor)
+add_library(${func} OBJECT ${FUNC_SRC})
+set_target_compile_def(${func})
+target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE} ${THIRD_PARTIES_INCLUDE})
+message(STATUS "Adding SYCL to target ${func}")
+add_sycl_to_target(TARGET ${func} SOURCES ${FUNC_SRC})
+endfunction(generate_blas_sparse_objects)
+
 
 # blas gemm function for generating source code
 function(generate_blas_gemm_objects blas_level func)
@@ -432,13 +583,46 @@ add_library(${LIB_NAME} ${LIB_TYPE}
                              $<TARGET_OBJECTS:rot>
                              $<TARGET_OBJECTS:scal>
                              $<TARGET_OBJECTS:swap>
+                             $<TARGET_OBJECTS:csrmv>
+                             $<TARGET_OBJECTS:gbmv>
                              $<TARGET_OBJECTS:gemv>
+                             $<TARGET_OBJECTS:gemv_batched>
+                             $<TARGET_OBJECTS:gemv_dual>
                              $<TARGET_OBJECTS:ger>
+                             $<TARGET_OBJECTS:sbmv>
+                             $<TARGET_OBJECTS:spmv>
+                             $<TARGET_OBJECTS:spr>
+                             $<TARGET_OBJECTS:spr2>
+                             $<TARGET_OBJECTS:rank_update>
                              $<TARGET_OBJECTS:symv>
                              $<TARGET_OBJECTS:syr>
                              $<TARGET_OBJECTS:syr2>
+                             $<TARGET_OBJECTS:tbmv>
+                             $<TARGET_OBJECTS:tpmv>
                              $<TARGET_OBJECTS:trmv>
+                             $<TARGET_OBJECTS:trsv>
                              $<TARGET_OBJECTS:gemm_launcher>
                              $<TARGET_OBJECTS:gemm>
+                             $<TARGET_OBJECTS:gemmt>
+                             $<TARGET_OBJECTS:trsm>
+                             $<TARGET_OBJECTS:trmm>
+                             $<TARGET_OBJECTS:symm>
+                             $<TARGET_OBJECTS:spmm>
+                             $<TARGET_OBJECTS:gemm_block_sparse>
+                             $<TARGET_OBJECTS:potrf>
+                             $<TARGET_OBJECTS:getrf>
+                             $<TARGET_OBJECTS:getrs>
+                             $<TARGET_OBJECTS:geqrf>
+                             $<TARGET_OBJECTS:ormqr>
                             )
+if(HALF_SUPPORT)
+  target_sources(${LIB_NAME} PRIVATE $<TARGET_OBJECTS:gemv_mixed>)
+endif()
+if(COMPLEX_SUPPORT)
+  target_sources(${LIB_NAME} PRIVATE $<TARGET_OBJECTS:axpy_complex>
+                                     $<TARGET_OBJECTS:dot_complex>
+                                     $<TARGET_OBJECTS:nrm2_complex>
+                                     $<TARGET_OBJECTS:gemv_complex>
+                                     $<TARGET_OBJECTS:gemm_complex>)
+endif()
 endfunction(build_library)
@@ -35,6 +35,20 @@ if(DOUBLE_SUPPORT)
   add_definitions(-DDOUBLE_SUPPORT)
 endif()
 
+# Half precision is only used as a storage type, for mixed precision routines
+option(HALF_SUPPORT "Enable half precision storage for mixed precision routines." off)
+if(HALF_SUPPORT)
+  # Define HALF_SUPPORT for the host cxx compiler
+  add_definitions(-DHALF_SUPPORT)
+endif()
+
+# Complex precision routines (axpy, dot, dotc, nrm2, gemv and gemm)
+option(COMPLEX_SUPPORT "Enable the complex precision routines." off)
+if(COMPLEX_SUPPORT)
+  # Define COMPLEX_SUPPORT for the host cxx compiler
+  add_definitions(-DCOMPLEX_SUPPORT)
+endif()
+
 # If the user has specified a specific workgroup size for tests, pass that on to the compiler
 if(WG_SIZE)
   add_definitions(-DWG_SIZE=${WG_SIZE})
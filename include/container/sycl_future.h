@@ -0,0 +1,215 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_future.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_FUTURE_H
+#define SYCL_BLAS_FUTURE_H
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+#include "policy/sycl_policy.h"
+#include <CL/sycl.hpp>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace blas {
+
+template <typename ix_t, typename val_t>
+struct IndexValueTuple;
+
+/*!
+ * @brief Receives the result of a reduction: a buffer of one element written
+ * by the kernel, and the host memory it is copied to.
+ * @tparam slot_t the type of the result
+ */
+template <typename slot_t>
+struct ResultSlot {
+  BufferIterator<slot_t, codeplay_policy> device_;
+  typename std::aligned_storage<sizeof(slot_t), alignof(slot_t)>::type host_;
+
+  ResultSlot() : device_(make_sycl_iterator_buffer<slot_t>(1)) {}
+
+  slot_t *get_host_pointer() { return reinterpret_cast<slot_t *>(&host_); }
+};
+
+/*!
+ * @brief Pool of the result slots of one type. A slot goes back to the pool
+ * when the last future using it is destroyed, so that a sequence of
+ * reductions does not allocate a buffer for each of them.
+ * @tparam slot_t the type of the result
+ */
+template <typename slot_t>
+class ResultSlotPool {
+ public:
+  using slot_ptr_t = std::shared_ptr<ResultSlot<slot_t>>;
+
+  // Above this number, the released slots are freed
+  static constexpr size_t max_free_slots = 16;
+
+  /*!
+   * @brief Returns a free slot, allocating it when the pool is empty.
+   */
+  static slot_ptr_t acquire() {
+    std::lock_guard<std::mutex> lock(mutex());
+    auto &slots = free_slots();
+    ResultSlot<slot_t> *slot;
+    if (slots.empty()) {
+      slot = new ResultSlot<slot_t>();
+    } else {
+      slot = slots.back().release();
+      slots.pop_back();
+    }
+    return slot_ptr_t(slot, &ResultSlotPool<slot_t>::release);
+  }
+
+ private:
+  static void release(ResultSlot<slot_t> *slot) {
+    std::lock_guard<std::mutex> lock(mutex());
+    auto &slots = free_slots();
+    if (slots.size() < max_free_slots) {
+      slots.emplace_back(slot);
+    } else {
+      delete slot;
+    }
+  }
+
+  static std::vector<std::unique_ptr<ResultSlot<slot_t>>> &free_slots() {
+    static std::vector<std::unique_ptr<ResultSlot<slot_t>>> slots;
+    return slots;
+  }
+
+  static std::mutex &mutex() {
+    static std::mutex m;
+    return m;
+  }
+};
+
+namespace internal {
+/*!
+ * @brief Converts the content of a result slot to the value of a future. The
+ * index-value tuples of IAMAX and IAMIN give their index.
+ */
+template <typename result_t, typename slot_t>
+struct FutureResult {
+  static result_t get(const slot_t &slot) { return slot; }
+};
+
+template <typename index_t, typename element_t>
+struct FutureResult<index_t, IndexValueTuple<index_t, element_t>> {
+  static index_t get(const IndexValueTuple<index_t, element_t> &slot) {
+    return slot.get_index();
+  }
+};
+}  // namespace internal
+
+/*!
+ * @brief Result of an asynchronous reduction returning a value to the host.
+ *
+ * It holds the events of the kernels and of the copy of the result to the
+ * host, and the slot receiving it. Nothing waits until get() is called, so
+ * several reductions and host work can overlap. The destructor of a future
+ * which was not waited on waits for the copy, before its slot is reused.
+ *
+ * @tparam result_t the type of the value returned by get()
+ * @tparam slot_t the type of the result written by the kernel
+ */
+template <typename result_t, typename slot_t = result_t>
+class Future {
+ public:
+  using event_t = typename codeplay_policy::event_t;
+  using slot_ptr_t = typename ResultSlotPool<slot_t>::slot_ptr_t;
+
+  Future(event_t events, slot_ptr_t slot)
+      : events_(events), slot_(slot), waited_(false) {}
+
+  Future(Future &&other)
+      : events_(std::move(other.events_)),
+        slot_(std::move(other.slot_)),
+        waited_(other.waited_) {}
+
+  Future &operator=(Future &&other) {
+    wait();
+    events_ = std::move(other.events_);
+    slot_ = std::move(other.slot_);
+    waited_ = other.waited_;
+    return *this;
+  }
+
+  Future(const Future &) = delete;
+  Future &operator=(const Future &) = delete;
+
+  ~Future() { wait(); }
+
+  /*!
+   * @brief Waits for the result if it is not on the host yet.
+   */
+  void wait() {
+    if (slot_ && !waited_) {
+      events_.wait();
+      waited_ = true;
+    }
+  }
+
+  /*!
+   * @brief Whether the result is on the host, i.e. get() does not block.
+   */
+  bool is_ready() const {
+    if (waited_) {
+      return true;
+    }
+    for (const auto &event : events_) {
+      if (event.template get_info<
+              cl::sycl::info::event::command_execution_status>() !=
+          cl::sycl::info::event_command_status::complete) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * @brief Returns the result, waiting for it the first time.
+   */
+  result_t get() {
+    wait();
+    return internal::FutureResult<result_t, slot_t>::get(
+        *slot_->get_host_pointer());
+  }
+
+  /*!
+   * @brief The events of the reduction and of the copy of its result to the
+   * host, e.g. to make other commands depend on them.
+   */
+  const event_t &get_event() const { return events_; }
+
+ private:
+  event_t events_;
+  slot_ptr_t slot_;
+  bool waited_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_FUTURE_H
@@ -26,11 +26,13 @@
 #ifndef SYCL_BLAS_EXECUTOR_H
 #define SYCL_BLAS_EXECUTOR_H
 #include "blas_meta.h"
+#include "executors/runtime_statistics.h"
 #include "operations/blas1_trees.h"
 #include "operations/blas2_trees.h"
 #include "operations/blas3_trees.h"
 #include "operations/extension_trees.h"
 #include "policy/policy_handler.h"
+#include <memory>
 namespace blas {
 
 /** Executor.
@@ -46,8 +48,14 @@ class Executor {
  public:
   using policy_t = typename policy_handler_t::policy_t;
   inline Executor(typename policy_t::queue_t q)
-      : policy_handler_(policy_handler_t(q)) {}
+      : policy_handler_(policy_handler_t(q)),
+        statistics_(std::make_shared<RuntimeStatistics>()) {}
   inline policy_handler_t get_policy_handler() const { return policy_handler_; }
+  /*!
+   * @brief Counters of the routines called with this executor (and its
+   * copies), see RuntimeStatistics.
+   */
+  inline RuntimeStatistics &get_statistics() const { return *statistics_; }
 
   template <typename expression_tree_t>
   typename policy_t::event_t execute(expression_tree_t tree);
@@ -74,11 +82,11 @@ class Executor {
   template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
             bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
             typename element_t, bool is_beta_zero, int GemmMemoryType,
-            int GemmAlgorithm>
+            int GemmAlgorithm, typename input_b_t>
   typename policy_t::event_t execute(
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm>
+           GemmAlgorithm, input_b_t>
           gemm_tree);
 
   // Tall and skinny Gemm specialization
@@ -102,6 +110,16 @@ class Executor {
                   GemmMemoryType>
           gemm_partial);
 
+  // Block sparse Gemm specialization
+  template <typename gemm_t, typename mask_t>
+  typename policy_t::event_t execute(
+      GemmBlockSparse<gemm_t, mask_t> gemm_block_sparse);
+
+  // Gemm with alpha and beta in device memory
+  template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+  typename policy_t::event_t execute(
+      GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t> gemm_scalars);
+
   // Reduction specialization (partial rows)
   template <typename operator_t, typename input_t, typename output_t,
             int ClSize, int WgSize, typename element_t>
@@ -112,6 +130,7 @@ class Executor {
 
  private:
   policy_handler_t policy_handler_;
+  std::shared_ptr<RuntimeStatistics> statistics_;
 };
 
 }  // namespace blas
@@ -0,0 +1,364 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename kernel_tracer.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_KERNEL_TRACER_H
+#define SYCL_BLAS_KERNEL_TRACER_H
+
+#include <CL/sycl.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#if defined(__GNUG__) || defined(__clang__)
+#include <cxxabi.h>
+#endif
+
+namespace blas {
+
+namespace internal {
+
+/*!
+ * @brief Readable name of a type, demangled when the compiler allows it.
+ */
+inline std::string demangle(const char *name) {
+#if defined(__GNUG__) || defined(__clang__)
+  int status = 0;
+  char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status == 0 && demangled) {
+    std::string result(demangled);
+    std::free(demangled);
+    return result;
+  }
+#endif
+  return name;
+}
+
+/*!
+ * @brief Escapes a string to write it between quotes in a JSON file.
+ */
+inline std::string escape_json(const std::string &str) {
+  std::string result;
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char code[8];
+      std::snprintf(code, sizeof(code), "\\u%04x", c);
+      result += code;
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+/*!
+ * @brief Name of an expression tree: its get_type_string() when it has one,
+ * as the Gemm trees, else its type.
+ */
+template <typename expression_tree_t>
+auto get_tree_name(int) -> decltype(expression_tree_t::get_type_string()) {
+  return expression_tree_t::get_type_string();
+}
+
+template <typename expression_tree_t>
+std::string get_tree_name(long) {
+  return demangle(typeid(expression_tree_t).name());
+}
+
+/*!
+ * @brief Size in bytes of an element of local memory, 0 without local memory.
+ */
+template <typename value_t>
+struct LocalMemoryElementSize {
+  static constexpr size_t value = sizeof(value_t);
+};
+
+template <>
+struct LocalMemoryElementSize<void> {
+  static constexpr size_t value = 0;
+};
+
+}  // namespace internal
+
+/*!
+ * @brief Records the kernels launched by execute_tree and exports them in
+ * the Chrome trace format, which chrome://tracing and Perfetto open.
+ *
+ * Tracing is off by default and then costs one atomic load per kernel. When
+ * enabled, each kernel records its tree type, nd_range, local memory, the
+ * host time of its submission and its event. The device start and end times
+ * are read from the events when the trace is written, which requires a queue
+ * created with the enable_profiling property; they are left out otherwise.
+ *
+ * The records are kept in a ring buffer of get_capacity() kernels, so that a
+ * tracer left enabled keeps only the last kernels and their events.
+ *
+ * Example:
+ *   blas::KernelTracer::get().enable();
+ *   _gemm(ex, ...);
+ *   blas::KernelTracer::get().write_chrome_trace("trace.json");
+ */
+class KernelTracer {
+ public:
+  using clock_t = std::chrono::steady_clock;
+
+  struct Record {
+    // Short name (the tree type without its template arguments)
+    std::string name;
+    // Full type of the tree
+    std::string tree;
+    size_t global_size;
+    size_t local_size;
+    size_t local_memory_bytes;
+    // Host time around q.submit, in microseconds since the tracer's epoch
+    double submit_begin_us;
+    double submit_end_us;
+    cl::sycl::event event;
+  };
+
+  /*!
+   * @brief The tracer of the process.
+   */
+  static KernelTracer &get() {
+    static KernelTracer tracer;
+    return tracer;
+  }
+
+  // Number of kernels kept by default
+  static constexpr size_t default_capacity = 1 << 16;
+
+  void enable() { enabled_ = true; }
+  void disable() { enabled_ = false; }
+  bool is_enabled() const { return enabled_; }
+
+  /*!
+   * @brief Forgets the recorded kernels and restarts the time from zero.
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.clear();
+    first_ = 0;
+    dropped_ = 0;
+    epoch_ = clock_t::now();
+  }
+
+  /*!
+   * @brief Sets the number of kernels kept, the oldest ones being dropped
+   * when more are recorded.
+   */
+  void set_capacity(size_t capacity) {
+    if (capacity == 0) {
+      throw std::invalid_argument("the tracer capacity must be positive");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Record> records = get_ordered_records();
+    if (records.size() > capacity) {
+      dropped_ += records.size() - capacity;
+      records.erase(records.begin(), records.end() - capacity);
+    }
+    records_ = std::move(records);
+    first_ = 0;
+    capacity_ = capacity;
+  }
+
+  size_t get_capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+  }
+
+  /*!
+   * @brief Number of kernels dropped since the last clear, because more than
+   * get_capacity() were recorded.
+   */
+  size_t get_dropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+  }
+
+  /*!
+   * @brief The kernels kept, from the oldest to the most recent.
+   */
+  std::vector<Record> get_records() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return get_ordered_records();
+  }
+
+  /*!
+   * @brief Records a kernel submitted by execute_tree.
+   * @tparam expression_tree_t the type of the tree of the kernel
+   * @tparam local_memory_t the type of its local memory elements (void
+   * without local memory)
+   */
+  template <typename expression_tree_t, typename local_memory_t>
+  void record(const cl::sycl::event &event, size_t local_size,
+              size_t global_size, size_t local_memory_size,
+              clock_t::time_point submit_begin,
+              clock_t::time_point submit_end) {
+    Record record;
+    record.tree = internal::get_tree_name<expression_tree_t>(0);
+    record.name = record.tree.substr(0, record.tree.find('<'));
+    record.global_size = global_size;
+    record.local_size = local_size;
+    record.local_memory_bytes =
+        local_memory_size *
+        internal::LocalMemoryElementSize<local_memory_t>::value;
+    record.event = event;
+    std::lock_guard<std::mutex> lock(mutex_);
+    record.submit_begin_us = to_us(submit_begin - epoch_);
+    record.submit_end_us = to_us(submit_end - epoch_);
+    if (records_.size() < capacity_) {
+      records_.push_back(std::move(record));
+    } else {
+      records_[first_] = std::move(record);
+      first_ = (first_ + 1) % capacity_;
+      dropped_++;
+    }
+  }
+
+  /*!
+   * @brief Writes the recorded kernels as a Chrome trace, waiting for them
+   * to complete. The submissions are on the "host" process and the kernels
+   * on the "device" process. The device times are placed on the host
+   * timeline from the end of the submission, shifted by the time from the
+   * device submission to the start of the kernel.
+   */
+  void write_chrome_trace(std::ostream &os) const {
+    std::vector<Record> records = get_records();
+    // Nanosecond resolution on the microsecond timestamps
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,"
+          "\"args\":{\"name\":\"host\"}},\n";
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+          "\"args\":{\"name\":\"device\"}}";
+    for (auto &record : records) {
+      const std::string args = get_args(record);
+      os << ",\n{\"name\":\"" << internal::escape_json(record.name)
+         << "\",\"cat\":\"submit\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+         << "\"ts\":" << record.submit_begin_us
+         << ",\"dur\":" << (record.submit_end_us - record.submit_begin_us)
+         << ",\"args\":" << args << "}";
+      double start_us, end_us;
+      if (get_device_times(record, start_us, end_us)) {
+        os << ",\n{\"name\":\"" << internal::escape_json(record.name)
+           << "\",\"cat\":\"kernel\",\"ph\":\"X\",\"pid\":1,\"tid\":0,"
+           << "\"ts\":" << start_us << ",\"dur\":" << (end_us - start_us)
+           << ",\"args\":" << args << "}";
+      }
+    }
+    os << "\n]}\n";
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+  void write_chrome_trace(const std::string &file_name) const {
+    std::ofstream file(file_name);
+    if (!file) {
+      throw std::runtime_error("cannot open the trace file " + file_name);
+    }
+    write_chrome_trace(file);
+  }
+
+ private:
+  KernelTracer()
+      : enabled_(false),
+        epoch_(clock_t::now()),
+        capacity_(default_capacity),
+        first_(0),
+        dropped_(0) {}
+
+  /*!
+   * @brief The records in the order they were recorded, first_ being the
+   * oldest once the buffer is full. Called under the lock.
+   */
+  std::vector<Record> get_ordered_records() const {
+    std::vector<Record> records(records_.begin() + first_, records_.end());
+    records.insert(records.end(), records_.begin(), records_.begin() + first_);
+    return records;
+  }
+
+  static double to_us(clock_t::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  }
+
+  static std::string get_args(const Record &record) {
+    return "{\"tree\":\"" + internal::escape_json(record.tree) +
+           "\",\"global_size\":" + std::to_string(record.global_size) +
+           ",\"local_size\":" + std::to_string(record.local_size) +
+           ",\"local_memory_bytes\":" +
+           std::to_string(record.local_memory_bytes) + "}";
+  }
+
+  /*!
+   * @brief Device start and end of a kernel on the host timeline, false if
+   * the queue does not profile.
+   */
+  static bool get_device_times(const Record &record, double &start_us,
+                               double &end_us) {
+    try {
+      cl::sycl::event event = record.event;
+      event.wait();
+      const double submit_ns = static_cast<double>(
+          event.get_profiling_info<
+              cl::sycl::info::event_profiling::command_submit>());
+      const double start_ns = static_cast<double>(
+          event.get_profiling_info<
+              cl::sycl::info::event_profiling::command_start>());
+      const double end_ns = static_cast<double>(
+          event.get_profiling_info<
+              cl::sycl::info::event_profiling::command_end>());
+      start_us = record.submit_end_us + (start_ns - submit_ns) / 1000.0;
+      end_us = record.submit_end_us + (end_ns - submit_ns) / 1000.0;
+      return true;
+    } catch (const cl::sycl::exception &) {
+      return false;
+    }
+  }
+
+  std::atomic<bool> enabled_;
+  clock_t::time_point epoch_;
+  mutable std::mutex mutex_;
+  std::vector<Record> records_;
+  size_t capacity_;
+  // Index of the oldest record once the buffer is full
+  size_t first_;
+  size_t dropped_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_KERNEL_TRACER_H
@@ -0,0 +1,194 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename routine_work.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_ROUTINE_WORK_H
+#define SYCL_BLAS_ROUTINE_WORK_H
+
+#include "container/blas_iterator.h"
+#include <algorithm>
+#include <cctype>
+#include <complex>
+
+namespace blas {
+
+namespace internal {
+
+/*!
+ * @brief Flops and bytes moved by a call to a routine, counted in the runtime
+ * statistics with the formulas of the benchmarks.
+ */
+struct RoutineWork {
+  double flops;
+  double bytes;
+};
+
+inline RoutineWork operator*(double batch, const RoutineWork &work) {
+  return {batch * work.flops, batch * work.bytes};
+}
+
+/*!
+ * @brief Flops of a multiply-add and of a multiplication by a scalar.
+ */
+template <typename element_t>
+struct FlopCost {
+  static constexpr double mul_add = 2;
+  static constexpr double scale = 1;
+  static constexpr double add = 1;
+};
+
+template <typename scalar_t>
+struct FlopCost<std::complex<scalar_t>> {
+  static constexpr double mul_add = 8;
+  static constexpr double scale = 6;
+  static constexpr double add = 2;
+};
+
+/*!
+ * @brief Whether a scalar such as beta can be nonzero, to count the work it
+ * adds. A scalar in device memory is not read on the host and may be.
+ */
+template <typename element_t>
+inline bool may_be_nonzero(const element_t &scalar) {
+  return scalar != element_t(0);
+}
+
+template <typename element_t, typename policy_t>
+inline bool may_be_nonzero(const BufferIterator<element_t, policy_t> &) {
+  return true;
+}
+
+/*!
+ * @brief Number of elements in the band of a m x n matrix with kl
+ * subdiagonals and ku superdiagonals, to count the work of the band routines.
+ */
+inline double band_elements(double m, double n, double kl, double ku) {
+  double elements = 0;
+  for (double d = -kl; d <= ku; d++) {
+    elements += std::max(
+        0.0, std::min(m + std::min(d, 0.0), n - std::max(d, 0.0)));
+  }
+  return elements;
+}
+
+inline double triangle_elements(double n) { return n * (n + 1) / 2; }
+
+/*!
+ * @brief BLAS 1 routines: flops_per_element flops per element, and vectors
+ * vectors of n elements read or written.
+ */
+template <typename element_t>
+inline RoutineWork vector_work(double n, double flops_per_element,
+                               double vectors) {
+  return {flops_per_element * n, vectors * n * sizeof(element_t)};
+}
+
+/*!
+ * @brief Products of a matrix with a vector or a matrix, scaled by alpha and
+ * added to beta times the outputs: product_flops flops, and reads elements of
+ * the operands read.
+ */
+template <typename element_t>
+inline RoutineWork product_work(double product_flops, double outputs,
+                                double reads, bool with_beta) {
+  return {product_flops + FlopCost<element_t>::scale * outputs +
+              (with_beta ? FlopCost<element_t>::mul_add * outputs : 0),
+          (reads + outputs + (with_beta ? outputs : 0)) * sizeof(element_t)};
+}
+
+/*!
+ * @brief GEMV family: y = alpha * op(A) * x + beta * y.
+ */
+template <typename element_t, typename index_t, typename beta_t>
+inline RoutineWork gemv_work(char trans, index_t _M, index_t _N,
+                             const beta_t &beta) {
+  const bool is_trans = tolower(trans) != 'n';
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  return product_work<element_t>(FlopCost<element_t>::mul_add * m * n,
+                                 is_trans ? n : m, m * n + (is_trans ? m : n),
+                                 may_be_nonzero(beta));
+}
+
+/*!
+ * @brief GEMM family: C = alpha * op(A) * op(B) + beta * C.
+ */
+template <typename element_t, typename index_t, typename beta_t>
+inline RoutineWork gemm_work(index_t _M, index_t _N, index_t _K,
+                             const beta_t &beta) {
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  const double k = static_cast<double>(_K);
+  return product_work<element_t>(
+      (FlopCost<element_t>::mul_add * k - FlopCost<element_t>::add) * m * n,
+      m * n, m * k + k * n, may_be_nonzero(beta));
+}
+
+/*!
+ * @brief Sparse products C = alpha * A * B + beta * C of a CSR matrix with
+ * nnz nonzeros (n = 1 for a vector B). A row of B is read per nonzero.
+ */
+template <typename element_t, typename index_el_t, typename beta_t>
+inline RoutineWork sparse_product_work(double m, double n, double nnz,
+                                       const beta_t &beta) {
+  RoutineWork work = product_work<element_t>(
+      FlopCost<element_t>::mul_add * nnz * n, m * n, nnz + nnz * n,
+      may_be_nonzero(beta));
+  work.bytes += (nnz + m + 1) * sizeof(index_el_t);
+  return work;
+}
+
+/*!
+ * @brief Triangular matrix vector products and solves, of a triangle of stored
+ * elements.
+ */
+template <typename element_t>
+inline RoutineWork triangular_vector_work(double n, double stored) {
+  return {2 * stored - n, (stored + 2 * n) * sizeof(element_t)};
+}
+
+/*!
+ * @brief Rank updates of updated elements of A, adding rank products of
+ * vectors of xlen elements scaled by alpha. vectors elements are read.
+ */
+template <typename element_t>
+inline RoutineWork rank_update_work(double updated, double rank, double xlen,
+                                    double vectors) {
+  return {2 * rank * updated + rank * xlen,
+          (2 * updated + vectors) * sizeof(element_t)};
+}
+
+/*!
+ * @brief LAPACK routines, which read and write elements elements.
+ */
+template <typename element_t>
+inline RoutineWork factorization_work(double flops, double elements) {
+  return {flops, elements * sizeof(element_t)};
+}
+
+}  // namespace internal
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_ROUTINE_WORK_H
@@ -0,0 +1,339 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename runtime_statistics.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_RUNTIME_STATISTICS_H
+#define SYCL_BLAS_RUNTIME_STATISTICS_H
+
+#include "executors/kernel_tracer.h"
+#include "executors/routine_work.h"
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Counters of the calls to the routines of an Executor.
+ *
+ * Each public routine adds its call, flops and bytes moved (with the formulas
+ * of the benchmarks, see routine_work.h), and keeps the events of its kernels.
+ * The device time of the kernels is added once they complete, when the
+ * statistics are read or when many events are pending. It needs a queue
+ * created with the enable_profiling property, and stays at zero otherwise.
+ * The GEMM kernels are also counted per configuration of the Gemm tree.
+ *
+ * The routines and the configurations are numbered once per process, each
+ * call site looking its slot up in a function-local static, so that counting
+ * a call only adds to atomic counters: it takes the lock only to keep the
+ * events of a profiling queue.
+ */
+class RuntimeStatistics {
+ public:
+  struct Counters {
+    size_t calls = 0;
+    double flops = 0;
+    double bytes = 0;
+    // Device time of the completed kernels, and their number
+    double device_time_ns = 0;
+    size_t timed_kernels = 0;
+  };
+  using table_t = std::map<std::string, Counters>;
+  using slot_t = size_t;
+
+  // Number of routines and of GEMM configurations counted separately, the
+  // last slot counting all the others
+  static constexpr size_t max_slots = 256;
+
+  // Above this number of pending events, the completed ones are read
+  static constexpr size_t max_pending_events = 256;
+
+  RuntimeStatistics() : profiling_(true), next_read_(max_pending_events) {}
+
+  /*!
+   * @brief Slot of the counters of a routine, in every executor.
+   */
+  static slot_t routine_slot(const std::string &routine) {
+    return get_slot(routine_names(), routine);
+  }
+
+  /*!
+   * @brief Slot of the counters of a GEMM configuration, in every executor.
+   */
+  static slot_t gemm_slot(const std::string &configuration) {
+    return get_slot(gemm_names(), configuration);
+  }
+
+  /*!
+   * @brief Counts a call to a public routine.
+   */
+  template <typename event_list_t>
+  void record_routine(slot_t slot, const internal::RoutineWork &work,
+                      const event_list_t &events) {
+    record(routines_[slot], work, events);
+  }
+
+  /*!
+   * @brief Counts a call to a routine given by its name, which is looked up on
+   * each call.
+   */
+  template <typename event_list_t>
+  void record_routine(const std::string &routine, double flops, double bytes,
+                      const event_list_t &events) {
+    record_routine(routine_slot(routine), {flops, bytes}, events);
+  }
+
+  /*!
+   * @brief Counts a launch of a GEMM configuration.
+   */
+  template <typename event_list_t>
+  void record_gemm(slot_t slot, const internal::RoutineWork &work,
+                   const event_list_t &events) {
+    record(gemm_configurations_[slot], work, events);
+  }
+
+  template <typename event_list_t>
+  void record_gemm(const std::string &configuration, double flops,
+                   double bytes, const event_list_t &events) {
+    record_gemm(gemm_slot(configuration), {flops, bytes}, events);
+  }
+
+  table_t get_routines() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    read_completed_events();
+    return make_table(routine_names(), routines_);
+  }
+
+  table_t get_gemm_configurations() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    read_completed_events();
+    return make_table(gemm_names(), gemm_configurations_);
+  }
+
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+    next_read_ = max_pending_events;
+    for (auto *slots : {&routines_, &gemm_configurations_}) {
+      for (auto &slot : *slots) {
+        slot.calls = 0;
+        slot.flops = 0;
+        slot.bytes = 0;
+        slot.device_time_ns = 0;
+        slot.timed_kernels = 0;
+      }
+    }
+  }
+
+  /*!
+   * @brief Writes the counters as a JSON object with a "routines" and a
+   * "gemm_configurations" object, keyed by name.
+   */
+  void write_json(std::ostream &os) {
+    const table_t routines = get_routines();
+    const table_t gemm_configurations = get_gemm_configurations();
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(0);
+    os << "{\"routines\":";
+    write_table(os, routines);
+    os << ",\"gemm_configurations\":";
+    write_table(os, gemm_configurations);
+    os << "}";
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+  std::string to_json() {
+    std::ostringstream str;
+    write_json(str);
+    return str.str();
+  }
+
+ private:
+  /*!
+   * @brief Counters of a slot. The device time is only written under the
+   * lock, when the events are read.
+   */
+  struct Slot {
+    std::atomic<size_t> calls{0};
+    std::atomic<double> flops{0};
+    std::atomic<double> bytes{0};
+    double device_time_ns = 0;
+    size_t timed_kernels = 0;
+  };
+  using slots_t = std::array<Slot, max_slots>;
+
+  struct Names {
+    std::mutex mutex;
+    std::vector<std::string> names;
+  };
+
+  struct PendingEvent {
+    Slot *slot;
+    cl::sycl::event event;
+  };
+
+  static Names &routine_names() {
+    static Names names;
+    return names;
+  }
+
+  static Names &gemm_names() {
+    static Names names;
+    return names;
+  }
+
+  static slot_t get_slot(Names &names, const std::string &name) {
+    std::lock_guard<std::mutex> lock(names.mutex);
+    auto it = std::find(names.names.begin(), names.names.end(), name);
+    if (it != names.names.end()) {
+      return it - names.names.begin();
+    }
+    if (names.names.size() + 1 < max_slots) {
+      names.names.push_back(name);
+      return names.names.size() - 1;
+    }
+    return max_slots - 1;
+  }
+
+  static void atomic_add(std::atomic<double> &counter, double value) {
+    double old = counter.load(std::memory_order_relaxed);
+    while (!counter.compare_exchange_weak(old, old + value,
+                                          std::memory_order_relaxed)) {
+    }
+  }
+
+  template <typename event_list_t>
+  void record(Slot &slot, const internal::RoutineWork &work,
+              const event_list_t &events) {
+    slot.calls.fetch_add(1, std::memory_order_relaxed);
+    atomic_add(slot.flops, work.flops);
+    atomic_add(slot.bytes, work.bytes);
+    if (!profiling_.load(std::memory_order_relaxed) || events.empty()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &event : events) {
+      pending_.push_back({&slot, event});
+    }
+    // The events are read again once their number doubles, so that the
+    // kernels still running are not scanned on every call
+    if (pending_.size() > next_read_) {
+      read_completed_events();
+      const size_t next_read = 2 * pending_.size();
+      next_read_ =
+          (next_read > max_pending_events) ? next_read : max_pending_events;
+    }
+  }
+
+  /*!
+   * @brief Adds the device time of the completed kernels to their counters.
+   * The first event without profiling information turns it off.
+   */
+  void read_completed_events() {
+    auto is_read = [this](PendingEvent &pending) {
+      if (!profiling_) {
+        return true;
+      }
+      try {
+        if (pending.event.get_info<
+                cl::sycl::info::event::command_execution_status>() !=
+            cl::sycl::info::event_command_status::complete) {
+          return false;
+        }
+        const auto start = pending.event.get_profiling_info<
+            cl::sycl::info::event_profiling::command_start>();
+        const auto end = pending.event.get_profiling_info<
+            cl::sycl::info::event_profiling::command_end>();
+        pending.slot->device_time_ns += static_cast<double>(end - start);
+        pending.slot->timed_kernels++;
+      } catch (const cl::sycl::exception &) {
+        profiling_ = false;
+      }
+      return true;
+    };
+    pending_.erase(std::remove_if(pending_.begin(), pending_.end(), is_read),
+                   pending_.end());
+  }
+
+  static table_t make_table(Names &names, const slots_t &slots) {
+    std::vector<std::string> slot_names;
+    {
+      std::lock_guard<std::mutex> lock(names.mutex);
+      slot_names = names.names;
+    }
+    table_t table;
+    for (size_t i = 0; i < max_slots; i++) {
+      const Slot &slot = slots[i];
+      const size_t calls = slot.calls.load(std::memory_order_relaxed);
+      if (calls == 0) {
+        continue;
+      }
+      Counters &counters =
+          table[(i < slot_names.size()) ? slot_names[i] : "other"];
+      counters.calls = calls;
+      counters.flops = slot.flops.load(std::memory_order_relaxed);
+      counters.bytes = slot.bytes.load(std::memory_order_relaxed);
+      counters.device_time_ns = slot.device_time_ns;
+      counters.timed_kernels = slot.timed_kernels;
+    }
+    return table;
+  }
+
+  static void write_table(std::ostream &os, const table_t &table) {
+    os << "{";
+    bool first = true;
+    for (const auto &entry : table) {
+      const Counters &counters = entry.second;
+      os << (first ? "" : ",") << "\n\""
+         << internal::escape_json(entry.first) << "\":{"
+         << "\"calls\":" << counters.calls << ",\"flops\":" << counters.flops
+         << ",\"bytes\":" << counters.bytes
+         << ",\"device_time_ns\":" << counters.device_time_ns
+         << ",\"timed_kernels\":" << counters.timed_kernels << "}";
+      first = false;
+    }
+    os << "}";
+  }
+
+  std::mutex mutex_;
+  std::atomic<bool> profiling_;
+  std::vector<PendingEvent> pending_;
+  size_t next_read_;
+  slots_t routines_;
+  slots_t gemm_configurations_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_RUNTIME_STATISTICS_H
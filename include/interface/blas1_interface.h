@@ -25,6 +25,7 @@
 #ifndef SYCL_BLAS_BLAS1_INTERFACE_H
 #define SYCL_BLAS_BLAS1_INTERFACE_H
 #include "blas_meta.h"
+#include "container/sycl_future.h"
 
 namespace blas {
 namespace internal {
@@ -45,6 +46,25 @@ typename executor_t::policy_t::event_t _axpy(
     executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy);
 
+/**
+ * \brief AXPY with the scalar alpha in device memory. It is read by the kernel,
+ * which lets the scalar be the result of a previous operation without waiting
+ * for it on the host.
+ *
+ * @param ex Executor
+ * @param _alpha BufferIterator to the scalar alpha
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy(
+    executor_t &ex, index_t _N,
+    BufferIterator<element_t, codeplay_policy> _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy);
+
 /**
  * \brief COPY copies a vector, x, to a vector, y.
  *
@@ -141,6 +161,20 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx);
 
+/**
+ * \brief SCALAR operation on a vector, with the scalar alpha in device memory
+ * @param executor_t ex
+ * @param _alpha BufferIterator to the scalar alpha
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename element_t, typename container_0_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal(
+    executor_t &ex, index_t _N,
+    BufferIterator<element_t, codeplay_policy> _alpha, container_0_t _vx,
+    increment_t _incx);
+
 /**
  * \brief NRM2 Returns the euclidian norm of a vector
  * @param ex Executor
@@ -229,6 +263,70 @@ template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx, increment_t _incx);
+
+/**
+ * \brief Asynchronous DOT: returns at once a future of the inner product,
+ * which waits for it when its value is read.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vx BufferIterator
+ * @param _incy Increment for the vector Y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Future<typename ValueType<container_0_t>::type> _dot_async(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy);
+
+/**
+ * \brief Asynchronous ICAMAX, see _dot_async
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<index_t, IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief Asynchronous ICAMIN, see _dot_async
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<index_t, IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief Asynchronous ASUM, see _dot_async
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<typename ValueType<container_t>::type> _asum_async(executor_t &ex,
+                                                          index_t _N,
+                                                          container_t _vx,
+                                                          increment_t _incx);
+
+/**
+ * \brief Asynchronous NRM2, see _dot_async
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<typename ValueType<container_t>::type> _nrm2_async(executor_t &ex,
+                                                          index_t _N,
+                                                          container_t _vx,
+                                                          increment_t _incx);
 }  // namespace internal
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
@@ -236,9 +334,14 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _axpy(
     executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy) {
-  return internal::_axpy(ex, _N, _alpha,
-                         ex.get_policy_handler().get_buffer(_vx), _incx,
-                         ex.get_policy_handler().get_buffer(_vy), _incy);
+  auto ret = internal::_axpy(ex, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             ex.get_policy_handler().get_buffer(_vy), _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_axpy");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 3), ret);
+  return ret;
 }
 
 /**
@@ -257,8 +360,14 @@ typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
-  return internal::_copy(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                         ex.get_policy_handler().get_buffer(_vy), _incy);
+  auto ret =
+      internal::_copy(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                      ex.get_policy_handler().get_buffer(_vy), _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_copy");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 0, 2), ret);
+  return ret;
 }
 
 /**
@@ -275,9 +384,15 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _dot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs) {
-  return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                        ex.get_policy_handler().get_buffer(_vy), _incy,
-                        ex.get_policy_handler().get_buffer(_rs));
+  auto ret =
+      internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                     ex.get_policy_handler().get_buffer(_vy), _incy,
+                     ex.get_policy_handler().get_buffer(_rs));
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_dot");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 2), ret);
+  return ret;
 }
 
 /**
@@ -292,8 +407,14 @@ typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
                                              container_1_t _rs) {
-  return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                         ex.get_policy_handler().get_buffer(_rs));
+  auto ret =
+      internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                      ex.get_policy_handler().get_buffer(_rs));
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_asum");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 1), ret);
+  return ret;
 }
 
 /**
@@ -307,8 +428,14 @@ typename executor_t::policy_t::event_t _iamax(executor_t &ex, index_t _N,
                                               container_t _vx,
                                               increment_t _incx,
                                               ContainerI _rs) {
-  return internal::_iamax(ex, _N, ex.get_policy_handler().get_buffer(_vx),
-                          _incx, ex.get_policy_handler().get_buffer(_rs));
+  auto ret =
+      internal::_iamax(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                       ex.get_policy_handler().get_buffer(_rs));
+  using element_t = typename ValueType<container_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_iamax");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 1), ret);
+  return ret;
 }
 
 /**
@@ -322,8 +449,14 @@ typename executor_t::policy_t::event_t _iamin(executor_t &ex, index_t _N,
                                               container_t _vx,
                                               increment_t _incx,
                                               ContainerI _rs) {
-  return internal::_iamin(ex, _N, ex.get_policy_handler().get_buffer(_vx),
-                          _incx, ex.get_policy_handler().get_buffer(_rs));
+  auto ret =
+      internal::_iamin(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                       ex.get_policy_handler().get_buffer(_rs));
+  using element_t = typename ValueType<container_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_iamin");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 1), ret);
+  return ret;
 }
 
 /**
@@ -342,8 +475,14 @@ typename executor_t::policy_t::event_t _swap(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
-  return internal::_swap(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                         ex.get_policy_handler().get_buffer(_vy), _incy);
+  auto ret =
+      internal::_swap(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                      ex.get_policy_handler().get_buffer(_vy), _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_swap");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 0, 4), ret);
+  return ret;
 }
 
 /**
@@ -358,8 +497,13 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
                                              element_t _alpha,
                                              container_0_t _vx,
                                              increment_t _incx) {
-  return internal::_scal(ex, _N, _alpha,
-                         ex.get_policy_handler().get_buffer(_vx), _incx);
+  auto ret = internal::_scal(ex, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_vx), _incx);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_scal");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 1, 2), ret);
+  return ret;
 }
 
 /**
@@ -374,8 +518,14 @@ typename executor_t::policy_t::event_t _nrm2(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
                                              container_1_t _rs) {
-  return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                         ex.get_policy_handler().get_buffer(_rs));
+  auto ret =
+      internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                      ex.get_policy_handler().get_buffer(_rs));
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_nrm2");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 1), ret);
+  return ret;
 }
 
 /**
@@ -397,9 +547,121 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _rot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin) {
-  return internal::_rot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                        ex.get_policy_handler().get_buffer(_vy), _incy, _cos,
-                        _sin);
+  auto ret =
+      internal::_rot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                     ex.get_policy_handler().get_buffer(_vy), _incy, _cos,
+                     _sin);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_rot");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 6, 4), ret);
+  return ret;
+}
+
+/**
+ * \brief Asynchronous DOT: returns at once a future of the inner product,
+ * which waits for it when its value is read. The futures of several
+ * reductions can be pending at the same time.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vx BufferIterator
+ * @param _incy Increment for the vector Y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Future<typename ValueType<container_0_t>::type> _dot_async(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy) {
+  auto future = internal::_dot_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+      ex.get_policy_handler().get_buffer(_vy), _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_dot");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 2), future.get_event());
+  return future;
+}
+
+/**
+ * \brief Asynchronous ICAMAX, see _dot_async
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<index_t, IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  auto future = internal::_iamax_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+  using element_t = typename ValueType<container_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_iamax");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 1), future.get_event());
+  return future;
+}
+
+/**
+ * \brief Asynchronous ICAMIN, see _dot_async
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<index_t, IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  auto future = internal::_iamin_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+  using element_t = typename ValueType<container_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_iamin");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 1), future.get_event());
+  return future;
+}
+
+/**
+ * \brief Asynchronous ASUM, see _dot_async
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<typename ValueType<container_t>::type> _asum_async(executor_t &ex,
+                                                          index_t _N,
+                                                          container_t _vx,
+                                                          increment_t _incx) {
+  auto future = internal::_asum_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+  using element_t = typename ValueType<container_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_asum");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 1), future.get_event());
+  return future;
+}
+
+/**
+ * \brief Asynchronous NRM2, see _dot_async
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<typename ValueType<container_t>::type> _nrm2_async(executor_t &ex,
+                                                          index_t _N,
+                                                          container_t _vx,
+                                                          increment_t _incx) {
+  auto future = internal::_nrm2_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+  using element_t = typename ValueType<container_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_nrm2");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<element_t>(_N, 2, 1), future.get_event());
+  return future;
 }
 
 /**
@@ -419,8 +681,7 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
-  return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
-                        ex.get_policy_handler().get_buffer(_vy), _incy);
+  return _dot_async(ex, _N, _vx, _incx, _vy, _incy).get();
 }
 
 /**
@@ -431,8 +692,7 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
-  return internal::_iamax(ex, _N, ex.get_policy_handler().get_buffer(_vx),
-                          _incx);
+  return _iamax_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -443,8 +703,7 @@ index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
-  return internal::_iamin(ex, _N, ex.get_policy_handler().get_buffer(_vx),
-                          _incx);
+  return _iamin_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -459,8 +718,7 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
-  return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx),
-                         _incx);
+  return _asum_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -475,8 +733,7 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
-  return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx),
-                         _incx);
+  return _nrm2_async(ex, _N, _vx, _incx).get();
 }
 
 }  // end namespace blas
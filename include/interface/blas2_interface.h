@@ -25,7 +25,28 @@
 
 #ifndef SYCL_BLAS_BLAS2_INTERFACE_H
 #define SYCL_BLAS_BLAS2_INTERFACE_H
+
+#include "blas_meta.h"
+
 namespace blas {
+
+/*!
+ * @brief Algorithm of the CSR sparse matrix vector product _csrmv.
+ *
+ * scalar_per_row computes each row with a single work item, the product being
+ * a leaf of a BLAS 1 tree. vector_per_row computes each row with a vector of
+ * up to 32 work items, sized from the mean number of nonzeros per row, and
+ * suits matrices of long rows of similar lengths. merge_path gives the same
+ * number of nonzeros and rows to every work item, whatever the distribution
+ * of the nonzeros, at the cost of a second kernel for the rows shared by
+ * several work items.
+ */
+enum class csrmv_algorithm_t : int {
+  scalar_per_row = 0,
+  vector_per_row = 1,
+  merge_path = 2
+};
+
 namespace internal {
 /*!
  @brief Generalised matrix vector product with a rectangular non-symmetric
@@ -63,6 +84,114 @@ typename executor_t::policy_t::event_t _gemv(
     increment_t _incy  // The increment for elements in y (nonzero).
 );
 
+/*!
+ @brief Implementation of _gemv for a given transposition, with explicit
+ launch parameters.
+
+ The parameters left to zero take the default values derived from the work
+ group size of the device. When both nRowsWG and nColsWG are zero, the product
+ is computed by a single kernel, otherwise each work group computes the
+ partial sums of a block of nRowsWG rows and nColsWG columns, which are added
+ up by a second kernel.
+
+ @param _localSize the size of the work groups
+ @param _scratchPadSize the number of elements of local memory per work group
+ @param _nRowsWG the number of rows of the matrix per work group
+ @param _nColsWG the number of columns of the matrix per work group
+ */
+template <transpose_type trn, typename executor_t, typename index_t,
+          typename element_t, typename container_0_t, typename container_1_t,
+          typename increment_t, typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_impl(
+    executor_t& ex, index_t _M, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    element_t _beta, container_2_t _vy, increment_t _incy,
+    index_t _localSize = 0, index_t _scratchPadSize = 0, index_t _nRowsWG = 0,
+    index_t _nColsWG = 0);
+
+/*!
+ @brief Implementation of _gemv for a given transposition, with the scalars
+ alpha and beta in device memory, e.g. the results of previous reductions.
+ They are read by the kernel combining the partial sums, so the product is
+ always computed by two kernels. See the overload above for the launch
+ parameters.
+ */
+template <transpose_type trn, typename executor_t, typename index_t,
+          typename element_t, typename container_0_t, typename container_1_t,
+          typename increment_t, typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_impl(
+    executor_t& ex, index_t _M, index_t _N,
+    BufferIterator<element_t, codeplay_policy> _alpha, container_0_t _mA,
+    index_t _lda, container_1_t _vx, increment_t _incx,
+    BufferIterator<element_t, codeplay_policy> _beta, container_2_t _vy,
+    increment_t _incy, index_t _localSize = 0, index_t _scratchPadSize = 0,
+    index_t _nRowsWG = 0, index_t _nColsWG = 0);
+
+/*!
+ @brief Batch of generalised matrix vector products with rectangular
+ non-symmetric matrices, computed by a single kernel.
+
+ For each b in [0, batch_size), computes:
+
+ y_b = alpha*op(A_b)*x_b + beta*y_b
+
+ where A_b, x_b and y_b start b * stridea, b * stridex and b * stridey
+ elements after mA, vx and vy. See _gemv for the other parameters.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_batched(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _trans,         // The transposition of the matrices ('n', 't', 'c')
+    index_t _M,          // The number of rows of each matrix
+    index_t _N,          // The number of columns of each matrix
+    element_t _alpha,    // Scalar parameter Alpha
+    container_0_t _mA,   // The batch of matrices
+    index_t _lda,        // The first dimension of each matrix
+    index_t _stridea,    // The distance between two consecutive matrices
+    container_1_t _vx,   // The batch of vectors x
+    increment_t _incx,   // The increment for elements in x (nonzero)
+    index_t _stridex,    // The distance between two consecutive vectors x
+    element_t _beta,     // Scalar parameter Beta
+    container_2_t _vy,   // The batch of vectors y
+    increment_t _incy,   // The increment for elements in y (nonzero)
+    index_t _stridey,    // The distance between two consecutive vectors y
+    index_t _batch_size  // The number of products
+);
+
+/*!
+ @brief Fused pair of matrix vector products with the same rectangular
+ matrix and its transpose.
+
+ Computes, reading the matrix A only once:
+
+ y = alpha*A*x + beta*y
+ z = alpha*A^T*w + beta*z
+
+ as needed by iterative solvers such as BiCG or LSQR.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_dual(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // An array (LDA,N), with the first m*n elements
+    index_t _lda,       // Specifies the first dimension of a, max(1, m)
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // The increment for elements in x (nonzero)
+    container_1_t _vw,  // (1 + (_M-1)*abs(_incw)), input vector W
+    increment_t _incw,  // The increment for elements in w (nonzero)
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _vy,  // (1 + (_M-1)*abs(_incy)), output vector Y
+    increment_t _incy,  // The increment for elements in y (nonzero)
+    container_2_t _vz,  // (1 + (_N-1)*abs(_incz)), output vector Z
+    increment_t _incz   // The increment for elements in z (nonzero)
+);
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -89,6 +218,34 @@ typename executor_t::policy_t::event_t _trmv(
     increment_t _incx   // !=0 The increment for the elements of X
 );
 
+/*!
+ @brief Solution of a triangular system of equations, i.e. computing:
+
+ x = op(A)^-1 * x
+
+ The solve is blocked: the diagonal blocks are solved in local memory by a
+ single work group each, in substitution order, and the remaining elements of
+ x are updated with a GEMV after each block.
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d0/d2a/strsv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _trsv(
+    executor_t& ex,       // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,           // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,          // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,           // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,           // >0 The order of matrix A
+    container_0_t _mA,    // (_lda, _N) The input matrix
+    index_t _lda,         // >max(1, _N) The first dimension of _mA
+    container_1_t _vx,    // (1 + (_N-1)*abs(_incx)), in: b, out: x
+    increment_t _incx,    // >0 The increment for the elements of X
+    index_t _block_size   // Order of the diagonal blocks, 0 for the default
+);
+
 /*!
  @brief Generalised matrix vector product with a square symmetric matrix,
  followed by a vector sum.
@@ -200,6 +357,237 @@ typename executor_t::policy_t::event_t _syr2(
     container_2_t _mA,  // (_lda, _N) The output matrix
     index_t _lda        // >max(1, _N) The first dimension of _mA
 );
+
+/*!
+ @brief Generalised matrix vector product with a band matrix.
+
+ Generalised matrix vector product with a band matrix of _KL subdiagonals and
+ _KU superdiagonals, stored in the band layout, i.e. computing the
+ mathematical operation:
+
+ y = alpha*op(A)*x + beta*y
+
+ Only the band of A is read. See the netlib blas interface documentation of
+ sgbmv for more details of the high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    index_t _KL,        // >=0 The number of subdiagonals of the matrix
+    index_t _KU,        // >=0 The number of superdiagonals of the matrix
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // (_lda, _N) The band of the matrix
+    index_t _lda,       // >=(_KL + _KU + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (N-1)*abs(_incx)), input vector X (M if 't')
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _vy,  // (1 + (M-1)*abs(_incy)), output vector Y (N if 't')
+    increment_t _incy   // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Generalised matrix vector product with a symmetric band matrix.
+
+ Generalised matrix vector product with a symmetric band matrix of _K
+ subdiagonals, of which only the triangle _Uplo is stored in the band layout,
+ i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ Only the stored band of A is read. See the netlib blas interface
+ documentation of ssbmv for more details of the high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _sbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // >=0 The number of sub/superdiagonals of the matrix
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // (_lda, _N) The band of the matrix
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy   // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Matrix vector product with a triangular band matrix.
+
+ Matrix vector product with a triangular band matrix of _K sub or
+ superdiagonals stored in the band layout, i.e. computing the mathematical
+ operation:
+
+ x = op(A)*x
+
+ Only the stored band of A is read. See the netlib blas interface
+ documentation of stbmv for more details of the high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _tbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // >=0 The number of sub/superdiagonals of the matrix
+    container_0_t _mA,  // (_lda, _N) The band of the matrix
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input/output vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+);
+
+/*!
+ @brief Generalised matrix vector product with a symmetric packed matrix.
+
+ Generalised matrix vector product with a symmetric matrix, of which only the
+ triangle _Uplo is stored in the packed layout, i.e. computing the
+ mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See the netlib blas interface documentation of sspmv for more details of the
+ high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _spmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar parameter Alpha
+    container_0_t _mAP,  // (_N*(_N+1)/2) The packed triangle of the matrix
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    element_t _beta,     // Scalar parameter Beta
+    container_2_t _vy,   // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy    // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Matrix vector product with a triangular packed matrix.
+
+ Matrix vector product with a triangular matrix stored in the packed layout,
+ i.e. computing the mathematical operation:
+
+ x = op(A)*x
+
+ See the netlib blas interface documentation of stpmv for more details of the
+ high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _tpmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,         // The transposition of the matrix ('n', 't', 'c')
+    char _Diag,          // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,          // >0 The order of matrix A
+    container_0_t _mAP,  // (_N*(_N+1)/2) The packed triangle of the matrix
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), input/output vector X
+    increment_t _incx    // !=0 The increment for the elements of X
+);
+
+/*!
+ @brief Generalised vector squaring followed by a sum with a symmetric packed
+ matrix.
+
+ Generalised vector squaring followed by a sum with a symmetric matrix, of
+ which only the triangle _Uplo is stored in the packed layout, i.e. computing
+ the mathematical operation:
+
+ A = alpha*x*xT + A
+
+ See the netlib blas interface documentation of sspr for more details of the
+ high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t>
+typename executor_t::policy_t::event_t _spr(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar alpha
+    container_0_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    container_1_t _mAP   // (_N*(_N+1)/2) The packed triangle of the matrix
+);
+
+/*!
+ @brief Generalised vector products followed by a sum with a symmetric packed
+ matrix.
+
+ Generalised vector products followed by a sum with a symmetric matrix, of
+ which only the triangle _Uplo is stored in the packed layout, i.e. computing
+ the mathematical operation:
+
+ A = alpha*x*yT + alpha*y*xT + A
+
+ See the netlib blas interface documentation of sspr2 for more details of the
+ high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _spr2(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar alpha
+    container_0_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    container_1_t _vy,   // (1 + (_N-1)*abs(_incy)), input vector Y
+    increment_t _incy,   // !=0 The increment for the elements of Y
+    container_2_t _mAP   // (_N*(_N+1)/2) The packed triangle of the matrix
+);
+
+/*!
+ @brief Matrix vector product with a sparse matrix stored in the compressed
+ sparse row (CSR) format, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ The nonzeros of row i of A are the elements _row_ptr[i] to _row_ptr[i+1] - 1
+ of _values, _col_ind holding their columns, the indices starting at 0.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename increment_t,
+          typename container_3_t>
+typename executor_t::policy_t::event_t _csrmv(
+    executor_t& ex,          // executor_t (sycl, parallel, serial, etc)
+    index_t _M,              // The number of rows of the matrix
+    index_t _N,              // The number of columns of the matrix
+    index_t _nnz,            // The number of nonzeros of the matrix
+    element_t _alpha,        // Scalar parameter Alpha
+    container_0_t _row_ptr,  // (_M + 1) The row pointers, _row_ptr[_M] = _nnz
+    container_0_t _col_ind,  // (_nnz) The column of each nonzero
+    container_1_t _values,   // (_nnz) The value of each nonzero
+    container_2_t _vx,       // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,       // !=0 The increment for the elements of X
+    element_t _beta,         // Scalar parameter Beta
+    container_3_t _vy,       // (1 + (_M-1)*abs(_incy)), output vector Y
+    increment_t _incy,       // !=0 The increment for the elements of Y
+    csrmv_algorithm_t _algorithm  // The algorithm of the product
+);
 }  // namespace internal
 
 /*!
@@ -214,6 +602,9 @@ typename executor_t::policy_t::event_t _syr2(
  See the netlib blas interface documentation for more details of the high level
  interface: http://www.netlib.org/lapack/explore-html/db/d58/sgemv_8f.html
 
+ alpha and beta can also be given as BufferIterators to scalars in device
+ memory, read by the kernel instead of the host.
+
  */
 template <typename executor_t, typename index_t, typename element_t,
           typename container_0_t, typename container_1_t, typename increment_t,
@@ -237,10 +628,110 @@ typename executor_t::policy_t::event_t inline _gemv(
     // finished, y is overwritten with the updated vector.
     increment_t _incy  // The increment for elements in y (nonzero).
 ) {
-  return internal::_gemv(ex, _trans, _M, _N, _alpha,
-                         ex.get_policy_handler().get_buffer(_mA), _lda,
-                         ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
-                         ex.get_policy_handler().get_buffer(_vy), _incy);
+  auto ret = internal::_gemv(ex, _trans, _M, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_mA), _lda,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             _beta, ex.get_policy_handler().get_buffer(_vy),
+                             _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_gemv");
+  ex.get_statistics().record_routine(
+      slot, internal::gemv_work<element_t>(_trans, _M, _N, _beta), ret);
+  return ret;
+}
+
+/*!
+ @brief Batch of generalised matrix vector products with rectangular
+ non-symmetric matrices, computed by a single kernel.
+
+ For each b in [0, batch_size), computes:
+
+ y_b = alpha*op(A_b)*x_b + beta*y_b
+
+ where A_b, x_b and y_b start b * stridea, b * stridex and b * stridey
+ elements after mA, vx and vy. See _gemv for the other parameters.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_batched(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _trans,         // The transposition of the matrices ('n', 't', 'c')
+    index_t _M,          // The number of rows of each matrix
+    index_t _N,          // The number of columns of each matrix
+    element_t _alpha,    // Scalar parameter Alpha
+    container_0_t _mA,   // The batch of matrices
+    index_t _lda,        // The first dimension of each matrix
+    index_t _stridea,    // The distance between two consecutive matrices
+    container_1_t _vx,   // The batch of vectors x
+    increment_t _incx,   // The increment for elements in x (nonzero)
+    index_t _stridex,    // The distance between two consecutive vectors x
+    element_t _beta,     // Scalar parameter Beta
+    container_2_t _vy,   // The batch of vectors y
+    increment_t _incy,   // The increment for elements in y (nonzero)
+    index_t _stridey,    // The distance between two consecutive vectors y
+    index_t _batch_size  // The number of products
+) {
+  auto ret = internal::_gemv_batched(
+      ex, _trans, _M, _N, _alpha, ex.get_policy_handler().get_buffer(_mA), _lda,
+      _stridea, ex.get_policy_handler().get_buffer(_vx), _incx, _stridex, _beta,
+      ex.get_policy_handler().get_buffer(_vy), _incy, _stridey, _batch_size);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_gemv_batched");
+  ex.get_statistics().record_routine(
+      slot,
+      static_cast<double>(_batch_size) *
+          internal::gemv_work<element_t>(_trans, _M, _N, _beta),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Fused pair of matrix vector products with the same rectangular
+ matrix and its transpose.
+
+ Computes, reading the matrix A only once:
+
+ y = alpha*A*x + beta*y
+ z = alpha*A^T*w + beta*z
+
+ as needed by iterative solvers such as BiCG or LSQR.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_dual(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // An array (LDA,N), with the first m*n elements
+    index_t _lda,       // Specifies the first dimension of a, max(1, m)
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // The increment for elements in x (nonzero)
+    container_1_t _vw,  // (1 + (_M-1)*abs(_incw)), input vector W
+    increment_t _incw,  // The increment for elements in w (nonzero)
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _vy,  // (1 + (_M-1)*abs(_incy)), output vector Y
+    increment_t _incy,  // The increment for elements in y (nonzero)
+    container_2_t _vz,  // (1 + (_N-1)*abs(_incz)), output vector Z
+    increment_t _incz   // The increment for elements in z (nonzero)
+) {
+  auto ret = internal::_gemv_dual(
+      ex, _M, _N, _alpha, ex.get_policy_handler().get_buffer(_mA), _lda,
+      ex.get_policy_handler().get_buffer(_vx), _incx,
+      ex.get_policy_handler().get_buffer(_vw), _incw, _beta,
+      ex.get_policy_handler().get_buffer(_vy), _incy,
+      ex.get_policy_handler().get_buffer(_vz), _incz);
+  using element_t = typename ValueType<container_0_t>::type;
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  static const auto slot = RuntimeStatistics::routine_slot("_gemv_dual");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(4 * m * n, m + n, m * n + m + n,
+                                              internal::may_be_nonzero(_beta)),
+      ret);
+  return ret;
 }
 
 /*!
@@ -268,9 +759,51 @@ typename executor_t::policy_t::event_t inline _trmv(
     container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), output vector X
     increment_t _incx   // !=0 The increment for the elements of X
 ) {
-  return internal::_trmv(ex, _Uplo, _trans, _Diag, _N,
-                         ex.get_policy_handler().get_buffer(_mA), _lda,
-                         ex.get_policy_handler().get_buffer(_vx), _incx);
+  auto ret = internal::_trmv(ex, _Uplo, _trans, _Diag, _N,
+                             ex.get_policy_handler().get_buffer(_mA), _lda,
+                             ex.get_policy_handler().get_buffer(_vx), _incx);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_trmv");
+  ex.get_statistics().record_routine(
+      slot, internal::triangular_vector_work<element_t>(
+          _N, internal::triangle_elements(_N)),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Solution of a triangular system of equations, i.e. computing:
+
+ x = op(A)^-1 * x
+
+ See internal::_trsv. _block_size is the order of the diagonal blocks solved
+ in local memory, at most the work group size; 0 selects the default size.
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _trsv(
+    executor_t& ex,          // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,              // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,             // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,              // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,              // >0 The order of matrix A
+    container_0_t _mA,       // (_lda, _N) The input matrix
+    index_t _lda,            // >max(1, _N) The first dimension of _mA
+    container_1_t _vx,       // (1 + (_N-1)*abs(_incx)), in: b, out: x
+    increment_t _incx,       // >0 The increment for the elements of X
+    index_t _block_size = 0  // Order of the diagonal blocks
+) {
+  auto ret = internal::_trsv(ex, _Uplo, _trans, _Diag, _N,
+                             ex.get_policy_handler().get_buffer(_mA), _lda,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             _block_size);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_trsv");
+  ex.get_statistics().record_routine(
+      slot, internal::triangular_vector_work<element_t>(
+          _N, internal::triangle_elements(_N)),
+      ret);
+  return ret;
 }
 
 /*!
@@ -303,10 +836,20 @@ typename executor_t::policy_t::event_t inline _symv(
     container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
     increment_t _incy   // !=0 The increment for the elements of Y
 ) {
-  return internal::_symv(ex, _Uplo, _N, _alpha,
-                         ex.get_policy_handler().get_buffer(_mA), _lda,
-                         ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
-                         ex.get_policy_handler().get_buffer(_vy), _incy);
+  auto ret = internal::_symv(ex, _Uplo, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_mA), _lda,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             _beta, ex.get_policy_handler().get_buffer(_vy),
+                             _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  const double n = static_cast<double>(_N);
+  static const auto slot = RuntimeStatistics::routine_slot("_symv");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(
+          2 * n * n, n, internal::triangle_elements(n) + n,
+          internal::may_be_nonzero(_beta)),
+      ret);
+  return ret;
 }
 
 /*!
@@ -338,10 +881,17 @@ typename executor_t::policy_t::event_t inline _ger(
     container_2_t _mA,  // (_lda, n) array containing A, the output
     index_t _lda        // >max(1, m), Leading dimension of A
 ) {
-  return internal::_ger(ex, _M, _N, _alpha,
-                        ex.get_policy_handler().get_buffer(_vx), _incx,
-                        ex.get_policy_handler().get_buffer(_vy), _incy,
-                        ex.get_policy_handler().get_buffer(_mA), _lda);
+  auto ret = internal::_ger(ex, _M, _N, _alpha,
+                            ex.get_policy_handler().get_buffer(_vx), _incx,
+                            ex.get_policy_handler().get_buffer(_vy), _incy,
+                            ex.get_policy_handler().get_buffer(_mA), _lda);
+  using element_t = typename ValueType<container_0_t>::type;
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  static const auto slot = RuntimeStatistics::routine_slot("_ger");
+  ex.get_statistics().record_routine(
+      slot, internal::rank_update_work<element_t>(m * n, 1, m, m + n), ret);
+  return ret;
 }
 
 /*!
@@ -369,9 +919,16 @@ typename executor_t::policy_t::event_t inline _syr(
     container_1_t _mA,  // (_lda, _N) The output matrix
     index_t _lda        // >max(1, _N) The first dimension of _mA
 ) {
-  return internal::_syr(ex, _Uplo, _N, _alpha,
-                        ex.get_policy_handler().get_buffer(_vx), _incx,
-                        ex.get_policy_handler().get_buffer(_mA), _lda);
+  auto ret = internal::_syr(ex, _Uplo, _N, _alpha,
+                            ex.get_policy_handler().get_buffer(_vx), _incx,
+                            ex.get_policy_handler().get_buffer(_mA), _lda);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_syr");
+  ex.get_statistics().record_routine(
+      slot, internal::rank_update_work<element_t>(
+          internal::triangle_elements(_N), 1, _N, _N),
+      ret);
+  return ret;
 }
 
 /*!
@@ -403,10 +960,356 @@ typename executor_t::policy_t::event_t inline _syr2(
     container_2_t _mA,  // (_lda, _N) The output matrix
     index_t _lda        // >max(1, _N) The first dimension of _mA
 ) {
-  return internal::_syr2(ex, _Uplo, _N, _alpha,
-                         ex.get_policy_handler().get_buffer(_vx), _incx,
-                         ex.get_policy_handler().get_buffer(_vy), _incy,
-                         ex.get_policy_handler().get_buffer(_mA), _lda);
+  auto ret = internal::_syr2(ex, _Uplo, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             ex.get_policy_handler().get_buffer(_vy), _incy,
+                             ex.get_policy_handler().get_buffer(_mA), _lda);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_syr2");
+  ex.get_statistics().record_routine(
+      slot, internal::rank_update_work<element_t>(
+          internal::triangle_elements(_N), 2, _N, 2 * _N),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Generalised matrix vector product with a band matrix.
+
+ Generalised matrix vector product with a band matrix of _KL subdiagonals and
+ _KU superdiagonals, stored in the band layout, i.e. computing the
+ mathematical operation:
+
+ y = alpha*op(A)*x + beta*y
+
+ Only the band of A is read. See the netlib blas interface documentation of
+ sgbmv for more details of the high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    index_t _KL,        // >=0 The number of subdiagonals of the matrix
+    index_t _KU,        // >=0 The number of superdiagonals of the matrix
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // (_lda, _N) The band of the matrix
+    index_t _lda,       // >=(_KL + _KU + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (N-1)*abs(_incx)), input vector X (M if 't')
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _vy,  // (1 + (M-1)*abs(_incy)), output vector Y (N if 't')
+    increment_t _incy   // !=0 The increment for the elements of Y
+) {
+  auto ret = internal::_gbmv(ex, _trans, _M, _N, _KL, _KU, _alpha,
+                             ex.get_policy_handler().get_buffer(_mA), _lda,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             _beta, ex.get_policy_handler().get_buffer(_vy),
+                             _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  const bool is_trans = tolower(_trans) != 'n';
+  const double band = internal::band_elements(_M, _N, _KL, _KU);
+  static const auto slot = RuntimeStatistics::routine_slot("_gbmv");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(2 * band, is_trans ? _N : _M,
+                                              band + (is_trans ? _M : _N),
+                                              internal::may_be_nonzero(_beta)),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Generalised matrix vector product with a symmetric band matrix.
+
+ Generalised matrix vector product with a symmetric band matrix of _K
+ subdiagonals, of which only the triangle _Uplo is stored in the band layout,
+ i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ Only the stored band of A is read. See the netlib blas interface
+ documentation of ssbmv for more details of the high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _sbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // >=0 The number of sub/superdiagonals of the matrix
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // (_lda, _N) The band of the matrix
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy   // !=0 The increment for the elements of Y
+) {
+  auto ret = internal::_sbmv(ex, _Uplo, _N, _K, _alpha,
+                             ex.get_policy_handler().get_buffer(_mA), _lda,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             _beta, ex.get_policy_handler().get_buffer(_vy),
+                             _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  // Only one triangle of the band is read, but both are used
+  const double band = internal::band_elements(_N, _N, _K, _K);
+  const double stored = internal::band_elements(_N, _N, _K, 0);
+  static const auto slot = RuntimeStatistics::routine_slot("_sbmv");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(2 * band, _N, stored + _N,
+                                              internal::may_be_nonzero(_beta)),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Matrix vector product with a triangular band matrix.
+
+ Matrix vector product with a triangular band matrix of _K sub or
+ superdiagonals stored in the band layout, i.e. computing the mathematical
+ operation:
+
+ x = op(A)*x
+
+ Only the stored band of A is read. See the netlib blas interface
+ documentation of stbmv for more details of the high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _tbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // >=0 The number of sub/superdiagonals of the matrix
+    container_0_t _mA,  // (_lda, _N) The band of the matrix
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input/output vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+) {
+  auto ret = internal::_tbmv(ex, _Uplo, _trans, _Diag, _N, _K,
+                             ex.get_policy_handler().get_buffer(_mA), _lda,
+                             ex.get_policy_handler().get_buffer(_vx), _incx);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_tbmv");
+  ex.get_statistics().record_routine(
+      slot, internal::triangular_vector_work<element_t>(
+          _N, internal::band_elements(_N, _N, _K, 0)),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Generalised matrix vector product with a symmetric packed matrix.
+
+ Generalised matrix vector product with a symmetric matrix, of which only the
+ triangle _Uplo is stored in the packed layout, i.e. computing the
+ mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See the netlib blas interface documentation of sspmv for more details of the
+ high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _spmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar parameter Alpha
+    container_0_t _mAP,  // (_N*(_N+1)/2) The packed triangle of the matrix
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    element_t _beta,     // Scalar parameter Beta
+    container_2_t _vy,   // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy    // !=0 The increment for the elements of Y
+) {
+  auto ret = internal::_spmv(ex, _Uplo, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_mAP),
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             _beta, ex.get_policy_handler().get_buffer(_vy),
+                             _incy);
+  using element_t = typename ValueType<container_0_t>::type;
+  const double n = static_cast<double>(_N);
+  static const auto slot = RuntimeStatistics::routine_slot("_spmv");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(
+          2 * n * n, n, internal::triangle_elements(n) + n,
+          internal::may_be_nonzero(_beta)),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Matrix vector product with a triangular packed matrix.
+
+ Matrix vector product with a triangular matrix stored in the packed layout,
+ i.e. computing the mathematical operation:
+
+ x = op(A)*x
+
+ See the netlib blas interface documentation of stpmv for more details of the
+ high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _tpmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,         // The transposition of the matrix ('n', 't', 'c')
+    char _Diag,          // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,          // >0 The order of matrix A
+    container_0_t _mAP,  // (_N*(_N+1)/2) The packed triangle of the matrix
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), input/output vector X
+    increment_t _incx    // !=0 The increment for the elements of X
+) {
+  auto ret = internal::_tpmv(ex, _Uplo, _trans, _Diag, _N,
+                             ex.get_policy_handler().get_buffer(_mAP),
+                             ex.get_policy_handler().get_buffer(_vx), _incx);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_tpmv");
+  ex.get_statistics().record_routine(
+      slot, internal::triangular_vector_work<element_t>(
+          _N, internal::triangle_elements(_N)),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Generalised vector squaring followed by a sum with a symmetric packed
+ matrix.
+
+ Generalised vector squaring followed by a sum with a symmetric matrix, of
+ which only the triangle _Uplo is stored in the packed layout, i.e. computing
+ the mathematical operation:
+
+ A = alpha*x*xT + A
+
+ See the netlib blas interface documentation of sspr for more details of the
+ high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t>
+typename executor_t::policy_t::event_t inline _spr(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar alpha
+    container_0_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    container_1_t _mAP   // (_N*(_N+1)/2) The packed triangle of the matrix
+) {
+  auto ret = internal::_spr(ex, _Uplo, _N, _alpha,
+                            ex.get_policy_handler().get_buffer(_vx), _incx,
+                            ex.get_policy_handler().get_buffer(_mAP));
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_spr");
+  ex.get_statistics().record_routine(
+      slot, internal::rank_update_work<element_t>(
+          internal::triangle_elements(_N), 1, _N, _N),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Generalised vector products followed by a sum with a symmetric packed
+ matrix.
+
+ Generalised vector products followed by a sum with a symmetric matrix, of
+ which only the triangle _Uplo is stored in the packed layout, i.e. computing
+ the mathematical operation:
+
+ A = alpha*x*yT + alpha*y*xT + A
+
+ See the netlib blas interface documentation of sspr2 for more details of the
+ high level interface.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _spr2(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar alpha
+    container_0_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    container_1_t _vy,   // (1 + (_N-1)*abs(_incy)), input vector Y
+    increment_t _incy,   // !=0 The increment for the elements of Y
+    container_2_t _mAP   // (_N*(_N+1)/2) The packed triangle of the matrix
+) {
+  auto ret = internal::_spr2(ex, _Uplo, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             ex.get_policy_handler().get_buffer(_vy), _incy,
+                             ex.get_policy_handler().get_buffer(_mAP));
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_spr2");
+  ex.get_statistics().record_routine(
+      slot, internal::rank_update_work<element_t>(
+          internal::triangle_elements(_N), 2, _N, 2 * _N),
+      ret);
+  return ret;
+}
+
+/*!
+ @brief Matrix vector product with a sparse matrix stored in the compressed
+ sparse row (CSR) format, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See internal::_csrmv and csrmv_algorithm_t, the default algorithm being
+ csrmv_algorithm_t::vector_per_row. y is not read when beta is zero.
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename increment_t,
+          typename container_3_t>
+typename executor_t::policy_t::event_t inline _csrmv(
+    executor_t& ex,          // executor_t (sycl, parallel, serial, etc)
+    index_t _M,              // The number of rows of the matrix
+    index_t _N,              // The number of columns of the matrix
+    index_t _nnz,            // The number of nonzeros of the matrix
+    element_t _alpha,        // Scalar parameter Alpha
+    container_0_t _row_ptr,  // (_M + 1) The row pointers, _row_ptr[_M] = _nnz
+    container_0_t _col_ind,  // (_nnz) The column of each nonzero
+    container_1_t _values,   // (_nnz) The value of each nonzero
+    container_2_t _vx,       // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,       // !=0 The increment for the elements of X
+    element_t _beta,         // Scalar parameter Beta
+    container_3_t _vy,       // (1 + (_M-1)*abs(_incy)), output vector Y
+    increment_t _incy,       // !=0 The increment for the elements of Y
+    csrmv_algorithm_t _algorithm = csrmv_algorithm_t::vector_per_row) {
+  auto ret = internal::_csrmv(ex, _M, _N, _nnz, _alpha,
+                              ex.get_policy_handler().get_buffer(_row_ptr),
+                              ex.get_policy_handler().get_buffer(_col_ind),
+                              ex.get_policy_handler().get_buffer(_values),
+                              ex.get_policy_handler().get_buffer(_vx), _incx,
+                              _beta, ex.get_policy_handler().get_buffer(_vy),
+                              _incy, _algorithm);
+  using element_t = typename ValueType<container_1_t>::type;
+  using index_el_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_csrmv");
+  ex.get_statistics().record_routine(
+      slot, internal::sparse_product_work<element_t, index_el_t>(_M, 1, _nnz,
+                                                                 _beta),
+      ret);
+  return ret;
 }
 }  // namespace blas
 
@@ -45,6 +45,20 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                                              index_t _ldb, element_t _beta,
                                              container_2_t _C, index_t _ldc);
 
+/*!
+ * @brief _gemm with the scalars alpha and beta in device memory, e.g. the
+ * results of previous reductions, read by the Gemm kernel instead of the host.
+ * As with host scalars, C is not read when beta is zero.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, BufferIterator<element_t, codeplay_policy> _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    BufferIterator<element_t, codeplay_policy> _beta, container_2_t _C,
+    index_t _ldc);
+
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm_batched(
@@ -52,6 +66,134 @@ typename executor_t::policy_t::event_t _gemm_batched(
     index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
     index_t _ldc, index_t batch_size);
+
+/*!
+ * @brief Blocked triangular solve with multiple right-hand sides, i.e.
+ * computing one of the operations:
+ *
+ * op(A) * X = alpha * B  or  X * op(A) = alpha * B
+ *
+ * where A is a triangular matrix and X overwrites B.
+ *
+ * The diagonal blocks of A are solved in local memory, the remaining
+ * contributions are applied as GEMM updates.
+ *
+ * See the netlib blas interface documentation for more details of the high
+ * level interface:
+ * http://www.netlib.org/lapack/explore-html/d2/d8b/strsm_8f.html
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _trsm(
+    executor_t& ex, char _Side, char _Uplo, char _TransA, char _Diag,
+    index_t _M, index_t _N, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, index_t _block_size);
+
+/*!
+ * @brief Triangular matrix-matrix product, i.e. computing one of the
+ * operations:
+ *
+ * B = alpha * op(A) * B  or  B = alpha * B * op(A)
+ *
+ * where A is a triangular matrix. Only the triangle given by _Uplo is read:
+ * the other one is synthesized as zeros while the Gemm kernel loads A.
+ *
+ * See the netlib blas interface documentation for more details of the high
+ * level interface:
+ * http://www.netlib.org/lapack/explore-html/dd/dab/strmm_8f.html
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _trmm(
+    executor_t& ex, char _Side, char _Uplo, char _TransA, char _Diag,
+    index_t _M, index_t _N, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb);
+
+/*!
+ * @brief Symmetric matrix-matrix product, i.e. computing one of the
+ * operations:
+ *
+ * C = alpha * A * B + beta * C  or  C = alpha * B * A + beta * C
+ *
+ * where A is a symmetric matrix. Only the triangle given by _Uplo is read:
+ * the other one is mirrored while the Gemm kernel loads A.
+ *
+ * See the netlib blas interface documentation for more details of the high
+ * level interface:
+ * http://www.netlib.org/lapack/explore-html/d7/d42/ssymm_8f.html
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _symm(
+    executor_t& ex, char _Side, char _Uplo, index_t _M, index_t _N,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
+    index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc);
+
+/*!
+ * @brief Matrix product updating only one triangle of the output, i.e.
+ * computing the operation:
+ *
+ * C = alpha * op(A) * op(B) + beta * C
+ *
+ * for the elements of the triangle of C given by _Uplo, where C is a square
+ * matrix of order _N and op(A) and op(B) are _N x _K and _K x _N. The other
+ * triangle of C is neither read nor written. When op(A) * op(B) is symmetric,
+ * e.g. for the sum of rank 1 updates of a symmetric matrix, this is the
+ * symmetric rank k update (SYRK) without the restriction op(B) = op(A)^T.
+ * The triangle is split recursively, its off-diagonal blocks being computed
+ * with _gemm.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemmt(
+    executor_t& ex, char _Uplo, char _TransA, char _TransB, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc);
+
+/*!
+ * @brief Product of a sparse matrix in the CSR format with a dense matrix,
+ * i.e. computing the operation:
+ *
+ * C = alpha * A * B + beta * C
+ *
+ * where A is a _M x _K sparse matrix given by its row pointers, column
+ * indices and values (see _csrmv), and B and C are _K x _N and _M x _N dense
+ * matrices, both column major when _Layout is 'c' and row major when it is
+ * 'r'. C is not read when beta is zero.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t>
+typename executor_t::policy_t::event_t _spmm(
+    executor_t& ex, char _Layout, index_t _M, index_t _N, index_t _K,
+    index_t _nnz, element_t _alpha, container_0_t _row_ptr,
+    container_0_t _col_ind, container_1_t _values, container_2_t b_,
+    index_t _ldb, element_t _beta, container_3_t _C, index_t _ldc);
+
+/*!
+ * @brief Matrix product of a block sparse left operand, i.e. computing the
+ * operation:
+ *
+ * C = alpha * op(A) * op(B) + beta * C
+ *
+ * where op(A) is split in blocks of _block_size x _block_size elements, the
+ * integer array _mask holding one element per block, in column major order
+ * ((_M + _block_size - 1) / _block_size rows), which is zero when all the
+ * elements of the block are zero. _nnz_blocks is the number of nonzero
+ * elements of _mask. The K loop of the product skips the blocks of zeros,
+ * unless the proportion of nonzero blocks is above _dense_threshold, the
+ * dense _gemm being faster then.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemm_block_sparse(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_1_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t _block_size, container_0_t _mask,
+    index_t _nnz_blocks, double _dense_threshold);
 }  // namespace internal
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
@@ -63,10 +205,16 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                                              index_t _lda, container_1_t b_,
                                              index_t _ldb, element_t _beta,
                                              container_2_t _C, index_t _ldc) {
-  return internal::_gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha,
-                         ex.get_policy_handler().get_buffer(a_), _lda,
-                         ex.get_policy_handler().get_buffer(b_), _ldb, _beta,
-                         ex.get_policy_handler().get_buffer(_C), _ldc);
+  auto ret = internal::_gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha,
+                             ex.get_policy_handler().get_buffer(a_), _lda,
+                             ex.get_policy_handler().get_buffer(b_), _ldb,
+                             _beta, ex.get_policy_handler().get_buffer(_C),
+                             _ldc);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_gemm");
+  ex.get_statistics().record_routine(
+      slot, internal::gemm_work<element_t>(_M, _N, _K, _beta), ret);
+  return ret;
 }
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
@@ -76,11 +224,193 @@ typename executor_t::policy_t::event_t _gemm_batched(
     index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
     index_t _ldc, index_t batch_size) {
-  return internal::_gemm_batched(ex, _TransA, _TransB, _M, _N, _K, _alpha,
-                                 ex.get_policy_handler().get_buffer(a_), _lda,
-                                 ex.get_policy_handler().get_buffer(b_), _ldb,
-                                 _beta, ex.get_policy_handler().get_buffer(_C),
-                                 _ldc, batch_size);
+  auto ret = internal::_gemm_batched(
+      ex, _TransA, _TransB, _M, _N, _K, _alpha,
+      ex.get_policy_handler().get_buffer(a_), _lda,
+      ex.get_policy_handler().get_buffer(b_), _ldb, _beta,
+      ex.get_policy_handler().get_buffer(_C), _ldc, batch_size);
+  using element_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_gemm_batched");
+  ex.get_statistics().record_routine(
+      slot,
+      static_cast<double>(batch_size) *
+          internal::gemm_work<element_t>(_M, _N, _K, _beta),
+      ret);
+  return ret;
+}
+
+/*!
+ * @brief Blocked triangular solve with multiple right-hand sides.
+ *
+ * See internal::_trsm. _block_size is the size of the diagonal blocks solved
+ * in local memory; 0 selects the default block size. std::invalid_argument is
+ * thrown if a block and a right-hand side don't fit in the local memory.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _trsm(
+    executor_t& ex, char _Side, char _Uplo, char _TransA, char _Diag,
+    index_t _M, index_t _N, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, index_t _block_size = 0) {
+  auto ret = internal::_trsm(ex, _Side, _Uplo, _TransA, _Diag, _M, _N,
+                             _alpha, ex.get_policy_handler().get_buffer(a_),
+                             _lda, ex.get_policy_handler().get_buffer(b_),
+                             _ldb, _block_size);
+  using element_t = typename ValueType<container_0_t>::type;
+  const bool is_left = tolower(_Side) == 'l';
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  const double k = is_left ? m : n;
+  static const auto slot = RuntimeStatistics::routine_slot("_trsm");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(
+          k * k * (is_left ? n : m), m * n,
+          internal::triangle_elements(k) + m * n, false),
+      ret);
+  return ret;
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _trmm(
+    executor_t& ex, char _Side, char _Uplo, char _TransA, char _Diag,
+    index_t _M, index_t _N, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb) {
+  auto ret = internal::_trmm(ex, _Side, _Uplo, _TransA, _Diag, _M, _N,
+                             _alpha, ex.get_policy_handler().get_buffer(a_),
+                             _lda, ex.get_policy_handler().get_buffer(b_),
+                             _ldb);
+  using element_t = typename ValueType<container_0_t>::type;
+  const bool is_left = tolower(_Side) == 'l';
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  const double k = is_left ? m : n;
+  static const auto slot = RuntimeStatistics::routine_slot("_trmm");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(
+          k * (k + 1) * (is_left ? n : m), m * n,
+          internal::triangle_elements(k) + m * n, false),
+      ret);
+  return ret;
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _symm(
+    executor_t& ex, char _Side, char _Uplo, index_t _M, index_t _N,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
+    index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc) {
+  auto ret = internal::_symm(ex, _Side, _Uplo, _M, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(a_), _lda,
+                             ex.get_policy_handler().get_buffer(b_), _ldb,
+                             _beta, ex.get_policy_handler().get_buffer(_C),
+                             _ldc);
+  using element_t = typename ValueType<container_0_t>::type;
+  const bool is_left = tolower(_Side) == 'l';
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  const double k = is_left ? m : n;
+  static const auto slot = RuntimeStatistics::routine_slot("_symm");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(
+          2 * k * m * n, m * n, internal::triangle_elements(k) + m * n,
+          internal::may_be_nonzero(_beta)),
+      ret);
+  return ret;
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemmt(
+    executor_t& ex, char _Uplo, char _TransA, char _TransB, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc) {
+  auto ret = internal::_gemmt(ex, _Uplo, _TransA, _TransB, _N, _K, _alpha,
+                              ex.get_policy_handler().get_buffer(a_), _lda,
+                              ex.get_policy_handler().get_buffer(b_), _ldb,
+                              _beta, ex.get_policy_handler().get_buffer(_C),
+                              _ldc);
+  using element_t = typename ValueType<container_0_t>::type;
+  const double n = static_cast<double>(_N);
+  const double k = static_cast<double>(_K);
+  // Only the triangle of C is computed
+  const double triangle = internal::triangle_elements(n);
+  static const auto slot = RuntimeStatistics::routine_slot("_gemmt");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(2 * k * triangle, triangle,
+                                              2 * n * k,
+                                              internal::may_be_nonzero(_beta)),
+      ret);
+  return ret;
+}
+
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t>
+typename executor_t::policy_t::event_t _spmm(
+    executor_t& ex, char _Layout, index_t _M, index_t _N, index_t _K,
+    index_t _nnz, element_t _alpha, container_0_t _row_ptr,
+    container_0_t _col_ind, container_1_t _values, container_2_t b_,
+    index_t _ldb, element_t _beta, container_3_t _C, index_t _ldc) {
+  auto ret = internal::_spmm(ex, _Layout, _M, _N, _K, _nnz, _alpha,
+                             ex.get_policy_handler().get_buffer(_row_ptr),
+                             ex.get_policy_handler().get_buffer(_col_ind),
+                             ex.get_policy_handler().get_buffer(_values),
+                             ex.get_policy_handler().get_buffer(b_), _ldb,
+                             _beta, ex.get_policy_handler().get_buffer(_C),
+                             _ldc);
+  using element_t = typename ValueType<container_1_t>::type;
+  using index_el_t = typename ValueType<container_0_t>::type;
+  static const auto slot = RuntimeStatistics::routine_slot("_spmm");
+  ex.get_statistics().record_routine(
+      slot, internal::sparse_product_work<element_t, index_el_t>(_M, _N, _nnz,
+                                                                 _beta),
+      ret);
+  return ret;
+}
+
+/*!
+ * @brief Matrix product of a block sparse left operand. See
+ * internal::_gemm_block_sparse, the dense _gemm being used by default when
+ * more than 60% of the blocks are nonzero.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemm_block_sparse(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_1_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t _block_size, container_0_t _mask,
+    index_t _nnz_blocks, double _dense_threshold = 0.6) {
+  auto ret = internal::_gemm_block_sparse(
+      ex, _TransA, _TransB, _M, _N, _K, _alpha,
+      ex.get_policy_handler().get_buffer(a_), _lda,
+      ex.get_policy_handler().get_buffer(b_), _ldb, _beta,
+      ex.get_policy_handler().get_buffer(_C), _ldc, _block_size,
+      ex.get_policy_handler().get_buffer(_mask), _nnz_blocks,
+      _dense_threshold);
+  using element_t = typename ValueType<container_1_t>::type;
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  const double k = static_cast<double>(_K);
+  const double blocks =
+      static_cast<double>(((_M + _block_size - 1) / _block_size) *
+                          ((_K + _block_size - 1) / _block_size));
+  // The blocks of zeros are skipped, unless the dense _gemm is used
+  const double density =
+      (blocks == 0 || _nnz_blocks > _dense_threshold * blocks)
+          ? 1.0
+          : _nnz_blocks / blocks;
+  static const auto slot =
+      RuntimeStatistics::routine_slot("_gemm_block_sparse");
+  ex.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(2 * k * m * n * density, m * n,
+                                              m * k * density + k * n,
+                                              internal::may_be_nonzero(_beta)),
+      ret);
+  return ret;
 }
 }  // namespace blas
 #endif  // SYCL_BLAS_BLAS3_INTERFACE
@@ -0,0 +1,286 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename complex_interface.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_COMPLEX_INTERFACE_H
+#define SYCL_BLAS_COMPLEX_INTERFACE_H
+
+#include <complex>
+
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+
+namespace blas {
+
+/*!
+ * @brief Buffer of complex numbers. The routines below see it as a buffer of
+ * real numbers where the real and imaginary parts are interleaved, so no
+ * complex arithmetic is done on the device.
+ */
+template <typename scalar_t>
+using complex_buffer_t =
+    BufferIterator<std::complex<scalar_t>, codeplay_policy>;
+
+/*!
+ * @brief Algorithm of the complex _gemm.
+ *
+ * four_m computes the product with four real GEMMs. three_m uses the 3M
+ * method: three real GEMMs on the real parts, the imaginary parts and their
+ * sums, saving a quarter of the multiplications for a slightly larger
+ * rounding error on the imaginary part.
+ */
+enum class complex_gemm_t : int { four_m = 0, three_m = 1 };
+
+namespace internal {
+/**
+ * \brief AXPY for complex vectors, y = alpha * x + y.
+ */
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy(
+    executor_t &ex, index_t _N, std::complex<scalar_t> _alpha,
+    complex_buffer_t<scalar_t> _vx, increment_t _incx,
+    complex_buffer_t<scalar_t> _vy, increment_t _incy);
+
+/**
+ * \brief Unconjugated inner product of two complex vectors, sum(x * y).
+ */
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _dot(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, complex_buffer_t<scalar_t> _vy, increment_t _incy,
+    complex_buffer_t<scalar_t> _rs);
+
+/**
+ * \brief Conjugated inner product of two complex vectors, sum(conj(x) * y).
+ */
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _dotc(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, complex_buffer_t<scalar_t> _vy, increment_t _incy,
+    complex_buffer_t<scalar_t> _rs);
+
+/**
+ * \brief NRM2 of a complex vector, the result being real.
+ */
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _nrm2(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, BufferIterator<scalar_t, codeplay_policy> _rs);
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+std::complex<scalar_t> _dot(executor_t &ex, index_t _N,
+                            complex_buffer_t<scalar_t> _vx, increment_t _incx,
+                            complex_buffer_t<scalar_t> _vy, increment_t _incy);
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+std::complex<scalar_t> _dotc(executor_t &ex, index_t _N,
+                             complex_buffer_t<scalar_t> _vx, increment_t _incx,
+                             complex_buffer_t<scalar_t> _vy, increment_t _incy);
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+scalar_t _nrm2(executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+               increment_t _incx);
+
+/*!
+ @brief Complex GEMV, y = alpha * op(A) * x + beta * y, op(A) being A, its
+ transpose ('t') or its conjugate transpose ('c').
+ */
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _gemv(
+    executor_t &ex, char _trans, index_t _M, index_t _N,
+    std::complex<scalar_t> _alpha, complex_buffer_t<scalar_t> _mA,
+    index_t _lda, complex_buffer_t<scalar_t> _vx, increment_t _incx,
+    std::complex<scalar_t> _beta, complex_buffer_t<scalar_t> _vy,
+    increment_t _incy);
+
+/*!
+ @brief Complex GEMM, C = alpha * op(A) * op(B) + beta * C, op being the
+ identity ('n'), the transpose ('t') or the conjugate transpose ('c').
+ */
+template <typename executor_t, typename scalar_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t &ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, std::complex<scalar_t> _alpha, complex_buffer_t<scalar_t> a_,
+    index_t _lda, complex_buffer_t<scalar_t> b_, index_t _ldb,
+    std::complex<scalar_t> _beta, complex_buffer_t<scalar_t> _C,
+    index_t _ldc, complex_gemm_t _algorithm);
+}  // namespace internal
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy(
+    executor_t &ex, index_t _N, std::complex<scalar_t> _alpha,
+    complex_buffer_t<scalar_t> _vx, increment_t _incx,
+    complex_buffer_t<scalar_t> _vy, increment_t _incy) {
+  auto ret = internal::_axpy(ex, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             ex.get_policy_handler().get_buffer(_vy), _incy);
+  static const auto slot = RuntimeStatistics::routine_slot("_axpy");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<std::complex<scalar_t>>(_N, 8, 3), ret);
+  return ret;
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _dot(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, complex_buffer_t<scalar_t> _vy, increment_t _incy,
+    complex_buffer_t<scalar_t> _rs) {
+  auto ret = internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                            _incx, ex.get_policy_handler().get_buffer(_vy),
+                            _incy, ex.get_policy_handler().get_buffer(_rs));
+  static const auto slot = RuntimeStatistics::routine_slot("_dot");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<std::complex<scalar_t>>(_N, 8, 2), ret);
+  return ret;
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _dotc(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, complex_buffer_t<scalar_t> _vy, increment_t _incy,
+    complex_buffer_t<scalar_t> _rs) {
+  auto ret = internal::_dotc(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                             _incx, ex.get_policy_handler().get_buffer(_vy),
+                             _incy, ex.get_policy_handler().get_buffer(_rs));
+  static const auto slot = RuntimeStatistics::routine_slot("_dotc");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<std::complex<scalar_t>>(_N, 8, 2), ret);
+  return ret;
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _nrm2(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, BufferIterator<scalar_t, codeplay_policy> _rs) {
+  auto ret = internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                             _incx, ex.get_policy_handler().get_buffer(_rs));
+  static const auto slot = RuntimeStatistics::routine_slot("_nrm2");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<std::complex<scalar_t>>(_N, 4, 1), ret);
+  return ret;
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+std::complex<scalar_t> _dot(executor_t &ex, index_t _N,
+                            complex_buffer_t<scalar_t> _vx, increment_t _incx,
+                            complex_buffer_t<scalar_t> _vy, increment_t _incy) {
+  const auto res =
+      internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                     ex.get_policy_handler().get_buffer(_vy), _incy);
+  static const auto slot = RuntimeStatistics::routine_slot("_dot");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<std::complex<scalar_t>>(_N, 8, 2),
+      typename executor_t::policy_t::event_t{});
+  return res;
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+std::complex<scalar_t> _dotc(executor_t &ex, index_t _N,
+                             complex_buffer_t<scalar_t> _vx, increment_t _incx,
+                             complex_buffer_t<scalar_t> _vy,
+                             increment_t _incy) {
+  const auto res =
+      internal::_dotc(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                      ex.get_policy_handler().get_buffer(_vy), _incy);
+  static const auto slot = RuntimeStatistics::routine_slot("_dotc");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<std::complex<scalar_t>>(_N, 8, 2),
+      typename executor_t::policy_t::event_t{});
+  return res;
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+scalar_t _nrm2(executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+               increment_t _incx) {
+  const auto res = internal::_nrm2(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+  static const auto slot = RuntimeStatistics::routine_slot("_nrm2");
+  ex.get_statistics().record_routine(
+      slot, internal::vector_work<std::complex<scalar_t>>(_N, 4, 1),
+      typename executor_t::policy_t::event_t{});
+  return res;
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _gemv(
+    executor_t &ex, char _trans, index_t _M, index_t _N,
+    std::complex<scalar_t> _alpha, complex_buffer_t<scalar_t> _mA,
+    index_t _lda, complex_buffer_t<scalar_t> _vx, increment_t _incx,
+    std::complex<scalar_t> _beta, complex_buffer_t<scalar_t> _vy,
+    increment_t _incy) {
+  auto ret = internal::_gemv(ex, _trans, _M, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_mA), _lda,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             _beta, ex.get_policy_handler().get_buffer(_vy),
+                             _incy);
+  static const auto slot = RuntimeStatistics::routine_slot("_gemv");
+  ex.get_statistics().record_routine(
+      slot, internal::gemv_work<std::complex<scalar_t>>(_trans, _M, _N, _beta),
+      ret);
+  return ret;
+}
+
+/*!
+ * @brief Complex GEMM. See internal::_gemm, the default algorithm being
+ * complex_gemm_t::four_m.
+ */
+template <typename executor_t, typename scalar_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t &ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, std::complex<scalar_t> _alpha, complex_buffer_t<scalar_t> a_,
+    index_t _lda, complex_buffer_t<scalar_t> b_, index_t _ldb,
+    std::complex<scalar_t> _beta, complex_buffer_t<scalar_t> _C, index_t _ldc,
+    complex_gemm_t _algorithm = complex_gemm_t::four_m) {
+  auto ret = internal::_gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha,
+                             ex.get_policy_handler().get_buffer(a_), _lda,
+                             ex.get_policy_handler().get_buffer(b_), _ldb,
+                             _beta, ex.get_policy_handler().get_buffer(_C),
+                             _ldc, _algorithm);
+  // The flops of the complex arithmetic, also for the 3M algorithm
+  static const auto slot = RuntimeStatistics::routine_slot("_gemm");
+  ex.get_statistics().record_routine(
+      slot, internal::gemm_work<std::complex<scalar_t>>(_M, _N, _K, _beta),
+      ret);
+  return ret;
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_COMPLEX_INTERFACE_H
@@ -0,0 +1,304 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_interface.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_LAPACK_INTERFACE_H
+#define SYCL_BLAS_LAPACK_INTERFACE_H
+namespace blas {
+namespace internal {
+/*!
+ * @brief Blocked Cholesky factorization of a symmetric positive definite
+ * matrix:
+ *
+ * A = L * L^T  or  A = U^T * U
+ *
+ * where the factor overwrites the triangle of A given by _Uplo. The other
+ * triangle is not referenced.
+ *
+ * Each diagonal block is updated with a GEMMT, then factored by a single work
+ * group in local memory; the blocks below (or on the right) are updated with a
+ * GEMM and a TRSM. A matrix which is not positive definite leads to NaN values
+ * in the factor.
+ *
+ * See the netlib lapack interface documentation for more details of the high
+ * level interface:
+ * http://www.netlib.org/lapack/explore-html/d8/d6c/dpotrf_8f.html
+ */
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _potrf(executor_t& ex, char _Uplo,
+                                              index_t _N, container_t a_,
+                                              index_t _lda,
+                                              index_t _block_size);
+
+/*!
+ * @brief Cholesky factorization of a batch of small matrices, one matrix per
+ * work group, entirely in local memory. The matrices are stored end to end,
+ * each one taking _lda * _N elements, and their order must not exceed 32.
+ */
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _potrf_batched(executor_t& ex,
+                                                      char _Uplo, index_t _N,
+                                                      container_t a_,
+                                                      index_t _lda,
+                                                      index_t batch_size);
+
+/*!
+ * @brief Blocked LU factorization of a general M x N matrix with partial
+ * pivoting (row interchanges):
+ *
+ * A = P * L * U
+ *
+ * where L is lower triangular with a unit diagonal (lower trapezoidal if
+ * M > N) and U is upper triangular (upper trapezoidal if M < N). L and U
+ * overwrite A, the unit diagonal of L is not stored.
+ *
+ * The panels of _block_size columns are factored recursively, the trailing
+ * matrix is updated with a TRSM and a GEMM. The pivots are searched with
+ * IAMAX and read back on the host, which also applies the row interchanges
+ * with SWAP. _ipiv is a host array of min(M, N) elements: row i was
+ * interchanged with row _ipiv[i]. Unlike LAPACK, the pivot indices start at 0.
+ * An exactly singular matrix leaves a zero on the diagonal of U.
+ *
+ * See the netlib lapack interface documentation for more details of the high
+ * level interface:
+ * http://www.netlib.org/lapack/explore-html/d3/d6a/dgetrf_8f.html
+ */
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _getrf(executor_t& ex, index_t _M,
+                                              index_t _N, container_t a_,
+                                              index_t _lda, index_t* _ipiv,
+                                              index_t _block_size);
+
+/*!
+ * @brief Solves A * X = B or A^T * X = B with the LU factorization computed
+ * by _getrf. X overwrites the _N x _NRHS matrix B.
+ *
+ * See the netlib lapack interface documentation for more details of the high
+ * level interface:
+ * http://www.netlib.org/lapack/explore-html/d6/d49/dgetrs_8f.html
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _getrs(executor_t& ex, char _Trans,
+                                              index_t _N, index_t _NRHS,
+                                              container_0_t a_, index_t _lda,
+                                              const index_t* _ipiv,
+                                              container_1_t b_, index_t _ldb);
+
+/*!
+ * @brief Blocked Householder QR factorization of a general M x N matrix:
+ *
+ * A = Q * R
+ *
+ * R overwrites the upper triangle (or trapezoid) of A. Q is represented as
+ * the product of min(M, N) elementary reflectors H(i) = I - tau[i] * v * v^T,
+ * where v has a unit first element and its other elements overwrite the
+ * column i of A below the diagonal. _tau is a host array of min(M, N)
+ * elements.
+ *
+ * The panels of _block_size columns are factored one column at a time, the
+ * norms being computed on the device with NRM2 and read back on the host. The
+ * reflectors of a panel are then aggregated in the compact WY form
+ * I - V * T * V^T, so that the trailing matrix is updated with GEMMs.
+ *
+ * See the netlib lapack interface documentation for more details of the high
+ * level interface:
+ * http://www.netlib.org/lapack/explore-html/d3/d69/dgeqrf_8f.html
+ */
+template <typename executor_t, typename container_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _geqrf(executor_t& ex, index_t _M,
+                                              index_t _N, container_t a_,
+                                              index_t _lda, element_t* _tau,
+                                              index_t _block_size);
+
+/*!
+ * @brief Multiplies the M x N matrix C by the orthogonal matrix Q of a QR
+ * factorization computed by _geqrf:
+ *
+ * C = op(Q) * C  or  C = C * op(Q)
+ *
+ * where Q is the product of the first _K reflectors stored in A and _tau.
+ * A has M rows if _Side is 'l', N rows otherwise.
+ *
+ * See the netlib lapack interface documentation for more details of the high
+ * level interface:
+ * http://www.netlib.org/lapack/explore-html/da/d82/dormqr_8f.html
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _ormqr(
+    executor_t& ex, char _Side, char _Trans, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, const element_t* _tau,
+    container_1_t c_, index_t _ldc, index_t _block_size);
+}  // namespace internal
+
+/*!
+ * @brief Blocked Cholesky factorization.
+ *
+ * See internal::_potrf. _block_size is the order of the diagonal blocks
+ * factored in local memory; 0 selects the default block size.
+ */
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _potrf(executor_t& ex, char _Uplo,
+                                              index_t _N, container_t a_,
+                                              index_t _lda,
+                                              index_t _block_size = 0) {
+  auto ret = internal::_potrf(ex, _Uplo, _N,
+                              ex.get_policy_handler().get_buffer(a_), _lda,
+                              _block_size);
+  using element_t = typename ValueType<container_t>::type;
+  const double n = static_cast<double>(_N);
+  static const auto slot = RuntimeStatistics::routine_slot("_potrf");
+  ex.get_statistics().record_routine(
+      slot, internal::factorization_work<element_t>(n * n * n / 3, n * (n + 1)),
+      ret);
+  return ret;
+}
+
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _potrf_batched(executor_t& ex,
+                                                      char _Uplo, index_t _N,
+                                                      container_t a_,
+                                                      index_t _lda,
+                                                      index_t batch_size) {
+  auto ret = internal::_potrf_batched(
+      ex, _Uplo, _N, ex.get_policy_handler().get_buffer(a_), _lda, batch_size);
+  using element_t = typename ValueType<container_t>::type;
+  const double n = static_cast<double>(_N);
+  static const auto slot = RuntimeStatistics::routine_slot("_potrf_batched");
+  ex.get_statistics().record_routine(
+      slot,
+      static_cast<double>(batch_size) *
+          internal::factorization_work<element_t>(n * n * n / 3, n * (n + 1)),
+      ret);
+  return ret;
+}
+/*!
+ * @brief Blocked LU factorization with partial pivoting.
+ *
+ * See internal::_getrf. _block_size is the number of columns of the panels;
+ * 0 selects the default block size.
+ */
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _getrf(executor_t& ex, index_t _M,
+                                              index_t _N, container_t a_,
+                                              index_t _lda, index_t* _ipiv,
+                                              index_t _block_size = 0) {
+  auto ret = internal::_getrf(ex, _M, _N,
+                              ex.get_policy_handler().get_buffer(a_), _lda,
+                              _ipiv, _block_size);
+  using element_t = typename ValueType<container_t>::type;
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  const double k = std::min(m, n);
+  static const auto slot = RuntimeStatistics::routine_slot("_getrf");
+  ex.get_statistics().record_routine(
+      slot, internal::factorization_work<element_t>(
+          2 * m * n * k - (m + n) * k * k + 2 * k * k * k / 3, 2 * m * n),
+      ret);
+  return ret;
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _getrs(executor_t& ex, char _Trans,
+                                              index_t _N, index_t _NRHS,
+                                              container_0_t a_, index_t _lda,
+                                              const index_t* _ipiv,
+                                              container_1_t b_, index_t _ldb) {
+  auto ret = internal::_getrs(ex, _Trans, _N, _NRHS,
+                              ex.get_policy_handler().get_buffer(a_), _lda,
+                              _ipiv, ex.get_policy_handler().get_buffer(b_),
+                              _ldb);
+  using element_t = typename ValueType<container_0_t>::type;
+  const double n = static_cast<double>(_N);
+  const double nrhs = static_cast<double>(_NRHS);
+  static const auto slot = RuntimeStatistics::routine_slot("_getrs");
+  ex.get_statistics().record_routine(
+      slot, internal::factorization_work<element_t>(2 * n * n * nrhs,
+                                                    n * n + 2 * n * nrhs),
+      ret);
+  return ret;
+}
+/*!
+ * @brief Blocked Householder QR factorization.
+ *
+ * See internal::_geqrf. _block_size is the number of columns of the panels;
+ * 0 selects the default block size.
+ */
+template <typename executor_t, typename container_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _geqrf(executor_t& ex, index_t _M,
+                                              index_t _N, container_t a_,
+                                              index_t _lda, element_t* _tau,
+                                              index_t _block_size = 0) {
+  auto ret = internal::_geqrf(ex, _M, _N,
+                              ex.get_policy_handler().get_buffer(a_), _lda,
+                              _tau, _block_size);
+  using element_t = typename ValueType<container_t>::type;
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  const double k = std::min(m, n);
+  static const auto slot = RuntimeStatistics::routine_slot("_geqrf");
+  ex.get_statistics().record_routine(
+      slot, internal::factorization_work<element_t>(
+          4 * m * n * k - 2 * (m + n) * k * k + 4 * k * k * k / 3, 2 * m * n),
+      ret);
+  return ret;
+}
+
+/*!
+ * @brief Multiplication by the orthogonal matrix of a QR factorization.
+ *
+ * See internal::_ormqr. _block_size is the number of reflectors applied at
+ * once; 0 selects the default block size.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _ormqr(
+    executor_t& ex, char _Side, char _Trans, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, const element_t* _tau,
+    container_1_t c_, index_t _ldc, index_t _block_size = 0) {
+  auto ret = internal::_ormqr(ex, _Side, _Trans, _M, _N, _K,
+                              ex.get_policy_handler().get_buffer(a_), _lda,
+                              _tau, ex.get_policy_handler().get_buffer(c_),
+                              _ldc, _block_size);
+  using element_t = typename ValueType<container_0_t>::type;
+  const bool is_left = tolower(_Side) == 'l';
+  const double m = static_cast<double>(_M);
+  const double n = static_cast<double>(_N);
+  const double k = static_cast<double>(_K);
+  // Rows of the reflectors, of which the upper triangle is not read
+  const double rows = is_left ? m : n;
+  static const auto slot = RuntimeStatistics::routine_slot("_ormqr");
+  ex.get_statistics().record_routine(
+      slot, internal::factorization_work<element_t>(
+          4 * m * n * k - 2 * (is_left ? n : m) * k * k,
+          rows * k - k * (k - 1) / 2 + 2 * m * n),
+      ret);
+  return ret;
+}
+}  // namespace blas
+#endif  // SYCL_BLAS_LAPACK_INTERFACE_H
@@ -0,0 +1,146 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename rank_update.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_RANK_UPDATE_H
+#define SYCL_BLAS_RANK_UPDATE_H
+
+#include "blas_meta.h"
+#include "executors/executor.h"
+
+namespace blas {
+
+/*!
+ @brief Deferred rank 1 updates of a matrix.
+
+ Each call to _ger or _syr reads and writes the whole matrix A for only two
+ floating point operations per element. RankUpdateAccumulator instead stores
+ the update vectors of up to max_rank consecutive GER, SYR or SYR2 updates in
+ two device matrices X (M x max_rank) and Y (N x max_rank), alpha being
+ applied to X, and applies them together as the rank k update:
+
+ A = X * Y^T + A
+
+ which reads and writes A once. For a general matrix the update is a _gemm,
+ and for a symmetric matrix a _gemmt which only writes the triangle _Uplo of
+ A, as _syr and _syr2 do.
+
+ The updates are applied when max_rank updates are pending, or when flush is
+ called: flush must be called before A is read. All the device work is
+ ordered through the buffers, so the events returned only need to be waited
+ for before the host reads A.
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+class RankUpdateAccumulator {
+ public:
+  using element_t = typename ValueType<container_t>::type;
+  using event_t = typename executor_t::policy_t::event_t;
+
+  /*!
+   @param ex executor_t (sycl, parallel, serial, etc)
+   @param _Uplo 'g' if A is a general matrix, otherwise the triangle ('u', 'l')
+   of the symmetric matrix A which is stored and updated
+   @param _M the number of rows of A
+   @param _N the number of columns of A (equal to _M if A is symmetric)
+   @param _mA (_lda, _N) the matrix to update
+   @param _lda >max(1, _M) the first dimension of _mA
+   @param _max_rank >0 the maximum number of updates kept pending
+   */
+  RankUpdateAccumulator(executor_t& ex, char _Uplo, index_t _M, index_t _N,
+                        container_t _mA, index_t _lda, index_t _max_rank);
+
+  /*!
+   @brief Adds the update A = alpha*x*yT + A of a general matrix.
+   */
+  event_t ger(element_t _alpha, container_t _vx, increment_t _incx,
+              container_t _vy, increment_t _incy);
+
+  /*!
+   @brief Adds the update A = alpha*x*xT + A of a symmetric matrix.
+   */
+  event_t syr(element_t _alpha, container_t _vx, increment_t _incx);
+
+  /*!
+   @brief Adds the update A = alpha*x*yT + alpha*y*xT + A of a symmetric
+   matrix, which takes two of the pending updates.
+   */
+  event_t syr2(element_t _alpha, container_t _vx, increment_t _incx,
+               container_t _vy, increment_t _incy);
+
+  /*!
+   @brief Applies the pending updates to A, counted as a call to
+   _rank_update in the statistics of the executor.
+   */
+  event_t flush();
+
+  /*!
+   @brief Number of pending updates.
+   */
+  index_t get_rank() const { return rank_; }
+
+  index_t get_max_rank() const { return max_rank_; }
+
+ private:
+  event_t push(element_t _alpha, container_t _vx, increment_t _incx,
+               container_t _vy, increment_t _incy);
+
+  executor_t& ex_;
+  char uplo_;
+  index_t m_;
+  index_t n_;
+  container_t mA_;
+  index_t lda_;
+  index_t max_rank_;
+  index_t rank_;
+  container_t mX_;
+  container_t mY_;
+};
+
+/*!
+ @brief Makes an accumulator of GER updates of the general matrix A.
+ */
+template <typename executor_t, typename container_t, typename index_t>
+inline RankUpdateAccumulator<executor_t, container_t, index_t, index_t>
+make_ger_accumulator(executor_t& ex, index_t _M, index_t _N, container_t _mA,
+                     index_t _lda, index_t _max_rank) {
+  return RankUpdateAccumulator<executor_t, container_t, index_t, index_t>(
+      ex, 'g', _M, _N, _mA, _lda, _max_rank);
+}
+
+/*!
+ @brief Makes an accumulator of SYR and SYR2 updates of the symmetric matrix
+ A, of which the triangle _Uplo is stored.
+ */
+template <typename executor_t, typename container_t, typename index_t>
+inline RankUpdateAccumulator<executor_t, container_t, index_t, index_t>
+make_syr_accumulator(executor_t& ex, char _Uplo, index_t _N, container_t _mA,
+                     index_t _lda, index_t _max_rank) {
+  return RankUpdateAccumulator<executor_t, container_t, index_t, index_t>(
+      ex, _Uplo, _N, _N, _mA, _lda, _max_rank);
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_RANK_UPDATE_H
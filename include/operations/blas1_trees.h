@@ -88,6 +88,36 @@ struct DoubleAssign {
   void adjust_access_displacement();
 };
 
+/*! ComplexScaleAdd.
+ * @brief Implements c = alpha * w + beta * c for complex alpha, beta, w and c,
+ * c being a column major matrix whose real and imaginary parts are
+ * interleaved, seen as a real matrix of 2 * rows rows. The real and imaginary
+ * parts of w are given by two expressions over the elements of c taken in
+ * column major order. c is not read when beta is zero.
+ */
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+struct ComplexScaleAdd {
+  using index_t = typename lhs_t::index_t;
+  using value_t = typename lhs_t::value_t;
+  lhs_t lhs_;
+  rhs_1_t rhs_re_;
+  rhs_2_t rhs_im_;
+  index_t rows_;
+  value_t alpha_re_;
+  value_t alpha_im_;
+  value_t beta_re_;
+  value_t beta_im_;
+  ComplexScaleAdd(lhs_t &_l, index_t _rows, rhs_1_t _r1, rhs_2_t _r2,
+                  value_t _alpha_re, value_t _alpha_im, value_t _beta_re,
+                  value_t _beta_im);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
 /*!ScalarOp.
  * @brief Implements an scalar operation.
  * (e.g alpha OP x, with alpha scalar and x vector)
@@ -246,6 +276,15 @@ inline TupleOp<rhs_t> make_tuple_op(rhs_t &rhs_) {
   return TupleOp<rhs_t>(rhs_);
 }
 
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t, typename index_t,
+          typename value_t>
+inline ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t> make_complex_scale_add(
+    lhs_t &lhs_, index_t rows_, rhs_1_t &rhs_re_, rhs_2_t &rhs_im_,
+    value_t alpha_re_, value_t alpha_im_, value_t beta_re_, value_t beta_im_) {
+  return ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>(
+      lhs_, rows_, rhs_re_, rhs_im_, alpha_re_, alpha_im_, beta_re_, beta_im_);
+}
+
 }  // namespace blas
 
 #endif  // BLAS1_TREES_H
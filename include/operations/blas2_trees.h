@@ -26,27 +26,64 @@
 #ifndef SYCL_BLAS_BLAS2_TREES_H
 #define SYCL_BLAS_BLAS2_TREES_H
 namespace blas {
-template <typename output_t, typename matrix_t, typename vector_t>
+/**
+ * @struct Gemv
+ * @brief Tree node representing a single pass generalised matrix vector
+ * product, lhs_ = alpha_ * matrix_ * vector_ + beta_ * lhs_.
+ *
+ * Each work group covers all the columns of its rows, so no partial sums have
+ * to be written to a scratch matrix and added up afterwards: alpha and beta
+ * are applied by the work item that finishes a row.
+ *
+ * With a column major matrix each work item computes one row, the slices of
+ * vector_ being staged in local memory. With a row major matrix (transposed
+ * product) each work group computes one row and reduces it in local memory.
+ * The local memory size must be the work group size, a power of two.
+ *
+ * Batches of products are mapped to consecutive ranges of nWG_batch_ work
+ * groups, the operands of batch b starting b times their stride after the
+ * ones of the views.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
 struct Gemv {
   using value_t = typename vector_t::value_t;
   using index_t = typename vector_t::index_t;
-  output_t lhs_;
+  lhs_t lhs_;
   matrix_t matrix_;
   vector_t vector_;
+  value_t alpha_;
+  value_t beta_;
+  index_t nWG_batch_;
+  index_t stride_a_;
+  index_t stride_x_;
+  index_t stride_y_;
 
-  Gemv(output_t &_l, matrix_t &_matrix, vector_t &_vector);
+  Gemv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, value_t _alpha,
+       value_t _beta, index_t _nWG_batch, index_t _stride_a, index_t _stride_x,
+       index_t _stride_y);
   index_t get_size() const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
-  value_t eval(index_t i);
-  value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <typename sharedT>
+  void eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
 
-template <typename output_t, typename matrix_t, typename vector_t>
-Gemv<output_t, matrix_t, vector_t> make_gemv(output_t &lhs_, matrix_t &matrix_,
-                                             vector_t &vector_) {
-  return Gemv<output_t, matrix_t, vector_t>(lhs_, matrix_, vector_);
+/*!
+ @brief Generator/factory for single pass GEMV trees. The strides default to
+ a single product.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+Gemv<lhs_t, matrix_t, vector_t> make_gemv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_,
+    typename vector_t::index_t nWG_batch_,
+    typename vector_t::index_t stride_a_ = 0,
+    typename vector_t::index_t stride_x_ = 0,
+    typename vector_t::index_t stride_y_ = 0) {
+  return Gemv<lhs_t, matrix_t, vector_t>(lhs_, matrix_, vector_, alpha_, beta_,
+                                         nWG_batch_, stride_a_, stride_x_,
+                                         stride_y_);
 }
 
 template <typename rhs_t>
@@ -78,6 +115,40 @@ AddSetColumns<rhs_t> make_addSetColumns(rhs_t &rhs_) {
   return AddSetColumns<rhs_t>(rhs_);
 }
 
+/**
+ * @struct TriangleBlockMap
+ * @brief Maps the work groups of a blocked kernel on a square matrix of order
+ * dim_ to the blocks which intersect the referenced part of the matrix.
+ *
+ * The matrix is split in nWG_inner_ x nWG_outer_ blocks of inner_sz_ x
+ * outer_sz_ elements, consecutive work groups taking consecutive inner blocks
+ * of the same outer block. Lower (resp. Upper) means that the elements whose
+ * inner index is greater (resp. smaller) than the outer index are referenced,
+ * and Diag that the diagonal is. When the whole matrix is referenced, or
+ * there is a single inner block, every block is launched, otherwise only the
+ * blocks which intersect the triangle are, which is about half of them. The
+ * inner blocks must cover the matrix (nWG_inner_ * inner_sz_ >= dim_).
+ */
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+struct TriangleBlockMap {
+  index_t dim_;
+  index_t nWG_inner_;
+  index_t nWG_outer_;
+  index_t inner_sz_;
+  index_t outer_sz_;
+
+  TriangleBlockMap(index_t _dim, index_t _nWG_inner, index_t _nWG_outer,
+                   index_t _inner_sz, index_t _outer_sz);
+  void get_inner_range(index_t outer, index_t &first, index_t &last) const;
+  bool is_full() const;
+  bool is_launched(index_t inner, index_t outer) const;
+  static index_t floor_sum(index_t n, index_t a, index_t b, index_t c);
+  index_t get_num_regular() const;
+  index_t get_first_block(index_t outer) const;
+  index_t get_num_blocks() const;
+  void get_block(index_t groupid, index_t &inner, index_t &outer) const;
+};
+
 /**
  * @struct GemvCol
  * @brief Tree node representing a Gemv, with parallel expressed across columns
@@ -88,6 +159,8 @@ template <bool Lower, bool Diag, bool Upper, bool Unit, typename lhs_t,
 struct GemvCol {
   using value_t = typename vector_t::value_t;
   using index_t = typename vector_t::index_t;
+  // Blocks of rows (inner) and of columns (outer)
+  using block_map_t = TriangleBlockMap<Lower, Diag, Upper, index_t>;
   lhs_t lhs_;
   matrix_t matrix_;
   vector_t vector_;
@@ -103,6 +176,12 @@ struct GemvCol {
   value_t eval(cl::sycl::nd_item<1> ndItem);
   template <typename sharedT>
   value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  value_t load_matrix(index_t i, index_t j);
+  block_map_t get_block_map(index_t localSz) const;
+  index_t get_num_groups(index_t localSz) const;
+  void clear_skipped_blocks(const block_map_t &map, index_t idWFR,
+                            index_t idWFC, index_t frs_row, index_t lst_row,
+                            index_t localSz);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -129,6 +208,8 @@ template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
 struct GemvRow {
   using value_t = typename vector_t::value_t;
   using index_t = typename vector_t::index_t;
+  // Blocks of columns (inner) and of rows (outer), hence the swapped triangle
+  using block_map_t = TriangleBlockMap<Upper, Diag, Lower, index_t>;
 
   lhs_t lhs_;
   matrix_t matrix_;
@@ -145,6 +226,13 @@ struct GemvRow {
   value_t eval(cl::sycl::nd_item<1> ndItem);
   template <typename sharedT>
   value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  value_t load_matrix(index_t i, index_t j);
+  block_map_t get_block_map(index_t localSz) const;
+  index_t get_num_groups(index_t localSz) const;
+  template <bool Shared>
+  void clear_skipped_blocks(const block_map_t &map, index_t idWFR,
+                            index_t idWFC, index_t frs_row, index_t lst_row,
+                            index_t localid, index_t localSz);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -173,6 +261,92 @@ make_Gemv_Row(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
                            local_memory_size_);
 }
 
+/**
+ * @struct Symv
+ * @brief Tree node representing a symmetric matrix vector product which reads
+ * the stored triangle of the matrix only once.
+ *
+ * The lower triangle of the matrix is split in square tiles of tile_size_ and
+ * each work group loads one tile in local memory. An off-diagonal tile
+ * contributes both to its block row (A * x) and, transposed, to its block
+ * column (A^T * x); a diagonal tile is mirrored. Each contribution goes to its
+ * own column of lhs_ (N x number of tiles per row), so that the partial sums
+ * are added up afterwards by AddSetColumns.
+ *
+ * The upper triangle is handled by passing the row major view of the matrix.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+struct Symv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  index_t tile_size_;
+
+  Symv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, index_t _tile_size);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  void eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for single pass SYMV trees.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+Symv<lhs_t, matrix_t, vector_t> make_symv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::index_t tile_size_) {
+  return Symv<lhs_t, matrix_t, vector_t>(lhs_, matrix_, vector_, tile_size_);
+}
+
+/**
+ * @struct GemvDual
+ * @brief Tree node computing both matrix_ * vector_ and
+ * matrix_^T * vectorT_ while reading the matrix only once.
+ *
+ * The matrix is split in square tiles of tile_size_ and each work group loads
+ * one tile in local memory. The tile (bi, bj) contributes to block row bi of
+ * A * x, written to column bj of lhs_ (M x number of tiles per row), and to
+ * block column bj of A^T * w, written to column bi of lhsT_ (N x number of
+ * tiles per column). The partial sums are added up afterwards by
+ * AddSetColumns.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+struct GemvDual {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  lhs_t lhsT_;
+  matrix_t matrix_;
+  vector_t vector_;
+  vector_t vectorT_;
+  index_t tile_size_;
+
+  GemvDual(lhs_t &_l, lhs_t &_lT, matrix_t &_matrix, vector_t &_vector,
+           vector_t &_vectorT, index_t _tile_size);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  void eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for fused dual GEMV trees.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+GemvDual<lhs_t, matrix_t, vector_t> make_gemv_dual(
+    lhs_t &lhs_, lhs_t &lhsT_, matrix_t &matrix_, vector_t &vector_,
+    vector_t &vectorT_, typename vector_t::index_t tile_size_) {
+  return GemvDual<lhs_t, matrix_t, vector_t>(lhs_, lhsT_, matrix_, vector_,
+                                             vectorT_, tile_size_);
+}
+
 /**** GER BY ROWS M ROWS x N BLOCK USING PROPERLY THE SHARED MEMORY ****/
 // template <typename lhs_t,typename rhs_1_t,typename rhs_2_t>
 template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
@@ -217,6 +391,8 @@ template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
 struct GerCol {
   using value_t = typename rhs_2_t::value_t;
   using index_t = typename rhs_2_t::index_t;
+  // Blocks of rows (inner) and of columns (outer)
+  using block_map_t = TriangleBlockMap<Lower, Diag, Upper, index_t>;
 
   lhs_t lhs_;
   rhs_1_t rhs_1_;
@@ -229,6 +405,8 @@ struct GerCol {
   GerCol(lhs_t &_l, value_t _scl, rhs_1_t &_r1, rhs_2_t &_r2, index_t &_nWG_row,
          index_t &_nWG_col, index_t &_shrMemSize);
   index_t get_size() const;
+  block_map_t get_block_map(index_t localSz) const;
+  index_t get_num_groups(index_t localSz) const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -250,5 +428,326 @@ GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t> make_Ger_Col(
       lhs_, scalar_, rhs_1_, rhs_2_, nWG_row_, nWG_col_, local_memory_size_);
 }
 
+/**
+ * @struct Gbmv
+ * @brief Tree node representing a matrix vector product with a band matrix,
+ * lhs_ = alpha_ * op(matrix_) * vector_ + beta_ * lhs_.
+ *
+ * Each work item computes one element of lhs_, reading only the band of its
+ * row of op(matrix_). The matrix is a BandMatrixView, whose structure also
+ * makes this node compute the products with symmetric (SBMV) and triangular
+ * (TBMV) band matrices, or a PackedMatrixView (SPMV, TPMV), whose band spans
+ * the whole matrix or triangle. lhs_ is not read when beta_ is zero.
+ *
+ * @tparam Trans iff true, op(matrix_) is the transpose of matrix_
+ */
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+struct Gbmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  value_t alpha_;
+  value_t beta_;
+
+  Gbmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, value_t _alpha,
+       value_t _beta);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for band matrix vector product trees.
+ */
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+Gbmv<Trans, lhs_t, matrix_t, vector_t> make_gbmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_) {
+  return Gbmv<Trans, lhs_t, matrix_t, vector_t>(lhs_, matrix_, vector_, alpha_,
+                                                beta_);
+}
+
+/**
+ * @struct Spr
+ * @brief Tree node representing a rank 1 (SPR) or rank 2 (SPR2) update of a
+ * symmetric matrix stored in the packed layout:
+ * lhs_ = alpha_ * rhs_1_ * rhs_1_^T + lhs_ (Single), or
+ * lhs_ = alpha_ * (rhs_1_ * rhs_2_^T + rhs_2_ * rhs_1_^T) + lhs_.
+ *
+ * Each work item updates one element of the packed storage, recovering its
+ * row and column from its offset, so that consecutive work items write
+ * consecutive addresses.
+ *
+ * @tparam Single iff true, the update is of rank 1 and rhs_2_ is not read
+ */
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+struct Spr {
+  using value_t = typename rhs_1_t::value_t;
+  using index_t = typename rhs_1_t::index_t;
+  lhs_t lhs_;
+  value_t alpha_;
+  rhs_1_t rhs_1_;
+  rhs_2_t rhs_2_;
+
+  Spr(lhs_t &_l, value_t _alpha, rhs_1_t &_r1, rhs_2_t &_r2);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t k);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for packed symmetric rank 1 and rank 2 updates.
+ */
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+Spr<Single, lhs_t, rhs_1_t, rhs_2_t> make_spr(lhs_t &lhs_,
+                                              typename rhs_1_t::value_t alpha_,
+                                              rhs_1_t &rhs_1_,
+                                              rhs_2_t &rhs_2_) {
+  return Spr<Single, lhs_t, rhs_1_t, rhs_2_t>(lhs_, alpha_, rhs_1_, rhs_2_);
+}
+
+/**
+ * @struct Csrmv
+ * @brief Tree node representing the product of a sparse matrix stored in the
+ * CSR format with a vector, (matrix_ * vector_)[i] being the value of the
+ * element i.
+ *
+ * The node does not write anything, so that it composes with the BLAS 1 trees
+ * like a vector: e.g. make_op<Assign>(y, make_op<BinaryOp, AddOperator>(
+ * make_op<ScalarOp, ProductOperator>(alpha, csrmv), z)) computes
+ * y = alpha * A * x + z in a single kernel. Each element is the dot product of
+ * one row, computed by a single work item.
+ */
+template <typename matrix_t, typename vector_t>
+struct Csrmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  matrix_t matrix_;
+  vector_t vector_;
+
+  Csrmv(matrix_t &_matrix, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for CSR sparse matrix vector product trees.
+ */
+template <typename matrix_t, typename vector_t>
+Csrmv<matrix_t, vector_t> make_csrmv(matrix_t &matrix_, vector_t &vector_) {
+  return Csrmv<matrix_t, vector_t>(matrix_, vector_);
+}
+
+/**
+ * @struct CsrmvVector
+ * @brief Tree node computing lhs_ = alpha_ * matrix_ * vector_ + beta_ * lhs_
+ * for a sparse matrix stored in the CSR format, with a vector of work items
+ * per row.
+ *
+ * The vector_size_ consecutive work items of a row read its nonzeros with a
+ * stride of vector_size_, so that their loads are contiguous, and their
+ * partial sums are reduced in local memory (vector_size_ elements per row).
+ * vector_size_ is a power of two which divides the work group size. lhs_ is
+ * not read when beta_ is zero.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+struct CsrmvVector {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  value_t alpha_;
+  value_t beta_;
+  const index_t vector_size_;
+
+  CsrmvVector(lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+              value_t _alpha, value_t _beta, index_t _vector_size);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for vector per row CSR sparse matrix vector
+ products.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+CsrmvVector<lhs_t, matrix_t, vector_t> make_csrmv_vector(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_,
+    typename vector_t::index_t vector_size_) {
+  return CsrmvVector<lhs_t, matrix_t, vector_t>(lhs_, matrix_, vector_, alpha_,
+                                                beta_, vector_size_);
+}
+
+/**
+ * @struct CsrmvMergePath
+ * @brief Tree node computing lhs_ = alpha_ * matrix_ * vector_ + beta_ * lhs_
+ * for a sparse matrix stored in the CSR format, splitting the work evenly
+ * with the merge path decomposition.
+ *
+ * The merge of the row end offsets with the nonzeros is split in chunks of
+ * items_per_thread_ items, one per work item, which finds its first row with
+ * a binary search. Whatever the distribution of the nonzeros, each work item
+ * then reads at most items_per_thread_ nonzeros or row ends. It writes the
+ * rows which end in its chunk, and the partial sum of the row left unfinished
+ * at its end to carry_row_ and carry_val_ (a row of matrix_.get_size_row() if
+ * there is none), which CsrmvMergeFixup adds afterwards. lhs_ is not read
+ * when beta_ is zero.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+struct CsrmvMergePath {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  carry_row_t carry_row_;
+  carry_val_t carry_val_;
+  value_t alpha_;
+  value_t beta_;
+  const index_t items_per_thread_;
+
+  CsrmvMergePath(lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+                 carry_row_t &_carry_row, carry_val_t &_carry_val,
+                 value_t _alpha, value_t _beta, index_t _items_per_thread);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  index_t merge_path_search(index_t diagonal) const;
+  value_t eval(index_t t);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for merge path CSR sparse matrix vector products.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t, carry_val_t>
+make_csrmv_merge_path(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+                      carry_row_t &carry_row_, carry_val_t &carry_val_,
+                      typename vector_t::value_t alpha_,
+                      typename vector_t::value_t beta_,
+                      typename vector_t::index_t items_per_thread_) {
+  return CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t, carry_val_t>(
+      lhs_, matrix_, vector_, carry_row_, carry_val_, alpha_, beta_,
+      items_per_thread_);
+}
+
+/**
+ * @struct CsrmvMergeFixup
+ * @brief Tree node adding alpha_ times the partial sums left by
+ * CsrmvMergePath to their rows of lhs_, as one level of a segmented reduction
+ * keyed by carry_row_.
+ *
+ * The partial sums of a row are consecutive, the rows of carry_row_ being
+ * sorted. Each work group scans its partial sums in local memory (one element
+ * per work item), restarting the sum at each change of row, so that the last
+ * work item of each row holds its total within the work group. The rows which
+ * end within the work group are added to lhs_, and the last one, which may go
+ * on in the next work group, is written to carry_row_out_ and carry_val_out_
+ * (one element per work group) for the next level, unless the work group is
+ * the last one. No two work items of a level write the same row of lhs_.
+ */
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+struct CsrmvMergeFixup {
+  using value_t = typename carry_val_t::value_t;
+  using index_t = typename carry_val_t::index_t;
+  lhs_t lhs_;
+  carry_row_t carry_row_;
+  carry_val_t carry_val_;
+  carry_row_t carry_row_out_;
+  carry_val_t carry_val_out_;
+  value_t alpha_;
+
+  CsrmvMergeFixup(lhs_t &_l, carry_row_t &_carry_row, carry_val_t &_carry_val,
+                  carry_row_t &_carry_row_out, carry_val_t &_carry_val_out,
+                  value_t _alpha);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  index_t get_row(index_t t) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for the fixup of merge path CSR sparse matrix
+ vector products.
+ */
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t> make_csrmv_merge_fixup(
+    lhs_t &lhs_, carry_row_t &carry_row_, carry_val_t &carry_val_,
+    carry_row_t &carry_row_out_, carry_val_t &carry_val_out_,
+    typename carry_val_t::value_t alpha_) {
+  return CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>(
+      lhs_, carry_row_, carry_val_, carry_row_out_, carry_val_out_, alpha_);
+}
+
+/*!
+ * @brief DiagonalBlockTrsv solves the triangular system T * x = b for a single
+ * diagonal block T of a blocked triangular solve (TRSV).
+ *
+ * The block is solved by one work group, each work item holding one element of
+ * the right-hand side. At each step of the substitution the work item of the
+ * current row finishes its element and shares it through local memory, then
+ * the work items of the rows still to be solved subtract its contribution.
+ * The local memory size must be the number of rows of the block, which cannot
+ * be larger than the work group.
+ *
+ * The off-diagonal contributions of the solve are applied separately, as GEMV
+ * updates, by the caller.
+ *
+ * @tparam Lower  iff true, T is lower triangular (forward substitution),
+ *                otherwise T is upper triangular (backward substitution)
+ * @tparam Unit  iff true, the diagonal of T is assumed to be all ones
+ * @param lhs_ view of the block of b (rows elements), overwritten with x
+ * @param matrix_ view of the diagonal block T (rows x rows)
+ */
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+struct DiagonalBlockTrsv {
+  using value_t = typename lhs_t::value_t;
+  using index_t = typename lhs_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_;
+
+  DiagonalBlockTrsv(lhs_t &_l, matrix_t &_matrix);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  void eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Generator/factory for the diagonal block solve of a blocked TRSV.
+ */
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t> make_diagonal_block_trsv(
+    lhs_t &lhs_, matrix_t &matrix_) {
+  return DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t>(lhs_, matrix_);
+}
+
 }  // namespace blas
 #endif  // BLAS2_TREES_H
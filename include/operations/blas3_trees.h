@@ -140,6 +140,8 @@ struct Tile {
  * @tparam TransA  iff true, matrix A will be transposed on the fly
  * @tparam TransB  iff true, matrix B will be transposed on the fly
  * @tparam element_t  type of matrix elements
+ * @tparam input_b_t  type of the matrix b_, which only differs from input_t
+ *                    when a single operand is a StructuredMatrixView
  * @param a_ the lhs_t matrix
  * @param b_ the rhs_t matrix
  * @param c_ the output matrix
@@ -156,7 +158,7 @@ struct Tile {
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t = input_t>
 class Gemm {
  public:
   using value_t = element_t;
@@ -166,7 +168,7 @@ class Gemm {
   static constexpr bool trans_b = TransB;
   static constexpr int local_memory_size = 0;
   input_t a_;
-  input_t b_;
+  input_b_t b_;
   output_t c_;
   element_t alpha_;
   element_t beta_;
@@ -177,7 +179,7 @@ class Gemm {
   index_t ldb_;
   index_t ldc_;
   index_t batch_size_;
-  Gemm(input_t A, input_t B, output_t C, element_t alpha, element_t beta,
+  Gemm(input_t A, input_b_t B, output_t C, element_t alpha, element_t beta,
        index_t batch_size);
   static std::string get_type_string() noexcept;
   static index_t get_workgroup_cluster(index_t m, index_t n) noexcept;
@@ -208,16 +210,260 @@ class GemmPartial {};
 template <bool DoubleBuffer, bool ConflictA, bool ConflictB, int ClSize,
           typename TileType, bool TransA, bool TransB, int GemmMemoryType,
           int GemmAlgorithm, bool is_beta_zero, typename input_t,
-          typename output_t, typename element_t, typename index_t>
+          typename input_b_t, typename output_t, typename element_t,
+          typename index_t>
 inline Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
             TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-            GemmAlgorithm>
-make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
+            GemmAlgorithm, input_b_t>
+make_gemm(input_t buffer_a, input_b_t buffer_b, output_t buffer_c,
           element_t alpha, element_t beta, index_t batch_size) {
   return Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
               TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-              GemmAlgorithm>(buffer_a, buffer_b, buffer_c, alpha, beta,
-                             batch_size);
+              GemmAlgorithm, input_b_t>(buffer_a, buffer_b, buffer_c, alpha,
+                                        beta, batch_size);
+}
+
+/*!
+ * @brief GemmBlockSparse runs a local memory Gemm of which the left operand
+ * op(A) is block sparse, the K loop of the Gemm skipping the steps on blocks
+ * of zeros of op(A).
+ *
+ * op(A) is split in blocks of block_size_ x block_size_ elements, mask_
+ * holding one integer per block, in column major order, which is zero when
+ * all the elements of the block are zero. A step of the K loop is skipped
+ * when all the blocks it overlaps are zero, for all the work items of a work
+ * group at once.
+ *
+ * @param gemm_ the Gemm, with gemm_memory_t::local and
+ *              gemm_algorithm_t::standard, and a batch size of 1
+ * @param mask_ view of the mask of the blocks of op(A)
+ */
+template <typename gemm_t, typename mask_t>
+struct GemmBlockSparse {
+  using value_t = typename gemm_t::value_t;
+  using index_t = typename gemm_t::index_t;
+  gemm_t gemm_;
+  mask_t mask_;
+  index_t block_size_;
+  index_t rows_;       // number of rows of op(A)
+  index_t depth_;      // number of columns of op(A)
+  index_t mask_rows_;  // number of blocks in a column of op(A)
+
+  GemmBlockSparse(gemm_t _gemm, mask_t _mask, index_t _block_size);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  bool operator()(index_t row, index_t rows, index_t col, index_t cols) const;
+  template <typename sharedT>
+  void eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Generator/factory for the block sparse Gemm.
+ */
+template <typename gemm_t, typename mask_t>
+inline GemmBlockSparse<gemm_t, mask_t> make_gemm_block_sparse(
+    gemm_t gemm_, mask_t mask_, typename gemm_t::index_t block_size_) {
+  return GemmBlockSparse<gemm_t, mask_t>(gemm_, mask_, block_size_);
+}
+
+/*!
+ * @brief GemmDeviceScalars runs a Gemm of which alpha and beta are held in
+ * device memory, each work item reading them before running the Gemm.
+ *
+ * As beta is only known on the device, the Gemm is held twice, with
+ * is_beta_zero false and true, the latter being run when beta is zero so that
+ * C is not read, following the BLAS convention that NaNs in C are then
+ * ignored. Both Gemms have the same configuration, hence the same nd_range.
+ *
+ * @param gemm_ the Gemm, with is_beta_zero false
+ * @param gemm_beta_zero_ the same Gemm, with is_beta_zero true
+ * @param alpha_ view of the single element alpha
+ * @param beta_ view of the single element beta
+ */
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+struct GemmDeviceScalars {
+  using value_t = typename gemm_t::value_t;
+  using index_t = typename gemm_t::index_t;
+  gemm_t gemm_;
+  gemm_beta_zero_t gemm_beta_zero_;
+  scalar_t alpha_;
+  scalar_t beta_;
+
+  GemmDeviceScalars(gemm_t _gemm, gemm_beta_zero_t _gemm_beta_zero,
+                    scalar_t _alpha, scalar_t _beta);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  void eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Generator/factory for the Gemm with alpha and beta in device memory.
+ */
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+inline GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t>
+make_gemm_device_scalars(gemm_t gemm_, gemm_beta_zero_t gemm_beta_zero_,
+                         scalar_t alpha_, scalar_t beta_) {
+  return GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t>(
+      gemm_, gemm_beta_zero_, alpha_, beta_);
+}
+
+/*!
+ * @brief DiagonalBlockTrsm solves the triangular system T * X = alpha * B for
+ * a single diagonal block T of a blocked triangular solve (TRSM).
+ *
+ * The block is at most a few tens of rows wide, so one work group copies the
+ * whole triangle into local memory and each work item then performs the
+ * forward (or backward) substitution for one right-hand side, keeping the
+ * partial solution in its own slice of local memory. The result overwrites B.
+ * The off-diagonal contributions of the solve are applied separately, as GEMM
+ * updates, by the caller.
+ *
+ * The right-hand side solve X * op(A) = B is handled by the caller by passing
+ * transposed (row-major) views of A and B.
+ *
+ * @tparam Lower  iff true, T is lower triangular (forward substitution),
+ *                otherwise T is upper triangular (backward substitution)
+ * @tparam Unit  iff true, the diagonal of T is assumed to be all ones
+ * @param lhs_ view of the block rows of B (rows x nrhs), overwritten with X
+ * @param matrix_ view of the diagonal block T (rows x rows)
+ * @param alpha_ the scalar B is multiplied by before the solve
+ */
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+struct DiagonalBlockTrsm {
+  using value_t = typename matrix_t::value_t;
+  using index_t = typename matrix_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_;
+  value_t alpha_;
+
+  DiagonalBlockTrsm(lhs_t &_l, matrix_t &_matrix, value_t _alpha);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  void eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Generator/factory for the diagonal block solve of a blocked TRSM.
+ */
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+inline DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t> make_diagonal_block_trsm(
+    lhs_t &lhs_, matrix_t &matrix_, typename matrix_t::value_t alpha_) {
+  return DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>(lhs_, matrix_, alpha_);
+}
+
+/*!
+ * @brief Gemmt computes a matrix product which only updates one triangle of
+ * the square output matrix, i.e. lhs_ = alpha_ * a_ * b_ + beta_ * lhs_ for
+ * the elements of the triangle given by lower_.
+ *
+ * Each work item computes one element of the triangle, enumerated in the
+ * packed order (see PackedMatrixView) so that consecutive work items access
+ * consecutive rows of lhs_ and a_. The other triangle is neither read nor
+ * written. lhs_ is not read when beta_ is zero. The K loop is not tiled, so
+ * _gemmt only runs it on small diagonal blocks, the off-diagonal blocks being
+ * computed by the tiled Gemm.
+ *
+ * @param lhs_ view of the output matrix (n x n)
+ * @param a_ view of the left operand (n x k)
+ * @param b_ view of the right operand (k x n)
+ */
+template <typename lhs_t, typename a_t, typename b_t>
+struct Gemmt {
+  using value_t = typename a_t::value_t;
+  using index_t = typename a_t::index_t;
+  lhs_t lhs_;
+  a_t a_;
+  b_t b_;
+  value_t alpha_;
+  value_t beta_;
+  bool lower_;
+
+  Gemmt(lhs_t &_l, a_t &_a, b_t &_b, value_t _alpha, value_t _beta,
+        bool _lower);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t k);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Generator/factory for the triangular matrix product.
+ */
+template <typename lhs_t, typename a_t, typename b_t>
+inline Gemmt<lhs_t, a_t, b_t> make_gemmt(lhs_t &lhs_, a_t &a_, b_t &b_,
+                                         typename a_t::value_t alpha_,
+                                         typename a_t::value_t beta_,
+                                         bool lower_) {
+  return Gemmt<lhs_t, a_t, b_t>(lhs_, a_, b_, alpha_, beta_, lower_);
+}
+
+/*!
+ * @brief Spmm computes the product of a sparse matrix in the CSR format with a
+ * dense matrix, i.e. lhs_ = alpha_ * matrix_ * rhs_ + beta_ * lhs_.
+ *
+ * The work is mapped with the vocabulary of Gemm: a work group of
+ * tile_type::wg_rows x tile_type::wg_cols work items computes a block of
+ * (wg_rows * item_rows) x (wg_cols * item_cols) elements of lhs_, each work
+ * item computing item_rows x item_cols elements strided by wg_rows and
+ * wg_cols. The rows of rhs_ are read at the columns of the nonzeros, so it is
+ * the nonzeros of the rows of the block which are staged in local memory,
+ * wg_cols of them per row at a time, and shared by all the work items of
+ * these rows. Consecutive work items take consecutive rows of the block when
+ * lhs_ is column major, and consecutive columns otherwise, so that they write
+ * consecutive elements. lhs_ is not read when beta_ is zero.
+ *
+ * @param lhs_ view of the output matrix (m x n)
+ * @param matrix_ CSR view of the sparse matrix (m x k)
+ * @param rhs_ view of the dense matrix (k x n)
+ */
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+struct Spmm {
+  using value_t = typename rhs_t::value_t;
+  using index_t = typename rhs_t::index_t;
+  static constexpr index_t block_rows =
+      tile_type::wg_rows * tile_type::item_rows;
+  static constexpr index_t block_cols =
+      tile_type::wg_cols * tile_type::item_cols;
+  static constexpr index_t wg_size = tile_type::wg_rows * tile_type::wg_cols;
+  // Number of (column, value) pairs of the nonzeros in local memory
+  static constexpr index_t local_memory_size = block_rows * tile_type::wg_cols;
+  lhs_t lhs_;
+  matrix_t matrix_;
+  rhs_t rhs_;
+  value_t alpha_;
+  value_t beta_;
+
+  Spmm(lhs_t &_l, matrix_t &_matrix, rhs_t &_rhs, value_t _alpha,
+       value_t _beta);
+  index_t get_num_groups() const;
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Generator/factory for the sparse times dense matrix product.
+ */
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+inline Spmm<tile_type, lhs_t, matrix_t, rhs_t> make_spmm(
+    lhs_t &lhs_, matrix_t &matrix_, rhs_t &rhs_, typename rhs_t::value_t alpha_,
+    typename rhs_t::value_t beta_) {
+  return Spmm<tile_type, lhs_t, matrix_t, rhs_t>(lhs_, matrix_, rhs_, alpha_,
+                                                 beta_);
 }
 
 }  // namespace blas
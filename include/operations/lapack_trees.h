@@ -0,0 +1,86 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_trees.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_LAPACK_TREES_H
+#define SYCL_BLAS_LAPACK_TREES_H
+
+#include <CL/sycl.hpp>
+
+namespace blas {
+
+/*!
+ * @brief LocalPotrf computes the Cholesky factorization of small symmetric
+ * positive definite matrices, one matrix per work group, entirely in local
+ * memory.
+ *
+ * The factorization is expressed on the lower triangle: A = L * L^T. The upper
+ * case (A = U^T * U) is handled by the caller by passing transposed
+ * (row-major) views, in which case consecutive matrices of a batch are
+ * consecutive rows of the view instead of consecutive columns.
+ *
+ * In a blocked factorization the symmetric rank-k update of the diagonal
+ * block is applied beforehand with a parallel _gemmt, so that the kernel, which
+ * runs on a single compute unit per matrix, only factors the updated block.
+ *
+ * A matrix which is not positive definite leads to NaN values in the factor.
+ *
+ * @tparam Lower  iff true, the views are column major (lower triangle of A),
+ *                otherwise they are row major (upper triangle of A)
+ * @param matrix_ view of the matrices (n rows, n * batch_size columns in
+ *                lower form)
+ * @param n_ the order of the matrices
+ * @param batch_size_ the number of matrices, one per work group
+ */
+template <bool Lower, typename matrix_t>
+struct LocalPotrf {
+  using value_t = typename matrix_t::value_t;
+  using index_t = typename matrix_t::index_t;
+  matrix_t matrix_;
+  index_t n_;
+  index_t batch_size_;
+
+  LocalPotrf(matrix_t &_matrix, index_t _n, index_t _batch_size);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  void eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Generator/factory for the local memory Cholesky factorization.
+ */
+template <bool Lower, typename matrix_t, typename index_t>
+inline LocalPotrf<Lower, matrix_t> make_local_potrf(matrix_t &matrix_,
+                                                    index_t n_,
+                                                    index_t batch_size_) {
+  return LocalPotrf<Lower, matrix_t>(
+      matrix_, static_cast<typename matrix_t::index_t>(n_),
+      static_cast<typename matrix_t::index_t>(batch_size_));
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_LAPACK_TREES_H
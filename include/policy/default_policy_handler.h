@@ -45,6 +45,8 @@ class PolicyHandler {
 
   bool has_local_memory() const;
 
+  size_t get_local_memory_size() const;
+
   typename policy_t::queue_t get_queue() const;
 
   // Force the system not to set this to bigger than 256. As it can be
@@ -0,0 +1,219 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_event_list.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_SYCL_EVENT_LIST_H
+#define SYCL_BLAS_SYCL_EVENT_LIST_H
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief List of the SYCL events returned by the interface.
+ *
+ * The first inline_capacity events are stored in the object itself, so that
+ * building, concatenating and returning the events of a call does not
+ * allocate. The list only moves to a std::vector when it grows beyond it.
+ * It has the subset of the std::vector interface used by the library, and
+ * converts from and to std::vector<cl::sycl::event>.
+ *
+ * @tparam inline_capacity number of events stored without allocating
+ */
+template <size_t inline_capacity = 8>
+class EventList {
+ public:
+  using value_type = cl::sycl::event;
+  using size_type = size_t;
+  using iterator = cl::sycl::event *;
+  using const_iterator = const cl::sycl::event *;
+
+  static constexpr size_type inline_size = inline_capacity;
+
+  EventList() : size_(0), on_heap_(false) {}
+
+  EventList(std::initializer_list<cl::sycl::event> events) : EventList() {
+    insert(end(), events.begin(), events.end());
+  }
+
+  EventList(const std::vector<cl::sycl::event> &events) : EventList() {
+    insert(end(), events.begin(), events.end());
+  }
+
+  EventList(const EventList &other) : EventList() {
+    insert(end(), other.begin(), other.end());
+  }
+
+  EventList(EventList &&other) : EventList() { move_from(other); }
+
+  EventList &operator=(const EventList &other) {
+    if (this != &other) {
+      clear();
+      insert(end(), other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  EventList &operator=(EventList &&other) {
+    if (this != &other) {
+      clear();
+      move_from(other);
+    }
+    return *this;
+  }
+
+  ~EventList() { clear(); }
+
+  operator std::vector<cl::sycl::event>() const {
+    return std::vector<cl::sycl::event>(begin(), end());
+  }
+
+  size_type size() const { return on_heap_ ? heap_.size() : size_; }
+
+  bool empty() const { return size() == 0; }
+
+  /*!
+   * @brief Whether the events moved to the heap, i.e. the list allocated.
+   */
+  bool on_heap() const { return on_heap_; }
+
+  cl::sycl::event *data() {
+    return on_heap_ ? heap_.data()
+                    : reinterpret_cast<cl::sycl::event *>(inline_);
+  }
+
+  const cl::sycl::event *data() const {
+    return on_heap_ ? heap_.data()
+                    : reinterpret_cast<const cl::sycl::event *>(inline_);
+  }
+
+  iterator begin() { return data(); }
+  iterator end() { return data() + size(); }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data() + size(); }
+
+  cl::sycl::event &operator[](size_type i) { return data()[i]; }
+  const cl::sycl::event &operator[](size_type i) const { return data()[i]; }
+
+  void reserve(size_type capacity) {
+    if (capacity > inline_capacity) {
+      move_to_heap();
+      heap_.reserve(capacity);
+    }
+  }
+
+  void push_back(const cl::sycl::event &event) {
+    if (!on_heap_ && size_ < inline_capacity) {
+      new (data() + size_) cl::sycl::event(event);
+      ++size_;
+    } else {
+      move_to_heap();
+      heap_.push_back(event);
+    }
+  }
+
+  /*!
+   * @brief Inserts the events [first, last) before pos. As for std::vector,
+   * they must not be taken from this list.
+   */
+  template <typename input_it_t>
+  iterator insert(const_iterator pos, input_it_t first, input_it_t last) {
+    const auto offset = pos - begin();
+    const auto old_size = size();
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+    std::rotate(begin() + offset, begin() + old_size, end());
+    return begin() + offset;
+  }
+
+  void clear() {
+    if (on_heap_) {
+      heap_.clear();
+      on_heap_ = false;
+    } else {
+      destroy_inline();
+    }
+  }
+
+  /*!
+   * @brief Waits for all the events of the list.
+   */
+  void wait() {
+    for (auto &event : *this) {
+      event.wait();
+    }
+  }
+
+ private:
+  void destroy_inline() {
+    for (size_type i = 0; i < size_; i++) {
+      data()[i].~event();
+    }
+    size_ = 0;
+  }
+
+  void move_to_heap() {
+    if (on_heap_) {
+      return;
+    }
+    heap_.reserve(2 * inline_capacity);
+    for (size_type i = 0; i < size_; i++) {
+      heap_.push_back(std::move(data()[i]));
+    }
+    destroy_inline();
+    on_heap_ = true;
+  }
+
+  void move_from(EventList &other) {
+    if (other.on_heap_) {
+      heap_ = std::move(other.heap_);
+      on_heap_ = true;
+    } else {
+      for (size_type i = 0; i < other.size_; i++) {
+        new (data() + i) cl::sycl::event(std::move(other.data()[i]));
+      }
+      size_ = other.size_;
+    }
+    other.clear();
+  }
+
+  typename std::aligned_storage<sizeof(cl::sycl::event),
+                                alignof(cl::sycl::event)>::type
+      inline_[inline_capacity];
+  size_type size_;
+  bool on_heap_;
+  std::vector<cl::sycl::event> heap_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SYCL_EVENT_LIST_H
@@ -26,6 +26,7 @@
 #define SYCL_BLAS_SYCL_POLICY_H
 
 #include "blas_meta.h"
+#include "policy/sycl_event_list.h"
 #include <CL/sycl.hpp>
 #include <stdexcept>
 
@@ -57,7 +58,7 @@ struct codeplay_policy {
   template <typename value_t,
             access_mode_t acc_md_t = cl::sycl::access::mode::read_write>
   using default_accessor_t = placeholder_accessor_t<value_t, acc_md_t>;
-  using event_t = std::vector<cl::sycl::event>;
+  using event_t = EventList<>;
 
   enum class device_type : int {
     cpu,
@@ -83,6 +84,11 @@ struct codeplay_policy {
             .template get_info<cl::sycl::info::device::max_work_group_size>());
   }
 
+  static inline size_t get_local_memory_size(cl::sycl::queue &q_) {
+    return q_.get_device()
+        .template get_info<cl::sycl::info::device::local_mem_size>();
+  }
+
   static inline size_t get_num_compute_units(cl::sycl::queue &q_) {
     return q_.get_device()
         .template get_info<cl::sycl::info::device::max_compute_units>();
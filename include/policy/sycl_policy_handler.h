@@ -51,6 +51,7 @@ class PolicyHandler<codeplay_policy> {
         workGroupSize_(codeplay_policy::get_work_group_size(q)),
         selectedDeviceType_(codeplay_policy::find_chosen_device_type(q)),
         localMemorySupport_(codeplay_policy::has_local_memory(q)),
+        localMemorySize_(codeplay_policy::get_local_memory_size(q)),
         computeUnits_(codeplay_policy::get_num_compute_units(q)) {}
 
   template <typename element_t>
@@ -154,6 +155,8 @@ class PolicyHandler<codeplay_policy> {
     return selectedDeviceType_;
   };
   inline bool has_local_memory() const { return localMemorySupport_; }
+  // Size in bytes of the local memory of a work group
+  inline size_t get_local_memory_size() const { return localMemorySize_; }
   typename policy_t::queue_t get_queue() const { return q_; }
 
   inline size_t get_work_group_size() const { return workGroupSize_; }
@@ -162,7 +165,7 @@ class PolicyHandler<codeplay_policy> {
 
   inline void wait() { q_.wait(); }
 
-  inline void wait(policy_t::event_t evs) { cl::sycl::event::wait(evs); }
+  inline void wait(policy_t::event_t evs) { evs.wait(); }
 
   /*  @brief waiting for a list of sycl events
  @param first_event  and next_events are instances of sycl::sycl::event
@@ -171,7 +174,9 @@ class PolicyHandler<codeplay_policy> {
   // dont know howmany permutation can be used by a user
   template <typename first_event_t, typename... next_event_t>
   void inline wait(first_event_t first_event, next_event_t... next_events) {
-    cl::sycl::event::wait(concatenate_vectors(first_event, next_events...));
+    concatenate_vectors(policy_t::event_t(first_event),
+                        policy_t::event_t(next_events)...)
+        .wait();
   }
 
  private:
@@ -180,6 +185,7 @@ class PolicyHandler<codeplay_policy> {
   const size_t workGroupSize_;
   const policy_t::device_type selectedDeviceType_;
   const bool localMemorySupport_;
+  const size_t localMemorySize_;
   const size_t computeUnits_;
 };
 
@@ -32,19 +32,28 @@
 #include "container/blas_iterator.h"
 
 #include "container/sycl_iterator.h"
+#include "container/sycl_future.h"
 
 #include "executors/executor.h"
 
 #include "executors/kernel_constructor.h"
 
+#include "executors/kernel_tracer.h"
+
 #include "interface/blas1_interface.h"
 
 #include "interface/blas2_interface.h"
 
 #include "interface/blas3_interface.h"
 
+#include "interface/lapack_interface.h"
+
 #include "interface/gemm_launcher.h"
 
+#include "interface/rank_update.h"
+
+#include "interface/complex_interface.h"
+
 #include "operations/blas1_trees.h"
 
 #include "operations/blas2_trees.h"
@@ -53,6 +62,8 @@
 
 #include "operations/extension_trees.h"
 
+#include "operations/lapack_trees.h"
+
 #include "operations/blas_constants.h"
 
 #include "operations/blas_operators.h"
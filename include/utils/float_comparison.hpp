@@ -27,6 +27,7 @@
 #define UTILS_FLOAT_COMPARISON_H_
 
 #include <cmath>
+#include <complex>
 #include <iostream>
 
 namespace utils {
@@ -103,6 +104,16 @@ inline bool almost_equal(scalar_t const& scalar1, scalar_t const& scalar2) {
   return (absolute_diff / absolute_sum) < getRelativeErrorMargin<scalar_t>();
 }
 
+/**
+ * Compare two complex scalars, the real and imaginary parts separately.
+ */
+template <typename scalar_t>
+inline bool almost_equal(std::complex<scalar_t> const& scalar1,
+                         std::complex<scalar_t> const& scalar2) {
+  return almost_equal(scalar1.real(), scalar2.real()) &&
+         almost_equal(scalar1.imag(), scalar2.imag());
+}
+
 /**
  * Compare two vectors and returns false if the difference is not acceptable.
  * The second vector is considered the reference.
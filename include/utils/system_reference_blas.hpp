@@ -29,6 +29,7 @@
 #include "cblas.h"
 #include <iostream>
 #include <cmath>
+#include <complex>
 
 namespace {
 CBLAS_TRANSPOSE c_trans(char x) {
@@ -62,6 +63,20 @@ CBLAS_UPLO c_uplo(char x) {
   }
 }
 
+CBLAS_SIDE c_side(char x) {
+  switch (x) {
+    case 'l':
+    case 'L':
+      return CblasLeft;
+    case 'r':
+    case 'R':
+      return CblasRight;
+    default:
+      std::cerr << "Side value " << x << " is invalid.\n";
+      abort();
+  }
+}
+
 CBLAS_DIAG c_diag(char x) {
   switch (x) {
     case 'u':
@@ -207,6 +222,15 @@ void gemv(const char *trans, int m, int n, scalar_t alpha, const scalar_t a[],
                                  beta, c, incY);
 }
 
+template <typename scalar_t>
+void gbmv(const char *trans, int m, int n, int kl, int ku, scalar_t alpha,
+          const scalar_t a[], int lda, const scalar_t b[], int incX,
+          scalar_t beta, scalar_t c[], int incY) {
+  TypeDispatcher<scalar_t>::call(&cblas_sgbmv, &cblas_dgbmv, CblasColMajor,
+                                 c_trans(*trans), m, n, kl, ku, alpha, a, lda,
+                                 b, incX, beta, c, incY);
+}
+
 template <typename scalar_t>
 void ger(int m, int n, scalar_t alpha, const scalar_t a[], int incX,
          const scalar_t b[], int incY, scalar_t c[], int lda) {
@@ -214,6 +238,15 @@ void ger(int m, int n, scalar_t alpha, const scalar_t a[], int incX,
                                  alpha, a, incX, b, incY, c, lda);
 }
 
+template <typename scalar_t>
+void tbmv(const char *uplo, const char *trans, const char *diag, const int n,
+          const int k, const scalar_t *a, const int lda, scalar_t *x,
+          const int incX) {
+  TypeDispatcher<scalar_t>::call(&cblas_stbmv, &cblas_dtbmv, CblasColMajor,
+                                 c_uplo(*uplo), c_trans(*trans), c_diag(*diag),
+                                 n, k, a, lda, x, incX);
+}
+
 template <typename scalar_t>
 void trmv(const char *uplo, const char *trans, const char *diag, const int n,
           const scalar_t *a, const int lda, scalar_t *x, const int incX) {
@@ -222,6 +255,14 @@ void trmv(const char *uplo, const char *trans, const char *diag, const int n,
                                  n, a, lda, x, incX);
 }
 
+template <typename scalar_t>
+void trsv(const char *uplo, const char *trans, const char *diag, const int n,
+          const scalar_t *a, const int lda, scalar_t *x, const int incX) {
+  TypeDispatcher<scalar_t>::call(&cblas_strsv, &cblas_dtrsv, CblasColMajor,
+                                 c_uplo(*uplo), c_trans(*trans), c_diag(*diag),
+                                 n, a, lda, x, incX);
+}
+
 template <typename scalar_t>
 void syr(const char *uplo, const int n, const scalar_t alpha, const scalar_t *x,
          const int incX, scalar_t *a, const int lda) {
@@ -247,6 +288,47 @@ void symv(const char *uplo, const int n, const scalar_t alpha,
                                  y, incY);
 }
 
+template <typename scalar_t>
+void sbmv(const char *uplo, const int n, const int k, const scalar_t alpha,
+          const scalar_t *a, const int lda, const scalar_t *x, const int incX,
+          const scalar_t beta, scalar_t *y, const int incY) {
+  TypeDispatcher<scalar_t>::call(&cblas_ssbmv, &cblas_dsbmv, CblasColMajor,
+                                 c_uplo(*uplo), n, k, alpha, a, lda, x, incX,
+                                 beta, y, incY);
+}
+
+template <typename scalar_t>
+void spmv(const char *uplo, const int n, const scalar_t alpha,
+          const scalar_t *ap, const scalar_t *x, const int incX,
+          const scalar_t beta, scalar_t *y, const int incY) {
+  TypeDispatcher<scalar_t>::call(&cblas_sspmv, &cblas_dspmv, CblasColMajor,
+                                 c_uplo(*uplo), n, alpha, ap, x, incX, beta, y,
+                                 incY);
+}
+
+template <typename scalar_t>
+void tpmv(const char *uplo, const char *trans, const char *diag, const int n,
+          const scalar_t *ap, scalar_t *x, const int incX) {
+  TypeDispatcher<scalar_t>::call(&cblas_stpmv, &cblas_dtpmv, CblasColMajor,
+                                 c_uplo(*uplo), c_trans(*trans), c_diag(*diag),
+                                 n, ap, x, incX);
+}
+
+template <typename scalar_t>
+void spr(const char *uplo, const int n, const scalar_t alpha, const scalar_t *x,
+         const int incX, scalar_t *ap) {
+  TypeDispatcher<scalar_t>::call(&cblas_sspr, &cblas_dspr, CblasColMajor,
+                                 c_uplo(*uplo), n, alpha, x, incX, ap);
+}
+
+template <typename scalar_t>
+void spr2(const char *uplo, const int n, const scalar_t alpha,
+          const scalar_t *x, const int incX, const scalar_t *y, const int incY,
+          scalar_t *ap) {
+  TypeDispatcher<scalar_t>::call(&cblas_sspr2, &cblas_dspr2, CblasColMajor,
+                                 c_uplo(*uplo), n, alpha, x, incX, y, incY, ap);
+}
+
 // =======
 // Level 3
 // =======
@@ -259,6 +341,90 @@ void gemm(const char *transA, const char *transB, int m, int n, int k,
                                  alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+template <typename scalar_t>
+void trsm(const char *side, const char *uplo, const char *transA,
+          const char *diag, int m, int n, scalar_t alpha, const scalar_t a[],
+          int lda, scalar_t b[], int ldb) {
+  TypeDispatcher<scalar_t>::call(&cblas_strsm, &cblas_dtrsm, CblasColMajor,
+                                 c_side(*side), c_uplo(*uplo), c_trans(*transA),
+                                 c_diag(*diag), m, n, alpha, a, lda, b, ldb);
+}
+
+template <typename scalar_t>
+void trmm(const char *side, const char *uplo, const char *transA,
+          const char *diag, int m, int n, scalar_t alpha, const scalar_t a[],
+          int lda, scalar_t b[], int ldb) {
+  TypeDispatcher<scalar_t>::call(&cblas_strmm, &cblas_dtrmm, CblasColMajor,
+                                 c_side(*side), c_uplo(*uplo), c_trans(*transA),
+                                 c_diag(*diag), m, n, alpha, a, lda, b, ldb);
+}
+
+template <typename scalar_t>
+void symm(const char *side, const char *uplo, int m, int n, scalar_t alpha,
+          const scalar_t a[], int lda, const scalar_t b[], int ldb,
+          scalar_t beta, scalar_t c[], int ldc) {
+  TypeDispatcher<scalar_t>::call(&cblas_ssymm, &cblas_dsymm, CblasColMajor,
+                                 c_side(*side), c_uplo(*uplo), m, n, alpha, a,
+                                 lda, b, ldb, beta, c, ldc);
+}
+
+// =======
+// Complex
+// =======
+template <typename scalar_t>
+void axpy(const int n, std::complex<scalar_t> alpha,
+          const std::complex<scalar_t> x[], const int incX,
+          std::complex<scalar_t> y[], const int incY) {
+  TypeDispatcher<scalar_t>::call(&cblas_caxpy, &cblas_zaxpy, n, &alpha, x,
+                                 incX, y, incY);
+}
+
+template <typename scalar_t>
+std::complex<scalar_t> dotu(const int n, const std::complex<scalar_t> x[],
+                            const int incX, const std::complex<scalar_t> y[],
+                            const int incY) {
+  std::complex<scalar_t> res;
+  TypeDispatcher<scalar_t>::call(&cblas_cdotu_sub, &cblas_zdotu_sub, n, x,
+                                 incX, y, incY, &res);
+  return res;
+}
+
+template <typename scalar_t>
+std::complex<scalar_t> dotc(const int n, const std::complex<scalar_t> x[],
+                            const int incX, const std::complex<scalar_t> y[],
+                            const int incY) {
+  std::complex<scalar_t> res;
+  TypeDispatcher<scalar_t>::call(&cblas_cdotc_sub, &cblas_zdotc_sub, n, x,
+                                 incX, y, incY, &res);
+  return res;
+}
+
+template <typename scalar_t>
+scalar_t nrm2(const int n, const std::complex<scalar_t> x[], const int incX) {
+  return TypeDispatcher<scalar_t>::template call<scalar_t>(
+      &cblas_scnrm2, &cblas_dznrm2, n, x, incX);
+}
+
+template <typename scalar_t>
+void gemv(const char *trans, int m, int n, std::complex<scalar_t> alpha,
+          const std::complex<scalar_t> a[], int lda,
+          const std::complex<scalar_t> b[], int incX,
+          std::complex<scalar_t> beta, std::complex<scalar_t> c[], int incY) {
+  TypeDispatcher<scalar_t>::call(&cblas_cgemv, &cblas_zgemv, CblasColMajor,
+                                 c_trans(*trans), m, n, &alpha, a, lda, b,
+                                 incX, &beta, c, incY);
+}
+
+template <typename scalar_t>
+void gemm(const char *transA, const char *transB, int m, int n, int k,
+          std::complex<scalar_t> alpha, const std::complex<scalar_t> a[],
+          int lda, const std::complex<scalar_t> b[], int ldb,
+          std::complex<scalar_t> beta, std::complex<scalar_t> c[], int ldc) {
+  TypeDispatcher<scalar_t>::call(&cblas_cgemm, &cblas_zgemm, CblasColMajor,
+                                 c_trans(*transA), c_trans(*transB), m, n, k,
+                                 &alpha, a, lda, b, ldb, &beta, c, ldc);
+}
+
 #undef COROUTINE_SELECT
 }  // namespace reference_blas
 
@@ -136,7 +136,7 @@ struct MatrixView {
   index_t sizeC_;      // number of columns
   index_t sizeL_;      // size of the leading dimension
   index_t disp_;       // displacementt od the first element
-  // UPLO, BAND(KU,KL), PACKED, SIDE ARE ONLY REQUIRED
+  // UPLO, SIDE ARE ONLY REQUIRED (see BandMatrixView, PackedMatrixView)
   MatrixView(view_container_t &data, view_index_t sizeR, view_index_t sizeC);
   MatrixView(view_container_t &data, view_index_t sizeR, view_index_t sizeC,
              view_index_t sizeL, view_index_t disp);
@@ -205,6 +205,90 @@ struct MatrixView {
   value_t &eval(index_t i, index_t j);
 };
 
+/*!
+@brief Structure of a matrix stored in a single triangle.
+general: every element is stored.
+symmetric: the missing triangle is the mirror of the stored one.
+triangular: the missing triangle is zero.
+*/
+enum class matrix_structure_t : int {
+  general = 0,
+  symmetric = 1,
+  triangular = 2
+};
+
+/*!
+@brief Wraps a column-major matrix view so that reads synthesize the triangle
+which is not stored (see matrix_structure_t). The wrapper exposes the same
+pointer-based interface as the wrapped view, so it can be used as an operand of
+the Gemm kernels, which then only read the stored triangle. The structure is
+either symmetric or triangular: a general operand of the same Gemm is passed as
+a plain matrix view, so that only the structured operand pays for locating its
+elements.
+@tparam matrix_t Type of the wrapped matrix view.
+*/
+template <typename matrix_t>
+struct StructuredMatrixView;
+
+/*!
+@brief Wraps a column-major view of a matrix stored in the LAPACK band layout:
+the element (i, j) of the band is at row ku + i - j of column j of the storage,
+which has kl + ku + 1 rows. Reads outside of the band return zero, and the
+structure (see matrix_structure_t) gives the triangle which is not stored of
+symmetric and triangular band matrices.
+@tparam matrix_t Type of the wrapped view of the band storage.
+*/
+template <typename matrix_t>
+struct BandMatrixView;
+
+/*!
+@brief Wraps a view of one triangle of a square matrix of order n stored in
+the packed layout, i.e. column after column: the element (i, j) of the upper
+triangle (i <= j) is at offset i + j * (j + 1) / 2, and the element (i, j) of
+the lower triangle (i >= j) is at offset i + (2 * n - j - 1) * j / 2. The
+structure (see matrix_structure_t) gives the value of the triangle which is
+not stored.
+@tparam vector_t Type of the wrapped view of the packed storage.
+*/
+template <typename vector_t>
+struct PackedMatrixView;
+
+/*!
+@brief Returns j * (j + 1) / 2, the number of elements of a triangle of order
+j. The even factor is halved before the product, which thus only overflows
+when the result does, e.g. up to n = 65535 for the packed storage of a matrix
+of order n indexed with a 32 bit int.
+*/
+template <typename index_t>
+SYCL_BLAS_INLINE index_t triangular_number(index_t j) {
+  return (j & 1) ? j * ((j + 1) / 2) : (j / 2) * (j + 1);
+}
+
+/*!
+@brief Returns the offset of the element (i, j) of the stored triangle of a
+matrix of order n in the packed layout (see PackedMatrixView), without
+overflow when the packed storage fits in index_t.
+*/
+template <typename index_t>
+SYCL_BLAS_INLINE index_t get_packed_index(index_t i, index_t j, index_t n,
+                                          bool lower) {
+  // The columns before j of a lower triangle hold the triangle of order n
+  // minus the one of order n - j
+  return lower ? (i - j) + (triangular_number(n) - triangular_number(n - j))
+               : i + triangular_number(j);
+}
+
+/*!
+@brief Wraps the three arrays of a sparse matrix stored in the compressed
+sparse row (CSR) format: the nonzeros of row i are the elements row_ptr[i] to
+row_ptr[i + 1] - 1 of values, col_ind holding their columns. Both the row
+pointers and the column indices start at 0.
+@tparam index_vector_t Type of the views of row_ptr and col_ind.
+@tparam value_vector_t Type of the view of values.
+*/
+template <typename index_vector_t, typename value_vector_t>
+struct CsrMatrixView;
+
 template <typename policy_t, typename data_t, typename index_t,
           typename increment_t>
 struct VectorViewTypeFactory {
@@ -251,6 +335,101 @@ static inline
   return leaf_node_t{ex.get_policy_handler().get_buffer(buff), m, n, lda};
 }
 
+template <typename executor_t, typename container_t, typename index_t>
+static inline StructuredMatrixView<
+    typename MatrixViewTypeFactory<typename executor_t::policy_t, container_t,
+                                   index_t, col_major>::output_t>
+make_structured_matrix_view(executor_t &ex, container_t buff, index_t m,
+                            index_t n, index_t lda,
+                            matrix_structure_t structure, bool lower = false,
+                            bool unit = false) {
+  using matrix_t =
+      typename MatrixViewTypeFactory<typename executor_t::policy_t, container_t,
+                                     index_t, col_major>::output_t;
+  return StructuredMatrixView<matrix_t>{
+      make_matrix_view<col_major>(ex, buff, m, n, lda), structure, lower, unit};
+}
+
+/*!
+@brief Makes a view of a band matrix of m rows and n columns, with kl
+subdiagonals and ku superdiagonals stored in the LAPACK band layout, lda being
+the leading dimension of the storage (at least kl + ku + 1). For symmetric and
+triangular matrices, one of kl and ku is zero and lower gives the stored
+triangle.
+*/
+template <typename executor_t, typename container_t, typename index_t>
+static inline BandMatrixView<
+    typename MatrixViewTypeFactory<typename executor_t::policy_t, container_t,
+                                   index_t, col_major>::output_t>
+make_band_matrix_view(
+    executor_t &ex, container_t buff, index_t m, index_t n, index_t kl,
+    index_t ku, index_t lda,
+    matrix_structure_t structure = matrix_structure_t::general,
+    bool lower = false, bool unit = false) {
+  using matrix_t =
+      typename MatrixViewTypeFactory<typename executor_t::policy_t, container_t,
+                                     index_t, col_major>::output_t;
+  return BandMatrixView<matrix_t>{
+      make_matrix_view<col_major>(ex, buff, kl + ku + 1, n, lda),
+      m,
+      kl,
+      ku,
+      structure,
+      lower,
+      unit};
+}
+
+/*!
+@brief Makes a view of a symmetric or triangular matrix of order n, of which
+the triangle given by lower is stored in the packed layout, in the
+n * (n + 1) / 2 first elements of buff.
+*/
+template <typename executor_t, typename container_t, typename index_t>
+static inline PackedMatrixView<
+    typename VectorViewTypeFactory<typename executor_t::policy_t, container_t,
+                                   index_t, index_t>::output_t>
+make_packed_matrix_view(executor_t &ex, container_t buff, index_t n,
+                        matrix_structure_t structure, bool lower,
+                        bool unit = false) {
+  using vector_t =
+      typename VectorViewTypeFactory<typename executor_t::policy_t, container_t,
+                                     index_t, index_t>::output_t;
+  return PackedMatrixView<vector_t>{
+      make_vector_view(ex, buff, index_t(1), triangular_number(n)), n, structure,
+      lower, unit};
+}
+
+/*!
+@brief Makes a view of a sparse matrix of m rows and n columns with nnz
+nonzeros stored in the CSR format, row_ptr holding m + 1 elements and col_ind
+and values holding nnz elements.
+*/
+template <typename executor_t, typename index_container_t,
+          typename value_container_t, typename index_t>
+static inline CsrMatrixView<
+    typename VectorViewTypeFactory<typename executor_t::policy_t,
+                                   index_container_t, index_t,
+                                   index_t>::output_t,
+    typename VectorViewTypeFactory<typename executor_t::policy_t,
+                                   value_container_t, index_t,
+                                   index_t>::output_t>
+make_csr_matrix_view(executor_t &ex, index_container_t row_ptr,
+                     index_container_t col_ind, value_container_t values,
+                     index_t m, index_t n, index_t nnz) {
+  using index_vector_t =
+      typename VectorViewTypeFactory<typename executor_t::policy_t,
+                                     index_container_t, index_t,
+                                     index_t>::output_t;
+  using value_vector_t =
+      typename VectorViewTypeFactory<typename executor_t::policy_t,
+                                     value_container_t, index_t,
+                                     index_t>::output_t;
+  return CsrMatrixView<index_vector_t, value_vector_t>{
+      make_vector_view(ex, row_ptr, index_t(1), m + 1),
+      make_vector_view(ex, col_ind, index_t(1), nnz),
+      make_vector_view(ex, values, index_t(1), nnz), m, n, nnz};
+}
+
 }  // namespace blas
 
 #endif  // VIEW_H
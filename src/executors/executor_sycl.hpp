@@ -216,15 +216,16 @@ template <>
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 inline typename codeplay_policy::event_t
 Executor<PolicyHandler<codeplay_policy>>::execute(
     Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
-         TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm>
+         TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
+         input_b_t>
         gemm_tree) {
   using gemm_t = Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
                       tile_type, TransA, TransB, element_t, is_beta_zero,
-                      GemmMemoryType, GemmAlgorithm>;
+                      GemmMemoryType, GemmAlgorithm, input_b_t>;
   auto rng = gemm_t::get_nd_range(gemm_tree.m_, gemm_tree.n_,
                                   policy_handler_.get_num_compute_units());
   return {execute_tree<
@@ -234,6 +235,36 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
       rng.get_global_range()[0], gemm_t::local_memory_size)};
 }
 
+/* Block sparse Gemm, launched as its local memory Gemm */
+template <>
+template <typename gemm_t, typename mask_t>
+inline typename codeplay_policy::event_t
+Executor<PolicyHandler<codeplay_policy>>::execute(
+    GemmBlockSparse<gemm_t, mask_t> gemm_block_sparse) {
+  auto rng = gemm_t::get_nd_range(gemm_block_sparse.gemm_.m_,
+                                  gemm_block_sparse.gemm_.n_,
+                                  policy_handler_.get_num_compute_units());
+  return {execute_tree<using_local_memory::enabled>(
+      policy_handler_.get_queue(), gemm_block_sparse, rng.get_local_range()[0],
+      rng.get_global_range()[0], gemm_t::local_memory_size)};
+}
+
+/* Gemm with alpha and beta in device memory, launched as its Gemm */
+template <>
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+inline typename codeplay_policy::event_t
+Executor<PolicyHandler<codeplay_policy>>::execute(
+    GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t> gemm_scalars) {
+  auto rng =
+      gemm_t::get_nd_range(gemm_scalars.gemm_.m_, gemm_scalars.gemm_.n_,
+                           policy_handler_.get_num_compute_units());
+  return {execute_tree<
+      Choose<gemm_t::local_memory_size != 0, int, using_local_memory::enabled,
+             using_local_memory::disabled>::type>(
+      policy_handler_.get_queue(), gemm_scalars, rng.get_local_range()[0],
+      rng.get_global_range()[0], gemm_t::local_memory_size)};
+}
+
 /* Tall and skinny Gemm */
 template <>
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
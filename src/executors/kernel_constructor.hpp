@@ -25,6 +25,7 @@
 #ifndef SYCL_BLAS_KERNEL_CONSTRUCTOR_HPP
 #define SYCL_BLAS_KERNEL_CONSTRUCTOR_HPP
 #include "executors/kernel_constructor.h"
+#include "executors/kernel_tracer.h"
 #include <CL/sycl.hpp>
 #include <iostream>
 namespace blas {
@@ -186,7 +187,16 @@ static SYCL_BLAS_INLINE cl::sycl::event execute_tree(queue_t q_,
                                 decltype(scratch), value_t>(scratch, t));
     };
 
-    ev = q_.submit(cg1);
+    auto &tracer = KernelTracer::get();
+    if (tracer.is_enabled()) {
+      const auto submit_begin = KernelTracer::clock_t::now();
+      ev = q_.submit(cg1);
+      tracer.record<expression_tree_t, value_t>(
+          ev, localSize, globalSize, shMem, submit_begin,
+          KernelTracer::clock_t::now());
+    } else {
+      ev = q_.submit(cg1);
+    }
     return ev;
   } catch (cl::sycl::exception e) {
     std::cerr << e.what() << std::endl;
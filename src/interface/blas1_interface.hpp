@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "blas_meta.h"
+#include "container/sycl_future.h"
 #include "container/sycl_iterator.h"
 #include "executors/executor.h"
 #include "interface/blas1_interface.h"
@@ -67,6 +68,37 @@ typename executor_t::policy_t::event_t _axpy(
   return ret;
 }
 
+/**
+ * \brief AXPY with the scalar alpha in device memory.
+ *
+ * The ScalarOp node reads alpha through a vector view of size one, so the
+ * kernel depends on the operation producing alpha rather than the host.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha  BufferIterator
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy(
+    executor_t &ex, index_t _N,
+    BufferIterator<element_t, codeplay_policy> _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy) {
+  auto alpha = make_vector_view(ex, _alpha, static_cast<increment_t>(1),
+                                static_cast<index_t>(1));
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+
+  auto scalOp = make_op<ScalarOp, ProductOperator>(alpha, vx);
+  auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
 /**
  * \brief COPY copies a vector, x, to a vector, y.
  *
@@ -233,6 +265,28 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
   return ret;
 }
 
+/**
+ * \brief SCALAR operation on a vector, with the scalar alpha in device memory
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha  BufferIterator
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename element_t, typename container_0_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal(
+    executor_t &ex, index_t _N,
+    BufferIterator<element_t, codeplay_policy> _alpha, container_0_t _vx,
+    increment_t _incx) {
+  auto alpha = make_vector_view(ex, _alpha, static_cast<increment_t>(1),
+                                static_cast<index_t>(1));
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(alpha, vx);
+  auto assignOp = make_op<Assign>(vx, scalOp);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
 /**
  * \brief NRM2 Returns the euclidian norm of a vector
  * @param executor_t<ExecutorType> ex
@@ -310,12 +364,7 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
-  using element_t = typename ValueType<container_0_t>::type;
-  auto res = std::vector<element_t>(1);
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
-  blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
-  return res[0];
+  return internal::_dot_async(ex, _N, _vx, _incx, _vy, _incy).get();
 }
 
 /**
@@ -326,14 +375,7 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
-  using element_t = typename ValueType<container_t>::type;
-  using IndValTuple = IndexValueTuple<index_t, element_t>;
-  std::vector<IndValTuple> rsT(1, IndValTuple(index_t(-1), element_t(-1)));
-  auto gpu_res =
-      make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
-  blas::internal::_iamax(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, rsT.data(), 1);
-  return rsT[0].get_index();
+  return internal::_iamax_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -344,14 +386,7 @@ index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
-  using element_t = typename ValueType<container_t>::type;
-  using IndValTuple = IndexValueTuple<index_t, element_t>;
-  std::vector<IndValTuple> rsT(1, IndValTuple(index_t(-1), element_t(-1)));
-  auto gpu_res =
-      make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
-  blas::internal::_iamin(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, rsT.data(), 1);
-  return rsT[0].get_index();
+  return internal::_iamin_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -366,12 +401,7 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
-  using element_t = typename ValueType<container_t>::type;
-  auto res = std::vector<element_t>(1, element_t(0));
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
-  blas::internal::_asum(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
-  return res[0];
+  return internal::_asum_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -386,12 +416,109 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
+  return internal::_nrm2_async(ex, _N, _vx, _incx).get();
+}
+
+/**
+ * \brief Asynchronous DOT. The result is written to a pooled slot and copied
+ * to the host, the future waiting for the copy when its value is read.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vx  BufferIterator
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Future<typename ValueType<container_0_t>::type> _dot_async(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy) {
+  using element_t = typename ValueType<container_0_t>::type;
+  auto slot = ResultSlotPool<element_t>::acquire();
+  auto ret =
+      blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy, slot->device_);
+  auto event = ex.get_policy_handler().copy_to_host(
+      slot->device_, slot->get_host_pointer(), 1);
+  return Future<element_t>(concatenate_vectors(ret, event), slot);
+}
+
+/**
+ * \brief Asynchronous ICAMAX, see _dot_async
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<index_t, IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<index_t, element_t>;
+  auto slot = ResultSlotPool<IndValTuple>::acquire();
+  auto ret = blas::internal::_iamax(ex, _N, _vx, _incx, slot->device_);
+  auto event = ex.get_policy_handler().copy_to_host(
+      slot->device_, slot->get_host_pointer(), 1);
+  return Future<index_t, IndValTuple>(concatenate_vectors(ret, event), slot);
+}
+
+/**
+ * \brief Asynchronous ICAMIN, see _dot_async
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<index_t, IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<index_t, element_t>;
+  auto slot = ResultSlotPool<IndValTuple>::acquire();
+  auto ret = blas::internal::_iamin(ex, _N, _vx, _incx, slot->device_);
+  auto event = ex.get_policy_handler().copy_to_host(
+      slot->device_, slot->get_host_pointer(), 1);
+  return Future<index_t, IndValTuple>(concatenate_vectors(ret, event), slot);
+}
+
+/**
+ * \brief Asynchronous ASUM, see _dot_async
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<typename ValueType<container_t>::type> _asum_async(executor_t &ex,
+                                                          index_t _N,
+                                                          container_t _vx,
+                                                          increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  auto slot = ResultSlotPool<element_t>::acquire();
+  auto ret = blas::internal::_asum(ex, _N, _vx, _incx, slot->device_);
+  auto event = ex.get_policy_handler().copy_to_host(
+      slot->device_, slot->get_host_pointer(), 1);
+  return Future<element_t>(concatenate_vectors(ret, event), slot);
+}
+
+/**
+ * \brief Asynchronous NRM2, see _dot_async
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+Future<typename ValueType<container_t>::type> _nrm2_async(executor_t &ex,
+                                                          index_t _N,
+                                                          container_t _vx,
+                                                          increment_t _incx) {
   using element_t = typename ValueType<container_t>::type;
-  auto res = std::vector<element_t>(1, element_t(0));
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
-  blas::internal::_nrm2(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
-  return res[0];
+  auto slot = ResultSlotPool<element_t>::acquire();
+  auto ret = blas::internal::_nrm2(ex, _N, _vx, _incx, slot->device_);
+  auto event = ex.get_policy_handler().copy_to_host(
+      slot->device_, slot->get_host_pointer(), 1);
+  return Future<element_t>(concatenate_vectors(ret, event), slot);
 }
 
 }  // namespace internal
@@ -0,0 +1,55 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename backend.hpp
+ *
+ **************************************************************************/
+#ifdef RCAR
+#include "interface/blas2/backend/rcar.hpp"
+#elif INTEL_GPU
+#include "interface/blas2/backend/intel_gpu.hpp"
+#elif AMD_GPU
+#include "interface/blas2/backend/amd_gpu.hpp"
+#elif ARM_GPU
+#include "interface/blas2/backend/arm_gpu.hpp"
+#else
+#include "interface/blas2/backend/default_cpu.hpp"
+#endif
+
+namespace blas {
+namespace gemv {
+namespace backend {
+/*!
+ * @brief GEMV with the launch parameters of the backend of the target.
+ */
+template <transpose_type trn, typename executor_t, typename index_t,
+          typename element_t, typename container_0_t, typename container_1_t,
+          typename increment_t, typename container_2_t>
+typename executor_t::policy_t::event_t _gemv(
+    executor_t& ex, index_t _M, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    element_t _beta, container_2_t _vy, increment_t _incy) {
+  return _launch_gemv<GemvParams, trn>(ex, _M, _N, _alpha, _mA, _lda, _vx,
+                                       _incx, _beta, _vy, _incy);
+}
+}  // namespace backend
+}  // namespace gemv
+}  // namespace blas
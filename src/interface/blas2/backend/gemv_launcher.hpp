@@ -0,0 +1,100 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_launcher.hpp
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_GEMV_LAUNCHER_HPP
+#define SYCL_BLAS_GEMV_LAUNCHER_HPP
+#include "blas_meta.h"
+#include "interface/blas2_interface.h"
+
+namespace blas {
+namespace gemv {
+namespace backend {
+
+/*!
+ * @brief Launch parameters of _gemv_impl, the same on every device unless the
+ * backend of the target overrides them (see tools/auto_tuner).
+ *
+ * The single kernel needs enough rows to fill the device: a work group of rows
+ * per compute unit for the non transposed product, a row per work group for
+ * the transposed one. Matrices with fewer and longer rows split their columns
+ * between work groups instead, the partial sums being added by a second
+ * kernel.
+ */
+struct DefaultGemvParams {
+  // Work group size, and elements of local memory per work group, 0 for the
+  // work group size of the device
+  static constexpr int local_size = 0;
+  // Non transposed products with at most n_split_rows rows, a single work
+  // group of rows for work groups of 64 items or more, and at least
+  // n_split_min_cols columns
+  static constexpr int n_split_rows = 64;
+  static constexpr int n_split_min_cols = 4096;
+  // Columns per work group of the split non transposed products, so that each
+  // work item still adds up long dot products
+  static constexpr int n_split_cols = 1024;
+  // Transposed products with at most t_split_rows rows of A^T, which give
+  // fewer work groups than the compute units of most GPUs, and at least
+  // t_split_min_cols columns. They are split in blocks of t_split_cols columns
+  // of one row each.
+  static constexpr int t_split_rows = 64;
+  static constexpr int t_split_min_cols = 4096;
+  static constexpr int t_split_cols = 4096;
+};
+
+/*!
+ * @brief Launches _gemv_impl with the parameters of params_t for the shape
+ * of the product.
+ */
+template <typename params_t, transpose_type trn, typename executor_t,
+          typename index_t, typename element_t, typename container_0_t,
+          typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _launch_gemv(
+    executor_t& ex, index_t _M, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    element_t _beta, container_2_t _vy, increment_t _incy) {
+  const index_t local_size = params_t::local_size;
+  // Rows and columns of the product, of A or of A^T
+  const index_t rows = (trn == transpose_type::Normal) ? _M : _N;
+  const index_t cols = (trn == transpose_type::Normal) ? _N : _M;
+  index_t n_rows_wg = 0;
+  index_t n_cols_wg = 0;
+  if (trn == transpose_type::Normal) {
+    if (rows <= params_t::n_split_rows && cols >= params_t::n_split_min_cols) {
+      n_cols_wg = params_t::n_split_cols;
+    }
+  } else if (rows <= params_t::t_split_rows &&
+             cols >= params_t::t_split_min_cols) {
+    n_rows_wg = 1;
+    n_cols_wg = params_t::t_split_cols;
+  }
+  return blas::internal::_gemv_impl<trn>(
+      ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy, _incy,
+      local_size, local_size, n_rows_wg, n_cols_wg);
+}
+
+}  // namespace backend
+}  // namespace gemv
+}  // namespace blas
+#endif
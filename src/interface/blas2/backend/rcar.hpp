@@ -0,0 +1,39 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename rcar.hpp
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_GEMV_RCAR_BACKEND_HPP
+#define SYCL_BLAS_GEMV_RCAR_BACKEND_HPP
+#include "interface/blas2/backend/gemv_launcher.hpp"
+
+namespace blas {
+namespace gemv {
+namespace backend {
+struct GemvParams : DefaultGemvParams {
+  // The work group size of all the GEMM configurations of this backend
+  static constexpr int local_size = 32;
+};
+}  // namespace backend
+}  // namespace gemv
+}  // namespace blas
+#endif
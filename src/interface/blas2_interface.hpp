@@ -29,6 +29,7 @@
 #include "blas_meta.h"
 #include "container/sycl_iterator.h"
 #include "executors/executor.h"
+#include "interface/blas2/backend/backend.hpp"
 #include "interface/blas2_interface.h"
 #include "operations/blas2_trees.h"
 #include "operations/blas_constants.h"
@@ -41,35 +42,24 @@
 namespace blas {
 namespace internal {
 
-/*! _gemv.
- * @brief Implementation of the General Matrix Vector product.
- *
+/*! _gemv_multi_kernel.
+ * @brief Second part of _gemv_impl, when a work group does not cover all the
+ * columns of its rows: the partial products go to a scratch matrix, reduced
+ * and combined with alpha and beta by a second kernel. The scalars are either
+ * host values or views of a scalar in device memory, read by that kernel.
  */
-template <transpose_type trn, typename Executor, typename index_t,
-          typename element_t, typename container_t0, typename container_t1,
-          typename increment_t, typename container_t2>
-typename Executor::policy_t::event_t _gemv_impl(
-    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
-    index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
-    container_t2 _vy, increment_t _incy, index_t _localSize = 0,
-    index_t _scratchPadSize = 0, index_t _nRowsWG = 0, index_t _nColsWG = 0) {
+template <typename data_layout_t, typename Executor, typename index_t,
+          typename alpha_t, typename matrix_t, typename vector_x_t,
+          typename beta_t, typename vector_y_t>
+typename Executor::policy_t::event_t _gemv_multi_kernel(
+    Executor& ex, index_t M, index_t N, alpha_t _alpha, matrix_t mA,
+    vector_x_t vx, beta_t _beta, vector_y_t vy, index_t localSize,
+    index_t _localSize, index_t _scratchPadSize, index_t _nRowsWG,
+    index_t _nColsWG) {
+  using element_t = typename vector_y_t::value_t;
   typename Executor::policy_t::event_t ret{};
-
-  index_t M = (trn == transpose_type::Normal) ? _M : _N;
-  index_t N = (trn == transpose_type::Normal) ? _N : _M;
-
-  static constexpr auto data_layout_access =
-      Choose<trn == transpose_type::Normal, access_layout,
-             access_layout::col_major, access_layout::row_major>::type;
-  using data_layout_t = typename Layout<data_layout_access>::type;
-  auto mA = make_matrix_view<data_layout_t>(ex, _mA, M, N, _lda);
-  auto vx = make_vector_view(ex, _vx, _incx, N);
-  auto vy = make_vector_view(ex, _vy, _incy, M);
-
   const index_t interLoop = 1;
-  const index_t localSize = (_localSize == 0)
-                                ? ex.get_policy_handler().get_work_group_size()
-                                : _localSize;
+
   const index_t nRowsWG =
       (_nRowsWG == 0) ? ((data_layout_t::is_col_major()) ? localSize : 1)
                       : std::min(M, _nRowsWG);
@@ -119,6 +109,215 @@ typename Executor::policy_t::event_t _gemv_impl(
   return ret;
 }
 
+/*! _gemv.
+ * @brief Implementation of the General Matrix Vector product.
+ *
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gemv_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
+    container_t2 _vy, increment_t _incy, index_t _localSize,
+    index_t _scratchPadSize, index_t _nRowsWG, index_t _nColsWG) {
+  typename Executor::policy_t::event_t ret{};
+
+  index_t M = (trn == transpose_type::Normal) ? _M : _N;
+  index_t N = (trn == transpose_type::Normal) ? _N : _M;
+
+  static constexpr auto data_layout_access =
+      Choose<trn == transpose_type::Normal, access_layout,
+             access_layout::col_major, access_layout::row_major>::type;
+  using data_layout_t = typename Layout<data_layout_access>::type;
+  auto mA = make_matrix_view<data_layout_t>(ex, _mA, M, N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, N);
+  auto vy = make_vector_view(ex, _vy, _incy, M);
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+
+  // When one work group covers all the columns of its rows, a single kernel
+  // applies alpha and beta itself, without the scratch matrix and the
+  // AddSetColumns pass. This is always the case of the default transposed
+  // configuration; the non transposed one needs enough rows to fill the
+  // device on its own.
+  const index_t nWGSingle =
+      (data_layout_t::is_col_major()) ? (M - 1) / localSize + 1 : M;
+  if (_nRowsWG == 0 && _nColsWG == 0 &&
+      (!data_layout_t::is_col_major() ||
+       nWGSingle >= static_cast<index_t>(
+                        ex.get_policy_handler().get_num_compute_units()))) {
+    auto gemv = make_gemv(vy, mA, vx, _alpha, _beta, nWGSingle);
+    ret = concatenate_vectors(
+        ret, ex.execute(gemv, localSize, localSize * nWGSingle, localSize));
+    return ret;
+  }
+
+  return concatenate_vectors(
+      ret, _gemv_multi_kernel<data_layout_t>(
+               ex, M, N, _alpha, mA, vx, _beta, vy, localSize, _localSize,
+               _scratchPadSize, _nRowsWG, _nColsWG));
+}
+
+/*! _gemv.
+ * @brief Implementation of the General Matrix Vector product with alpha and
+ * beta in device memory. The single kernel Gemv takes its scalars by value,
+ * so the product always goes through the scratch matrix, and the kernel
+ * applying alpha and beta reads them.
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gemv_impl(
+    Executor& ex, index_t _M, index_t _N,
+    BufferIterator<element_t, codeplay_policy> _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx,
+    BufferIterator<element_t, codeplay_policy> _beta, container_t2 _vy,
+    increment_t _incy, index_t _localSize, index_t _scratchPadSize,
+    index_t _nRowsWG, index_t _nColsWG) {
+  index_t M = (trn == transpose_type::Normal) ? _M : _N;
+  index_t N = (trn == transpose_type::Normal) ? _N : _M;
+
+  static constexpr auto data_layout_access =
+      Choose<trn == transpose_type::Normal, access_layout,
+             access_layout::col_major, access_layout::row_major>::type;
+  using data_layout_t = typename Layout<data_layout_access>::type;
+  auto mA = make_matrix_view<data_layout_t>(ex, _mA, M, N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, N);
+  auto vy = make_vector_view(ex, _vy, _incy, M);
+  auto alpha = make_vector_view(ex, _alpha, static_cast<increment_t>(1),
+                                static_cast<index_t>(1));
+  auto beta = make_vector_view(ex, _beta, static_cast<increment_t>(1),
+                               static_cast<index_t>(1));
+
+  const index_t localSize = (_localSize == 0)
+                                ? ex.get_policy_handler().get_work_group_size()
+                                : _localSize;
+  return _gemv_multi_kernel<data_layout_t>(ex, M, N, alpha, mA, vx, beta, vy,
+                                           localSize, _localSize,
+                                           _scratchPadSize, _nRowsWG, _nColsWG);
+}
+
+/*! _gemv_batched.
+ * @brief Implementation of a batch of General Matrix Vector products, all
+ * computed by a single kernel.
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gemv_batched_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, index_t _stridea, container_t1 _vx, increment_t _incx,
+    index_t _stridex, element_t _beta, container_t2 _vy, increment_t _incy,
+    index_t _stridey, index_t _batch_size, index_t _localSize = 0) {
+  typename Executor::policy_t::event_t ret{};
+
+  index_t M = (trn == transpose_type::Normal) ? _M : _N;
+  index_t N = (trn == transpose_type::Normal) ? _N : _M;
+  if (M == 0 || _batch_size == 0) {
+    return ret;
+  }
+
+  static constexpr auto data_layout_access =
+      Choose<trn == transpose_type::Normal, access_layout,
+             access_layout::col_major, access_layout::row_major>::type;
+  using data_layout_t = typename Layout<data_layout_access>::type;
+  auto mA = make_matrix_view<data_layout_t>(ex, _mA, M, N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, N);
+  auto vy = make_vector_view(ex, _vy, _incy, M);
+
+  // Small products do not fill a whole work group: use the smallest power of
+  // two covering the rows (or the columns of the transposed product)
+  index_t localSize = _localSize;
+  if (localSize == 0) {
+    const index_t maxLocalSize = ex.get_policy_handler().get_work_group_size();
+    const index_t dim = (data_layout_t::is_col_major()) ? M : N;
+    localSize = 1;
+    while (localSize < dim && localSize < maxLocalSize) {
+      localSize <<= 1;
+    }
+  }
+  const index_t nWGBatch =
+      (data_layout_t::is_col_major()) ? (M - 1) / localSize + 1 : M;
+  const index_t globalSize = localSize * nWGBatch * _batch_size;
+
+  auto gemv = make_gemv(vy, mA, vx, _alpha, _beta, nWGBatch, _stridea,
+                        _stridex, _stridey);
+  ret = concatenate_vectors(
+      ret, ex.execute(gemv, localSize, globalSize, localSize));
+  return ret;
+}
+
+/*! _gemv_dual.
+ * @brief Implementation of the fused pair of matrix vector products
+ * y = alpha*A*x + beta*y and z = alpha*A^T*w + beta*z.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_dual_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, container_t1 _vw,
+    increment_t _incw, element_t _beta, container_t2 _vy, increment_t _incy,
+    container_t2 _vz, increment_t _incz, index_t _localSize = 0,
+    index_t _tileSize = 0) {
+  typename Executor::policy_t::event_t ret;
+  index_t M = _M;
+  index_t N = _N;
+  if (M == 0 || N == 0) {
+    return ret;
+  }
+  auto mA = make_matrix_view<col_major>(ex, _mA, M, N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, N);
+  auto vw = make_vector_view(ex, _vw, _incw, M);
+  auto vy = make_vector_view(ex, _vy, _incy, M);
+  auto vz = make_vector_view(ex, _vz, _incz, N);
+
+  // A is read once, by tiles of tileSize x tileSize
+  const index_t tileSize = (_tileSize == 0) ? 32 : _tileSize;
+  // Each work item computes one row of A * x or one column of A^T * w of the
+  // tile, so a larger work group would leave most of its items idle
+  const index_t localSize =
+      (_localSize == 0)
+          ? std::min(static_cast<index_t>(
+                         ex.get_policy_handler().get_work_group_size()),
+                     2 * tileSize)
+          : _localSize;
+  const index_t nTilesPerCol = (M - 1) / tileSize + 1;
+  const index_t nTilesPerRow = (N - 1) / tileSize + 1;
+  const index_t globalSize = localSize * nTilesPerCol * nTilesPerRow;
+  const index_t localMemSize = tileSize * (tileSize + 1) + 2 * tileSize;
+
+  // Column j of each scratch matrix receives the contributions of the tiles
+  // of the block column (or block row) j
+  auto valY = blas::make_sycl_iterator_buffer<element_t>(M * nTilesPerRow);
+  auto matY =
+      make_matrix_view<row_major>(ex, valY, M, nTilesPerRow, nTilesPerRow);
+  auto valZ = blas::make_sycl_iterator_buffer<element_t>(N * nTilesPerCol);
+  auto matZ =
+      make_matrix_view<row_major>(ex, valZ, N, nTilesPerCol, nTilesPerCol);
+  auto gemvDual = make_gemv_dual(matY, matZ, mA, vx, vw, tileSize);
+  ret = concatenate_vectors(
+      ret, ex.execute(gemvDual, localSize, globalSize, localMemSize));
+
+  auto scalOpY = make_op<ScalarOp, ProductOperator>(_beta, vy);
+  auto addMOpY = make_addSetColumns(matY);
+  auto scalOpAY = make_op<ScalarOp, ProductOperator>(_alpha, addMOpY);
+  auto addOpY = make_op<BinaryOp, AddOperator>(scalOpY, scalOpAY);
+  auto assignOpY = make_op<Assign>(vy, addOpY);
+  ret = concatenate_vectors(ret, ex.execute(assignOpY, localSize));
+
+  auto scalOpZ = make_op<ScalarOp, ProductOperator>(_beta, vz);
+  auto addMOpZ = make_addSetColumns(matZ);
+  auto scalOpAZ = make_op<ScalarOp, ProductOperator>(_alpha, addMOpZ);
+  auto addOpZ = make_op<BinaryOp, AddOperator>(scalOpZ, scalOpAZ);
+  auto assignOpZ = make_op<Assign>(vz, addOpZ);
+  ret = concatenate_vectors(ret, ex.execute(assignOpZ, localSize));
+  return ret;
+}
+
 /*! _TRMV.
  * @brief Implementation of the Triangular Matrix Vector product.
  */
@@ -166,8 +365,10 @@ typename Executor::policy_t::event_t _trmv_impl(
       (data_layout_t::is_col_major())
           ? nWGPerCol
           : (((scratchPadSize == 0) ? std::min(N, localSize) : 1) * nWGPerCol);
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
 
+  // Only the work groups of the blocks which intersect the triangle are
+  // launched, the first block of each band writing the zero partial results
+  // of the others in the scratch matrix
   using element_t = typename ValueType<container_t0>::type;
   auto valT1 = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize);
   auto mat1 =
@@ -179,24 +380,32 @@ typename Executor::policy_t::event_t _trmv_impl(
         auto gemvC = make_Gemv_Col<false, true, true, true>(
             mat1, mA, vx, nWGPerRow, nWGPerCol, scratchPadSize);
         ret = concatenate_vectors(
-            ret, ex.execute(gemvC, localSize, globalSize, scratchPadSize));
+            ret, ex.execute(gemvC, localSize,
+                            localSize * gemvC.get_num_groups(localSize),
+                            scratchPadSize));
       } else {
         auto gemvC = make_Gemv_Col<false, true, true>(
             mat1, mA, vx, nWGPerRow, nWGPerCol, scratchPadSize);
         ret = concatenate_vectors(
-            ret, ex.execute(gemvC, localSize, globalSize, scratchPadSize));
+            ret, ex.execute(gemvC, localSize,
+                            localSize * gemvC.get_num_groups(localSize),
+                            scratchPadSize));
       }
     } else {
       if (unitDiag == 1) {
         auto gemvC = make_Gemv_Col<true, true, false, true>(
             mat1, mA, vx, nWGPerRow, nWGPerCol, scratchPadSize);
         ret = concatenate_vectors(
-            ret, ex.execute(gemvC, localSize, globalSize, scratchPadSize));
+            ret, ex.execute(gemvC, localSize,
+                            localSize * gemvC.get_num_groups(localSize),
+                            scratchPadSize));
       } else {
         auto gemvC = make_Gemv_Col<true, true, false>(
             mat1, mA, vx, nWGPerRow, nWGPerCol, scratchPadSize);
         ret = concatenate_vectors(
-            ret, ex.execute(gemvC, localSize, globalSize, scratchPadSize));
+            ret, ex.execute(gemvC, localSize,
+                            localSize * gemvC.get_num_groups(localSize),
+                            scratchPadSize));
       }
     }
   } else {  // row_major
@@ -205,24 +414,32 @@ typename Executor::policy_t::event_t _trmv_impl(
         auto gemvR = make_Gemv_Row<interLoop, false, true, true, true>(
             mat1, mA, vx, nWGPerRow, nWGPerCol, scratchPadSize);
         ret = concatenate_vectors(
-            ret, ex.execute(gemvR, localSize, globalSize, scratchPadSize));
+            ret, ex.execute(gemvR, localSize,
+                            localSize * gemvR.get_num_groups(localSize),
+                            scratchPadSize));
       } else {
         auto gemvR = make_Gemv_Row<interLoop, false, true, true>(
             mat1, mA, vx, nWGPerRow, nWGPerCol, scratchPadSize);
         ret = concatenate_vectors(
-            ret, ex.execute(gemvR, localSize, globalSize, scratchPadSize));
+            ret, ex.execute(gemvR, localSize,
+                            localSize * gemvR.get_num_groups(localSize),
+                            scratchPadSize));
       }
     } else {
       if (unitDiag == 1) {
         auto gemvR = make_Gemv_Row<interLoop, true, true, false, true>(
             mat1, mA, vx, nWGPerRow, nWGPerCol, scratchPadSize);
         ret = concatenate_vectors(
-            ret, ex.execute(gemvR, localSize, globalSize, scratchPadSize));
+            ret, ex.execute(gemvR, localSize,
+                            localSize * gemvR.get_num_groups(localSize),
+                            scratchPadSize));
       } else {
         auto gemvR = make_Gemv_Row<interLoop, true, true, false>(
             mat1, mA, vx, nWGPerRow, nWGPerCol, scratchPadSize);
         ret = concatenate_vectors(
-            ret, ex.execute(gemvR, localSize, globalSize, scratchPadSize));
+            ret, ex.execute(gemvR, localSize,
+                            localSize * gemvR.get_num_groups(localSize),
+                            scratchPadSize));
       }
     }
   }
@@ -254,78 +471,50 @@ typename Executor::policy_t::event_t _symv_impl(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
     container_t2 _vy, increment_t _incy, index_t _localSize = 0,
-    index_t _scratchPadSize = 0, index_t _nRowsWG = 0, index_t _nColsWG = 0) {
+    index_t _tileSize = 0) {
   _Uplo = tolower(_Uplo);
   typename Executor::policy_t::event_t ret;
   if ((_Uplo != 'u') && (_Uplo != 'l')) {
     throw std::invalid_argument("Erroneous parameter");
   }
-  int triangOpr = (_Uplo == 'u');
   index_t N = _N;
-  auto mA = make_matrix_view<col_major>(ex, _mA, N, N, _lda);
+  if (N == 0) {
+    return ret;
+  }
   auto vx = make_vector_view(ex, _vx, _incx, N);
   auto vy = make_vector_view(ex, _vy, _incy, N);
-  auto mAT = make_matrix_view<row_major>(ex, _mA, N, N, _lda);
-
-  const index_t interLoop = 1;
 
   const index_t localSize = (_localSize == 0)
                                 ? ex.get_policy_handler().get_work_group_size()
                                 : _localSize;
-  const index_t scratchPadSize =
-      (_localSize == 0) ? localSize : _scratchPadSize;
-
-  const index_t nRowsWG_R = (_nRowsWG == 0) ? 1 : std::min(N, _nRowsWG);
-  const index_t nColsWG_R = (_nColsWG == 0) ? N : std::min(N, _nColsWG);
-
-  const index_t nWGPerRow_R = (N - 1) / nRowsWG_R + 1;
-  const index_t nWGPerCol_R = (N - 1) / nColsWG_R + 1;
-  const index_t globalSize_R = localSize * nWGPerRow_R * nWGPerCol_R;
-
-  const index_t nRowsWG_C = (_nRowsWG == 0) ? localSize : _nRowsWG;
-  const index_t nColsWG_C = (_nColsWG == 0) ? localSize : _nColsWG;
-
-  const index_t nWGPerRow_C = (N - 1) / nRowsWG_C + 1;
-  const index_t nWGPerCol_C = (N - 1) / nColsWG_C + 1;
-  const index_t globalSize_C = localSize * nWGPerRow_C * nWGPerCol_C;
+  // The stored triangle is read once, by tiles of tileSize x tileSize
+  const index_t tileSize = (_tileSize == 0) ? 32 : _tileSize;
+  const index_t nTilesPerRow = (N - 1) / tileSize + 1;
+  const index_t nTiles = nTilesPerRow * (nTilesPerRow + 1) / 2;
+  const index_t globalSize = localSize * nTiles;
+  const index_t localMemSize = tileSize * (tileSize + 1) + 2 * tileSize;
 
-  const index_t scratchSize_R =
-      ((scratchPadSize == 0) ? std::min(N, localSize) : 1) * nWGPerCol_R;
+  // Column j of the scratch matrix receives the contributions of the tiles of
+  // the block column (or block row) j
+  auto valT = blas::make_sycl_iterator_buffer<element_t>(N * nTilesPerRow);
+  auto matT =
+      make_matrix_view<row_major>(ex, valT, N, nTilesPerRow, nTilesPerRow);
 
-  auto valTR = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_R);
-  auto matR =
-      make_matrix_view<row_major>(ex, valTR, N, scratchSize_R, scratchSize_R);
-
-  const index_t scratchSize_C = nWGPerCol_C;
-
-  auto valTC = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_C);
-  auto matC =
-      make_matrix_view<row_major>(ex, valTC, N, scratchSize_C, scratchSize_C);
-
-  if (triangOpr == 1) {
-    auto gemvC = make_Gemv_Col<false, true, true>(matC, mA, vx, nWGPerRow_C,
-                                                  nWGPerCol_C, scratchPadSize);
-    auto gemvR = make_Gemv_Row<interLoop, true, false, false>(
-        matR, mAT, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
+  // The upper triangle of A is the lower triangle of its row major view
+  if (_Uplo == 'l') {
+    auto mA = make_matrix_view<col_major>(ex, _mA, N, N, _lda);
+    auto symv = make_symv(matT, mA, vx, tileSize);
     ret = concatenate_vectors(
-        ret, ex.execute(gemvC, localSize, globalSize_C, scratchPadSize));
-    ret = concatenate_vectors(
-        ret, ex.execute(gemvR, localSize, globalSize_R, scratchPadSize));
+        ret, ex.execute(symv, localSize, globalSize, localMemSize));
   } else {
-    auto gemvC = make_Gemv_Col<true, true, false>(matC, mA, vx, nWGPerRow_C,
-                                                  nWGPerCol_C, scratchPadSize);
-    auto gemvR = make_Gemv_Row<interLoop, false, false, true>(
-        matR, mAT, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
-    ret = concatenate_vectors(
-        ret, ex.execute(gemvC, localSize, globalSize_C, scratchPadSize));
+    auto mAT = make_matrix_view<row_major>(ex, _mA, N, N, _lda);
+    auto symv = make_symv(matT, mAT, vx, tileSize);
     ret = concatenate_vectors(
-        ret, ex.execute(gemvR, localSize, globalSize_R, scratchPadSize));
+        ret, ex.execute(symv, localSize, globalSize, localMemSize));
   }
 
   auto scalOp1 = make_op<ScalarOp, ProductOperator>(_beta, vy);
-  auto addMOpR = make_addSetColumns(matR);
-  auto addMOpC = make_addSetColumns(matC);
-  auto addMOp = make_op<BinaryOp, AddOperator>(addMOpR, addMOpC);
+  auto addMOp = make_addSetColumns(matT);
   auto scalOp2 = make_op<ScalarOp, ProductOperator>(_alpha, addMOp);
   auto addOp = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
   auto assignOp = make_op<Assign>(vy, addOp);
@@ -405,17 +594,20 @@ typename Executor::policy_t::event_t _syr_impl(
 
   const index_t nWGPerRow = (N - 1) / nRowsWG + 1;
   const index_t nWGPerCol = (N - 1) / nColsWG + 1;
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
 
+  // Only the work groups of the blocks which intersect the triangle are
+  // launched
   if (triangOpr) {
     auto assignOp = make_Ger_Col<true, false, true, true>(
         mA, _alpha, vx, vx, nWGPerRow, nWGPerCol, scratchPadSize);
+    const index_t globalSize = localSize * assignOp.get_num_groups(localSize);
     return ret = concatenate_vectors(
                ret,
                ex.execute(assignOp, localSize, globalSize, scratchPadSize));
   } else {
     auto assignOp = make_Ger_Col<true, true, true, false>(
         mA, _alpha, vx, vx, nWGPerRow, nWGPerCol, scratchPadSize);
+    const index_t globalSize = localSize * assignOp.get_num_groups(localSize);
     return ret = concatenate_vectors(
                ret,
                ex.execute(assignOp, localSize, globalSize, scratchPadSize));
@@ -460,19 +652,329 @@ typename Executor::policy_t::event_t _syr2_impl(
 
   const index_t nWGPerRow = (N - 1) / nRowsWG + 1;
   const index_t nWGPerCol = (N - 1) / nColsWG + 1;
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
 
+  // Only the work groups of the blocks which intersect the triangle are
+  // launched
   if (triangOpr) {
     auto assignOp = make_Ger_Col<false, false, true, true>(
         mA, _alpha, vx, vy, nWGPerRow, nWGPerCol, scratchPadSize);
+    const index_t globalSize = localSize * assignOp.get_num_groups(localSize);
     return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
   } else {
     auto assignOp = make_Ger_Col<false, true, true, false>(
         mA, _alpha, vx, vy, nWGPerRow, nWGPerCol, scratchPadSize);
+    const index_t globalSize = localSize * assignOp.get_num_groups(localSize);
     return ex.execute(assignOp, localSize, globalSize, scratchPadSize);
   }
 }
 
+/*!
+ * @brief Launches the band matrix vector product, one work item per element of
+ * the output vector, each reading only the band of its row of op(A).
+ */
+template <transpose_type trn, typename Executor, typename lhs_t,
+          typename matrix_t, typename vector_t, typename element_t>
+typename Executor::policy_t::event_t _band_mv_impl(Executor& ex, lhs_t vy,
+                                                   matrix_t mA, vector_t vx,
+                                                   element_t _alpha,
+                                                   element_t _beta) {
+  auto gbmv = make_gbmv<trn != transpose_type::Normal>(vy, mA, vx, _alpha,
+                                                       _beta);
+  return ex.execute(gbmv);
+}
+
+/*
+    sgbmv 	( 	character  	TRANS,
+                integer  	M,
+                integer  	N,
+                integer  	KL,
+                integer  	KU,
+                real  	ALPHA,
+                real, dimension(lda,*)  	A,
+                integer  	LDA,
+                real, dimension(*)  	X,
+                integer  	INCX,
+                real  	BETA,
+                real, dimension(*)  	Y,
+                integer  	INCY
+        )
+*/
+template <transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gbmv_impl(
+    Executor& ex, index_t _M, index_t _N, index_t _KL, index_t _KU,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _vx,
+    increment_t _incx, element_t _beta, container_t2 _vy, increment_t _incy) {
+  static constexpr bool trans = trn != transpose_type::Normal;
+  const index_t x_size = trans ? _M : _N;
+  const index_t y_size = trans ? _N : _M;
+
+  auto mA = make_band_matrix_view(ex, _mA, _M, _N, _KL, _KU, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, x_size);
+  auto vy = make_vector_view(ex, _vy, _incy, y_size);
+  return _band_mv_impl<trn>(ex, vy, mA, vx, _alpha, _beta);
+}
+
+/*
+    ssbmv 	( 	character  	UPLO,
+                integer  	N,
+                integer  	K,
+                real  	ALPHA,
+                real, dimension(lda,*)  	A,
+                integer  	LDA,
+                real, dimension(*)  	X,
+                integer  	INCX,
+                real  	BETA,
+                real, dimension(*)  	Y,
+                integer  	INCY
+        )
+*/
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _sbmv_impl(
+    Executor& ex, char _Uplo, index_t _N, index_t _K, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    element_t _beta, container_t2 _vy, increment_t _incy) {
+  const bool lower = (_Uplo == 'l');
+  auto mA = make_band_matrix_view(ex, _mA, _N, _N, lower ? _K : index_t(0),
+                                  lower ? index_t(0) : _K, _lda,
+                                  matrix_structure_t::symmetric, lower);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  return _band_mv_impl<transpose_type::Normal>(ex, vy, mA, vx, _alpha, _beta);
+}
+
+/*
+    stbmv 	( 	character  	UPLO,
+                character  	TRANS,
+                character  	DIAG,
+                integer  	N,
+                integer  	K,
+                real, dimension(lda,*)  	A,
+                integer  	LDA,
+                real, dimension(*)  	X,
+                integer  	INCX
+        )
+*/
+template <transpose_type trn, typename Executor, typename index_t,
+          typename container_t0, typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _tbmv_impl(
+    Executor& ex, char _Uplo, char _Diag, index_t _N, index_t _K,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  typename Executor::policy_t::event_t ret;
+  using element_t = typename ValueType<container_t1>::type;
+  const bool lower = (_Uplo == 'l');
+  const bool unit = (_Diag == 'u');
+
+  auto mA = make_band_matrix_view(ex, _mA, _N, _N, lower ? _K : index_t(0),
+                                  lower ? index_t(0) : _K, _lda,
+                                  matrix_structure_t::triangular, lower, unit);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+
+  // x is both the input and the output, so the product reads a copy of it
+  auto valT = blas::make_sycl_iterator_buffer<element_t>(_N);
+  auto vt = make_vector_view(ex, valT, increment_t(1), _N);
+  auto copyOp = make_op<Assign>(vt, vx);
+  ret = concatenate_vectors(ret, ex.execute(copyOp));
+  return concatenate_vectors(
+      ret, _band_mv_impl<trn>(ex, vx, mA, vt, element_t(1), element_t(0)));
+}
+
+/*
+    sspmv 	( 	character  	UPLO,
+                integer  	N,
+                real  	ALPHA,
+                real, dimension(*)  	AP,
+                real, dimension(*)  	X,
+                integer  	INCX,
+                real  	BETA,
+                real, dimension(*)  	Y,
+                integer  	INCY
+        )
+*/
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _spmv_impl(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mAP,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy) {
+  auto mA = make_packed_matrix_view(ex, _mAP, _N, matrix_structure_t::symmetric,
+                                    _Uplo == 'l');
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  return _band_mv_impl<transpose_type::Normal>(ex, vy, mA, vx, _alpha, _beta);
+}
+
+/*
+    stpmv 	( 	character  	UPLO,
+                character  	TRANS,
+                character  	DIAG,
+                integer  	N,
+                real, dimension(*)  	AP,
+                real, dimension(*)  	X,
+                integer  	INCX
+        )
+*/
+template <transpose_type trn, typename Executor, typename index_t,
+          typename container_t0, typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _tpmv_impl(Executor& ex, char _Uplo,
+                                                char _Diag, index_t _N,
+                                                container_t0 _mAP,
+                                                container_t1 _vx,
+                                                increment_t _incx) {
+  typename Executor::policy_t::event_t ret;
+  using element_t = typename ValueType<container_t1>::type;
+
+  auto mA =
+      make_packed_matrix_view(ex, _mAP, _N, matrix_structure_t::triangular,
+                              _Uplo == 'l', _Diag == 'u');
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+
+  // x is both the input and the output, so the product reads a copy of it
+  auto valT = blas::make_sycl_iterator_buffer<element_t>(_N);
+  auto vt = make_vector_view(ex, valT, increment_t(1), _N);
+  auto copyOp = make_op<Assign>(vt, vx);
+  ret = concatenate_vectors(ret, ex.execute(copyOp));
+  return concatenate_vectors(
+      ret, _band_mv_impl<trn>(ex, vx, mA, vt, element_t(1), element_t(0)));
+}
+
+/*
+    sspr 	( 	character  	UPLO,
+                integer  	N,
+                real  	ALPHA,
+                real, dimension(*)  	X,
+                integer  	INCX,
+                real, dimension(*)  	AP
+        )
+*/
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename increment_t, typename container_t1>
+typename Executor::policy_t::event_t _spr_impl(Executor& ex, char _Uplo,
+                                               index_t _N, element_t _alpha,
+                                               container_t0 _vx,
+                                               increment_t _incx,
+                                               container_t1 _mAP) {
+  auto mA = make_packed_matrix_view(ex, _mAP, _N, matrix_structure_t::symmetric,
+                                    _Uplo == 'l');
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto sprOp = make_spr<true>(mA, _alpha, vx, vx);
+  return ex.execute(sprOp);
+}
+
+/*
+    sspr2 	( 	character  	UPLO,
+                integer  	N,
+                real  	ALPHA,
+                real, dimension(*)  	X,
+                integer  	INCX,
+                real, dimension(*)  	Y,
+                integer  	INCY,
+                real, dimension(*)  	AP
+        )
+*/
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename increment_t, typename container_t1,
+          typename container_t2>
+typename Executor::policy_t::event_t _spr2_impl(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _vx,
+    increment_t _incx, container_t1 _vy, increment_t _incy,
+    container_t2 _mAP) {
+  auto mA = make_packed_matrix_view(ex, _mAP, _N, matrix_structure_t::symmetric,
+                                    _Uplo == 'l');
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto spr2Op = make_spr<false>(mA, _alpha, vx, vy);
+  return ex.execute(spr2Op);
+}
+
+/*!
+ * @brief CSR sparse matrix vector product, see csrmv_algorithm_t.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename container_t2,
+          typename increment_t, typename container_t3>
+typename Executor::policy_t::event_t _csrmv_impl(
+    Executor& ex, index_t _M, index_t _N, index_t _nnz, element_t _alpha,
+    container_t0 _row_ptr, container_t0 _col_ind, container_t1 _values,
+    container_t2 _vx, increment_t _incx, element_t _beta, container_t3 _vy,
+    increment_t _incy, csrmv_algorithm_t _algorithm) {
+  typename Executor::policy_t::event_t ret;
+  auto mA =
+      make_csr_matrix_view(ex, _row_ptr, _col_ind, _values, _M, _N, _nnz);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _M);
+
+  if (_algorithm == csrmv_algorithm_t::scalar_per_row) {
+    // The product is fused with the scaling and the addition of y
+    auto csrmvOp = make_csrmv(mA, vx);
+    auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, csrmvOp);
+    if (_beta == element_t(0)) {
+      auto assignOp = make_op<Assign>(vy, scalOp);
+      return ex.execute(assignOp);
+    }
+    auto scalYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
+    auto addOp = make_op<BinaryOp, AddOperator>(scalOp, scalYOp);
+    auto assignOp = make_op<Assign>(vy, addOp);
+    return ex.execute(assignOp);
+  } else if (_algorithm == csrmv_algorithm_t::vector_per_row) {
+    // The vector of a row is at most as wide as its mean number of nonzeros
+    const index_t localSize =
+        static_cast<index_t>(ex.get_policy_handler().get_work_group_size());
+    const index_t meanRowSize = (_nnz + _M - 1) / _M;
+    index_t vectorSize = 1;
+    while (vectorSize < meanRowSize && vectorSize < 32 &&
+           localSize % (2 * vectorSize) == 0) {
+      vectorSize *= 2;
+    }
+    auto csrmvOp = make_csrmv_vector(vy, mA, vx, _alpha, _beta, vectorSize);
+    const index_t nWG = (csrmvOp.get_size() + localSize - 1) / localSize;
+    return ex.execute(csrmvOp, localSize, nWG * localSize, localSize);
+  }
+
+  // Merge path: the partial sums of the rows shared by several work items are
+  // added by a segmented reduction, each level of which passes the last row
+  // of each of its work groups but the last one on to the next level
+  const index_t itemsPerThread = 8;
+  const index_t nThreads = (_M + _nnz + itemsPerThread - 1) / itemsPerThread;
+  const index_t localSize =
+      static_cast<index_t>(ex.get_policy_handler().get_work_group_size());
+  const index_t nCarryOut = (nThreads + localSize - 1) / localSize;
+  auto carryRowBuff = make_sycl_iterator_buffer<index_t>(nThreads);
+  auto carryValBuff = make_sycl_iterator_buffer<element_t>(nThreads);
+  auto carryRowOutBuff = make_sycl_iterator_buffer<index_t>(nCarryOut);
+  auto carryValOutBuff = make_sycl_iterator_buffer<element_t>(nCarryOut);
+  auto carryRow = make_vector_view(ex, carryRowBuff, index_t(1), nThreads);
+  auto carryVal = make_vector_view(ex, carryValBuff, index_t(1), nThreads);
+  auto mergeOp = make_csrmv_merge_path(vy, mA, vx, carryRow, carryVal, _alpha,
+                                       _beta, itemsPerThread);
+  ret = concatenate_vectors(ret, ex.execute(mergeOp));
+
+  index_t nCarry = nThreads;
+  bool even = true;
+  do {
+    const index_t nWG = (nCarry + localSize - 1) / localSize;
+    auto inRow = make_vector_view(ex, even ? carryRowBuff : carryRowOutBuff,
+                                  index_t(1), nCarry);
+    auto inVal = make_vector_view(ex, even ? carryValBuff : carryValOutBuff,
+                                  index_t(1), nCarry);
+    auto outRow = make_vector_view(ex, even ? carryRowOutBuff : carryRowBuff,
+                                   index_t(1), nWG);
+    auto outVal = make_vector_view(ex, even ? carryValOutBuff : carryValBuff,
+                                   index_t(1), nWG);
+    auto fixupOp =
+        make_csrmv_merge_fixup(vy, inRow, inVal, outRow, outVal, _alpha);
+    ret = concatenate_vectors(
+        ret, ex.execute(fixupOp, localSize, nWG * localSize, localSize));
+    nCarry = nWG - 1;
+    even = !even;
+  } while (nCarry > 0);
+  return ret;
+}
+
 /*!
  @brief Generalised matrix vector product with rectangular non-symmetric
  matrices.
@@ -508,12 +1010,43 @@ typename Executor::policy_t::event_t inline _gemv(
     // finished, y is overwritten with the updated vector.
     increment_t _incy  // The increment for elements in y (nonzero).
 ) {
+  // The launch parameters are chosen by the backend of the target device
+  return tolower(_trans) == 'n'
+             ? blas::gemv::backend::_gemv<transpose_type::Normal>(
+                   ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
+                   _incy)
+             : blas::gemv::backend::_gemv<transpose_type::Transposed>(
+                   ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
+                   _incy);
+}
+
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _gemv_batched(
+    Executor& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, index_t _stridea, container_t1 _vx,
+    increment_t _incx, index_t _stridex, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _stridey, index_t _batch_size) {
   return tolower(_trans) == 'n'
-             ? _gemv_impl<transpose_type::Normal>(ex, _M, _N, _alpha, _mA, _lda,
-                                                  _vx, _incx, _beta, _vy, _incy)
-             : _gemv_impl<transpose_type::Transposed>(ex, _M, _N, _alpha, _mA,
-                                                      _lda, _vx, _incx, _beta,
-                                                      _vy, _incy);
+             ? _gemv_batched_impl<transpose_type::Normal>(
+                   ex, _M, _N, _alpha, _mA, _lda, _stridea, _vx, _incx,
+                   _stridex, _beta, _vy, _incy, _stridey, _batch_size)
+             : _gemv_batched_impl<transpose_type::Transposed>(
+                   ex, _M, _N, _alpha, _mA, _lda, _stridea, _vx, _incx,
+                   _stridex, _beta, _vy, _incy, _stridey, _batch_size);
+}
+
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _gemv_dual(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, container_t1 _vw,
+    increment_t _incw, element_t _beta, container_t2 _vy, increment_t _incy,
+    container_t2 _vz, increment_t _incz) {
+  return _gemv_dual_impl(ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _vw,
+                         _incw, _beta, _vy, _incy, _vz, _incz);
 }
 
 template <typename Executor, typename index_t, typename container_t0,
@@ -529,6 +1062,124 @@ typename Executor::policy_t::event_t inline _trmv(
              : _trmv_impl<transpose_type::Transposed>(ex, _Uplo, _Diag, _N, _mA,
                                                       _lda, _vx, _incx);
 }
+
+/*!
+ * @brief Launches the solve of a diagonal block of a blocked TRSV, one work
+ * item per row of the block.
+ */
+template <bool Lower, bool Unit, typename Executor, typename lhs_t,
+          typename matrix_t>
+typename Executor::policy_t::event_t _trsv_diagonal_block(Executor& ex,
+                                                          lhs_t vX,
+                                                          matrix_t mT) {
+  using index_t = typename matrix_t::index_t;
+  const index_t rows = mT.get_size_row();
+  auto trsvDiag = make_diagonal_block_trsv<Lower, Unit>(vX, mT);
+  return ex.execute(trsvDiag, rows, rows, rows);
+}
+
+/*!
+ * @brief Implementation of the blocked triangular solve.
+ *
+ * The diagonal blocks of op(A) are solved in substitution order, each by a
+ * single work group. After each block is solved, the elements of x still to be
+ * solved are updated with a single GEMV on the matching panel of A. The blocks
+ * depend on each other only through x, so the launches are ordered by the
+ * dependencies of the runtime on its buffer.
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename container_t0, typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _trsv_impl(
+    Executor& ex, char _Uplo, char _Diag, index_t _N, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, index_t _block_size) {
+  typename Executor::policy_t::event_t ret{};
+  using element_t = typename ValueType<container_t1>::type;
+  static constexpr bool trans = trn != transpose_type::Normal;
+  static constexpr auto data_layout_access =
+      Choose<trn == transpose_type::Normal, access_layout,
+             access_layout::col_major, access_layout::row_major>::type;
+  using data_layout_t = typename Layout<data_layout_access>::type;
+
+  const bool lower = (_Uplo == 'l') != trans;
+  const bool unit = (_Diag == 'u');
+  const char trans_char = trans ? 't' : 'n';
+
+  const index_t wgSize = ex.get_policy_handler().get_work_group_size();
+  const index_t block_size =
+      std::min(wgSize, (_block_size == 0) ? index_t(128) : _block_size);
+  const index_t nBlocks = (_N - 1) / block_size + 1;
+
+  for (index_t step = 0; step < nBlocks; step++) {
+    const index_t blk = lower ? step : nBlocks - 1 - step;
+    const index_t k0 = blk * block_size;
+    const index_t kb = std::min(block_size, _N - k0);
+
+    auto mT = make_matrix_view<data_layout_t>(ex, _mA + (k0 + k0 * _lda), kb,
+                                              kb, _lda);
+    auto vX = make_vector_view(ex, _vx + k0 * _incx, _incx, kb);
+    if (lower && unit) {
+      ret = concatenate_vectors(
+          ret, _trsv_diagonal_block<true, true>(ex, vX, mT));
+    } else if (lower) {
+      ret = concatenate_vectors(
+          ret, _trsv_diagonal_block<true, false>(ex, vX, mT));
+    } else if (unit) {
+      ret = concatenate_vectors(
+          ret, _trsv_diagonal_block<false, true>(ex, vX, mT));
+    } else {
+      ret = concatenate_vectors(
+          ret, _trsv_diagonal_block<false, false>(ex, vX, mT));
+    }
+
+    // Elements of x still to be solved
+    const index_t r0 = lower ? k0 + kb : 0;
+    const index_t rn = lower ? _N - r0 : k0;
+    if (rn == 0) {
+      continue;
+    }
+    // x[r0:r0+rn] -= op(A)[r0:r0+rn, k0:k0+kb] * x[k0:k0+kb]
+    const index_t offA = trans ? (k0 + r0 * _lda) : (r0 + k0 * _lda);
+    ret = concatenate_vectors(
+        ret, internal::_gemv(ex, trans_char, trans ? kb : rn, trans ? rn : kb,
+                             element_t(-1), _mA + offA, _lda,
+                             _vx + k0 * _incx, _incx, element_t(1),
+                             _vx + r0 * _incx, _incx));
+  }
+  return ret;
+}
+
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _trsv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    index_t _block_size) {
+  _Uplo = tolower(_Uplo);
+  _trans = tolower(_trans);
+  _Diag = tolower(_Diag);
+
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_trans != 'n' && _trans != 't' && _trans != 'c') {
+    throw std::invalid_argument("invalid _trans");
+  } else if (_Diag != 'u' && _Diag != 'n') {
+    throw std::invalid_argument("invalid _Diag");
+  } else if (_incx <= 0) {
+    throw std::invalid_argument("invalid _incx");
+  } else if (_block_size < 0) {
+    throw std::invalid_argument("invalid _block_size");
+  }
+
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _trans == 'n'
+             ? _trsv_impl<transpose_type::Normal>(ex, _Uplo, _Diag, _N, _mA,
+                                                  _lda, _vx, _incx, _block_size)
+             : _trsv_impl<transpose_type::Transposed>(
+                   ex, _Uplo, _Diag, _N, _mA, _lda, _vx, _incx, _block_size);
+}
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename container_t1, typename increment_t,
           typename container_t2>
@@ -572,6 +1223,227 @@ typename Executor::policy_t::event_t inline _syr2(
   // scratch size per device
   return _syr2_impl(ex, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy, _mA, _lda);
 }
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _gbmv(
+    Executor& ex, char _trans, index_t _M, index_t _N, index_t _KL,
+    index_t _KU, element_t _alpha, container_t0 _mA, index_t _lda,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy) {
+  _trans = tolower(_trans);
+
+  if (_trans != 'n' && _trans != 't' && _trans != 'c') {
+    throw std::invalid_argument("invalid _trans");
+  } else if (_M < 0 || _N < 0) {
+    throw std::invalid_argument("invalid matrix size");
+  } else if (_KL < 0 || _KU < 0) {
+    throw std::invalid_argument("invalid band width");
+  } else if (_lda < _KL + _KU + 1) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_incx == 0 || _incy == 0) {
+    throw std::invalid_argument("invalid increment");
+  }
+
+  if (_M == 0 || _N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _trans == 'n'
+             ? _gbmv_impl<transpose_type::Normal>(ex, _M, _N, _KL, _KU,
+                                                  _alpha, _mA, _lda, _vx,
+                                                  _incx, _beta, _vy, _incy)
+             : _gbmv_impl<transpose_type::Transposed>(
+                   ex, _M, _N, _KL, _KU, _alpha, _mA, _lda, _vx, _incx, _beta,
+                   _vy, _incy);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _sbmv(
+    Executor& ex, char _Uplo, index_t _N, index_t _K, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    element_t _beta, container_t2 _vy, increment_t _incy) {
+  _Uplo = tolower(_Uplo);
+
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_K < 0) {
+    throw std::invalid_argument("invalid _K");
+  } else if (_lda < _K + 1) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_incx == 0 || _incy == 0) {
+    throw std::invalid_argument("invalid increment");
+  }
+
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _sbmv_impl(ex, _Uplo, _N, _K, _alpha, _mA, _lda, _vx, _incx, _beta,
+                    _vy, _incy);
+}
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _tbmv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N, index_t _K,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  _Uplo = tolower(_Uplo);
+  _trans = tolower(_trans);
+  _Diag = tolower(_Diag);
+
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_trans != 'n' && _trans != 't' && _trans != 'c') {
+    throw std::invalid_argument("invalid _trans");
+  } else if (_Diag != 'u' && _Diag != 'n') {
+    throw std::invalid_argument("invalid _Diag");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_K < 0) {
+    throw std::invalid_argument("invalid _K");
+  } else if (_lda < _K + 1) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_incx == 0) {
+    throw std::invalid_argument("invalid _incx");
+  }
+
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _trans == 'n'
+             ? _tbmv_impl<transpose_type::Normal>(ex, _Uplo, _Diag, _N, _K,
+                                                  _mA, _lda, _vx, _incx)
+             : _tbmv_impl<transpose_type::Transposed>(ex, _Uplo, _Diag, _N, _K,
+                                                      _mA, _lda, _vx, _incx);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _spmv(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mAP,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy) {
+  _Uplo = tolower(_Uplo);
+
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_incx == 0 || _incy == 0) {
+    throw std::invalid_argument("invalid increment");
+  }
+
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _spmv_impl(ex, _Uplo, _N, _alpha, _mAP, _vx, _incx, _beta, _vy,
+                    _incy);
+}
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _tpmv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_t0 _mAP, container_t1 _vx, increment_t _incx) {
+  _Uplo = tolower(_Uplo);
+  _trans = tolower(_trans);
+  _Diag = tolower(_Diag);
+
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_trans != 'n' && _trans != 't' && _trans != 'c') {
+    throw std::invalid_argument("invalid _trans");
+  } else if (_Diag != 'u' && _Diag != 'n') {
+    throw std::invalid_argument("invalid _Diag");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_incx == 0) {
+    throw std::invalid_argument("invalid _incx");
+  }
+
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _trans == 'n'
+             ? _tpmv_impl<transpose_type::Normal>(ex, _Uplo, _Diag, _N, _mAP,
+                                                  _vx, _incx)
+             : _tpmv_impl<transpose_type::Transposed>(ex, _Uplo, _Diag, _N,
+                                                      _mAP, _vx, _incx);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename increment_t, typename container_t1>
+typename Executor::policy_t::event_t inline _spr(Executor& ex, char _Uplo,
+                                                 index_t _N, element_t _alpha,
+                                                 container_t0 _vx,
+                                                 increment_t _incx,
+                                                 container_t1 _mAP) {
+  _Uplo = tolower(_Uplo);
+
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_incx == 0) {
+    throw std::invalid_argument("invalid _incx");
+  }
+
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _spr_impl(ex, _Uplo, _N, _alpha, _vx, _incx, _mAP);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename increment_t, typename container_t1,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _spr2(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _vx,
+    increment_t _incx, container_t1 _vy, increment_t _incy,
+    container_t2 _mAP) {
+  _Uplo = tolower(_Uplo);
+
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_incx == 0 || _incy == 0) {
+    throw std::invalid_argument("invalid increment");
+  }
+
+  if (_N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _spr2_impl(ex, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy, _mAP);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename container_t2,
+          typename increment_t, typename container_t3>
+typename Executor::policy_t::event_t inline _csrmv(
+    Executor& ex, index_t _M, index_t _N, index_t _nnz, element_t _alpha,
+    container_t0 _row_ptr, container_t0 _col_ind, container_t1 _values,
+    container_t2 _vx, increment_t _incx, element_t _beta, container_t3 _vy,
+    increment_t _incy, csrmv_algorithm_t _algorithm) {
+  if (_M < 0 || _N < 0) {
+    throw std::invalid_argument("invalid matrix size");
+  } else if (_nnz < 0) {
+    throw std::invalid_argument("invalid _nnz");
+  } else if (_incx == 0 || _incy == 0) {
+    throw std::invalid_argument("invalid increment");
+  }
+
+  if (_M == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+
+  return _csrmv_impl(ex, _M, _N, _nnz, _alpha, _row_ptr, _col_ind, _values,
+                     _vx, _incx, _beta, _vy, _incy, _algorithm);
+}
 
 }  // namespace internal
 }  // namespace blas
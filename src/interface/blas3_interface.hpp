@@ -30,6 +30,7 @@
 #include "executors/executor.h"
 #include "interface/blas3/backend/backend.hpp"
 #include "interface/blas3_interface.h"
+#include "operations/blas1_trees.h"
 #include "operations/blas3_trees.h"
 #include "policy/sycl_policy_handler.h"
 #include <algorithm>
@@ -123,6 +124,95 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                        _ldb, _beta, _C, _ldc, index_t(1));
 }
 
+/*!
+ * @brief Launches a Gemm of which alpha and beta are read from device memory
+ * by the kernel (see GemmDeviceScalars).
+ *
+ * The precompiled backend configurations take their scalars by value, so a
+ * single general purpose tile is used, with or without local memory depending
+ * on the device.
+ */
+template <bool TransA, bool TransB, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_device_scalars(
+    executor_t& ex, index_t _M, index_t _N, index_t _K,
+    BufferIterator<element_t, codeplay_policy> _alpha, container_0_t a_,
+    index_t _lda, container_1_t b_, index_t _ldb,
+    BufferIterator<element_t, codeplay_policy> _beta, container_2_t _C,
+    index_t _ldc) {
+  auto mA = make_matrix_view<col_major>(ex, a_, _M, _K, _lda);
+  auto mB = make_matrix_view<col_major>(ex, b_, _K, _N, _ldb);
+  auto mC = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  auto alpha = make_vector_view(ex, _alpha, index_t(1), index_t(1));
+  auto beta = make_vector_view(ex, _beta, index_t(1), index_t(1));
+  if (ex.get_policy_handler().has_local_memory()) {
+    auto gemm =
+        make_gemm<true, false, false, 64, Tile<4, 4, 8, 8>, TransA, TransB,
+                  static_cast<int>(gemm_memory_t::local),
+                  static_cast<int>(gemm_algorithm_t::standard), false>(
+            mA, mB, mC, element_t(1), element_t(0), index_t(1));
+    auto gemm_beta_zero =
+        make_gemm<true, false, false, 64, Tile<4, 4, 8, 8>, TransA, TransB,
+                  static_cast<int>(gemm_memory_t::local),
+                  static_cast<int>(gemm_algorithm_t::standard), true>(
+            mA, mB, mC, element_t(1), element_t(0), index_t(1));
+    return ex.execute(
+        make_gemm_device_scalars(gemm, gemm_beta_zero, alpha, beta));
+  } else {
+    auto gemm =
+        make_gemm<false, false, false, 64, Tile<8, 8, 8, 8>, TransA, TransB,
+                  static_cast<int>(gemm_memory_t::no_local),
+                  static_cast<int>(gemm_algorithm_t::standard), false>(
+            mA, mB, mC, element_t(1), element_t(0), index_t(1));
+    auto gemm_beta_zero =
+        make_gemm<false, false, false, 64, Tile<8, 8, 8, 8>, TransA, TransB,
+                  static_cast<int>(gemm_memory_t::no_local),
+                  static_cast<int>(gemm_algorithm_t::standard), true>(
+            mA, mB, mC, element_t(1), element_t(0), index_t(1));
+    return ex.execute(
+        make_gemm_device_scalars(gemm, gemm_beta_zero, alpha, beta));
+  }
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, BufferIterator<element_t, codeplay_policy> _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    BufferIterator<element_t, codeplay_policy> _beta, container_2_t _C,
+    index_t _ldc) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+
+  if (_M == 0 || _N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+  if (_TrA && _TrB) {
+    return _gemm_device_scalars<true, true>(ex, _M, _N, _K, _alpha, a_, _lda,
+                                            b_, _ldb, _beta, _C, _ldc);
+  } else if (!_TrA && _TrB) {
+    return _gemm_device_scalars<false, true>(ex, _M, _N, _K, _alpha, a_, _lda,
+                                             b_, _ldb, _beta, _C, _ldc);
+  } else if (_TrA && !_TrB) {
+    return _gemm_device_scalars<true, false>(ex, _M, _N, _K, _alpha, a_, _lda,
+                                             b_, _ldb, _beta, _C, _ldc);
+  } else {
+    return _gemm_device_scalars<false, false>(ex, _M, _N, _K, _alpha, a_, _lda,
+                                              b_, _ldb, _beta, _C, _ldc);
+  }
+}
+
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm_batched(
@@ -134,6 +224,593 @@ typename executor_t::policy_t::event_t _gemm_batched(
                        _ldb, _beta, _C, _ldc, batch_size);
 }
 
+/*!
+ * @brief Solves one diagonal block of a blocked TRSM in local memory.
+ *
+ * The rhs slice of the local memory is sized so that the whole scratch stays
+ * at block_size * block_size + 2048 elements, and within the local memory of
+ * the device, which _trsm checks can hold at least one right-hand side.
+ */
+template <bool Lower, bool Unit, typename executor_t, typename lhs_t,
+          typename matrix_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _trsm_diagonal_block(
+    executor_t& ex, lhs_t mX, matrix_t mT, element_t _alpha,
+    index_t _block_size) {
+  const index_t nrhs = mX.get_size_col();
+  const index_t rows = mT.get_size_row();
+  const index_t wgSize = ex.get_policy_handler().get_work_group_size();
+  const index_t maxLocalMem = static_cast<index_t>(
+      ex.get_policy_handler().get_local_memory_size() / sizeof(element_t));
+  const index_t localSize =
+      std::min(std::min(wgSize, (maxLocalMem - rows * rows) / rows),
+               std::max(index_t(1), index_t(2048) / _block_size));
+  const index_t globalSize = ((nrhs - 1) / localSize + 1) * localSize;
+  const index_t localMemSize = rows * rows + rows * localSize;
+  auto trsmDiag = make_diagonal_block_trsm<Lower, Unit>(mX, mT, _alpha);
+  return ex.execute(trsmDiag, localSize, globalSize, localMemSize);
+}
+
+/*!
+ * @brief Implementation of the blocked triangular solve.
+ *
+ * The solve is expressed as T * Y = alpha * R, where T is the effective
+ * triangle and Y the effective right-hand sides: T = op(A) and Y = X for a
+ * left-side solve, T = op(A)^T and Y = X^T for a right-side solve. Both
+ * transpositions are obtained through row-major views of the same buffers.
+ *
+ * The diagonal blocks of T are processed in substitution order. After each
+ * block is solved, the remaining right-hand sides are updated with a single
+ * GEMM. alpha is applied by the first diagonal solve and, through beta, by the
+ * first GEMM update, so B is never scaled separately.
+ */
+template <bool RightSide, bool TransA, typename executor_t,
+          typename container_0_t, typename container_1_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _trsm_impl(
+    executor_t& ex, char _Uplo, char _Diag, index_t _M, index_t _N,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
+    index_t _ldb, index_t _block_size) {
+  typename executor_t::policy_t::event_t ret{};
+  // T is stored transposed with respect to A iff only one of the side and
+  // the transposition swaps it
+  static constexpr auto t_layout_access =
+      Choose<RightSide != TransA, access_layout, access_layout::row_major,
+             access_layout::col_major>::type;
+  using t_layout_t = typename Layout<t_layout_access>::type;
+  static constexpr auto y_layout_access =
+      Choose<RightSide, access_layout, access_layout::row_major,
+             access_layout::col_major>::type;
+  using y_layout_t = typename Layout<y_layout_access>::type;
+
+  const bool opA_lower = (_Uplo == 'l') != TransA;
+  const bool lower = RightSide ? !opA_lower : opA_lower;
+  const bool unit = (_Diag == 'u');
+  const char trans_char = TransA ? 't' : 'n';
+
+  // Order of T and number of right-hand sides
+  const index_t K = RightSide ? _N : _M;
+  const index_t nrhs = RightSide ? _M : _N;
+  const index_t block_size = (_block_size == 0) ? index_t(32) : _block_size;
+  const index_t nBlocks = (K - 1) / block_size + 1;
+
+  for (index_t step = 0; step < nBlocks; step++) {
+    const index_t blk = lower ? step : nBlocks - 1 - step;
+    const index_t k0 = blk * block_size;
+    const index_t kb = std::min(block_size, K - k0);
+    const element_t block_alpha = (step == 0) ? _alpha : element_t(1);
+
+    auto mT = make_matrix_view<t_layout_t>(ex, a_ + (k0 + k0 * _lda), kb, kb,
+                                           _lda);
+    auto mY = make_matrix_view<y_layout_t>(
+        ex, b_ + (RightSide ? k0 * _ldb : k0), kb, nrhs, _ldb);
+    if (lower && unit) {
+      ret = concatenate_vectors(ret, _trsm_diagonal_block<true, true>(
+                                         ex, mY, mT, block_alpha, block_size));
+    } else if (lower) {
+      ret = concatenate_vectors(ret, _trsm_diagonal_block<true, false>(
+                                         ex, mY, mT, block_alpha, block_size));
+    } else if (unit) {
+      ret = concatenate_vectors(ret, _trsm_diagonal_block<false, true>(
+                                         ex, mY, mT, block_alpha, block_size));
+    } else {
+      ret = concatenate_vectors(ret, _trsm_diagonal_block<false, false>(
+                                         ex, mY, mT, block_alpha, block_size));
+    }
+
+    // Rows (left side) or columns (right side) still to be solved
+    const index_t r0 = lower ? k0 + kb : 0;
+    const index_t rn = lower ? K - r0 : k0;
+    if (rn == 0) {
+      continue;
+    }
+    const element_t update_beta = (step == 0) ? _alpha : element_t(1);
+    if (!RightSide) {
+      // B[r0:r0+rn, :] -= op(A)[r0:r0+rn, k0:k0+kb] * X[k0:k0+kb, :]
+      const index_t offA = TransA ? (k0 + r0 * _lda) : (r0 + k0 * _lda);
+      ret = concatenate_vectors(
+          ret, _gemm_backend(ex, trans_char, 'n', rn, nrhs, kb, element_t(-1),
+                             a_ + offA, _lda, b_ + k0, _ldb, update_beta,
+                             b_ + r0, _ldb, index_t(1)));
+    } else {
+      // B[:, r0:r0+rn] -= X[:, k0:k0+kb] * op(A)[k0:k0+kb, r0:r0+rn]
+      const index_t offA = TransA ? (r0 + k0 * _lda) : (k0 + r0 * _lda);
+      ret = concatenate_vectors(
+          ret, _gemm_backend(ex, 'n', trans_char, nrhs, rn, kb, element_t(-1),
+                             b_ + k0 * _ldb, _ldb, a_ + offA, _lda, update_beta,
+                             b_ + r0 * _ldb, _ldb, index_t(1)));
+    }
+  }
+  return ret;
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _trsm(
+    executor_t& ex, char _Side, char _Uplo, char _TransA, char _Diag,
+    index_t _M, index_t _N, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, index_t _block_size) {
+  _Side = tolower(_Side);
+  _Uplo = tolower(_Uplo);
+  _TransA = tolower(_TransA);
+  _Diag = tolower(_Diag);
+
+  if (_Side != 'l' && _Side != 'r') {
+    throw std::invalid_argument("invalid _Side");
+  } else if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_Diag != 'u' && _Diag != 'n') {
+    throw std::invalid_argument("invalid _Diag");
+  } else if (_block_size < 0) {
+    throw std::invalid_argument("invalid _block_size");
+  }
+
+  if (_M == 0 || _N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  // A diagonal block and the slice of one right-hand side must fit in the
+  // local memory
+  const size_t block_size = std::min(
+      (_block_size == 0) ? index_t(32) : _block_size, (_Side == 'r') ? _N : _M);
+  if (block_size * (block_size + 1) * sizeof(element_t) >
+      ex.get_policy_handler().get_local_memory_size()) {
+    throw std::invalid_argument("_block_size exceeds the local memory");
+  }
+
+  const bool right = _Side == 'r';
+  const bool trans = _TransA != 'n';
+  if (right && trans) {
+    return _trsm_impl<true, true>(ex, _Uplo, _Diag, _M, _N, _alpha, a_, _lda,
+                                  b_, _ldb, _block_size);
+  } else if (right && !trans) {
+    return _trsm_impl<true, false>(ex, _Uplo, _Diag, _M, _N, _alpha, a_, _lda,
+                                   b_, _ldb, _block_size);
+  } else if (!right && trans) {
+    return _trsm_impl<false, true>(ex, _Uplo, _Diag, _M, _N, _alpha, a_, _lda,
+                                   b_, _ldb, _block_size);
+  } else {
+    return _trsm_impl<false, false>(ex, _Uplo, _Diag, _M, _N, _alpha, a_, _lda,
+                                    b_, _ldb, _block_size);
+  }
+}
+
+/*!
+ * @brief Launches a Gemm on structured operands (see StructuredMatrixView).
+ *
+ * Each operand is either a StructuredMatrixView or a plain matrix view, so
+ * that a general operand is read without the structure mapping. The structured
+ * loads do not fit the tall and skinny kernel nor the precompiled backend
+ * configurations, so a single general purpose tile is used, with or without
+ * local memory depending on the device.
+ */
+template <bool TransA, bool TransB, bool is_beta_zero, typename executor_t,
+          typename input_a_t, typename input_b_t, typename output_t,
+          typename element_t>
+typename executor_t::policy_t::event_t _structured_gemm(
+    executor_t& ex, input_a_t mA, input_b_t mB, output_t mC, element_t _alpha,
+    element_t _beta) {
+  using index_t = typename std::make_signed<typename input_a_t::index_t>::type;
+  if (ex.get_policy_handler().has_local_memory()) {
+    auto gemm =
+        make_gemm<true, false, false, 64, Tile<4, 4, 8, 8>, TransA, TransB,
+                  static_cast<int>(gemm_memory_t::local),
+                  static_cast<int>(gemm_algorithm_t::standard), is_beta_zero>(
+            mA, mB, mC, _alpha, _beta, index_t(1));
+    return ex.execute(gemm);
+  } else {
+    auto gemm =
+        make_gemm<false, false, false, 64, Tile<8, 8, 8, 8>, TransA, TransB,
+                  static_cast<int>(gemm_memory_t::no_local),
+                  static_cast<int>(gemm_algorithm_t::standard), is_beta_zero>(
+            mA, mB, mC, _alpha, _beta, index_t(1));
+    return ex.execute(gemm);
+  }
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _trmm(
+    executor_t& ex, char _Side, char _Uplo, char _TransA, char _Diag,
+    index_t _M, index_t _N, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb) {
+  _Side = tolower(_Side);
+  _Uplo = tolower(_Uplo);
+  _TransA = tolower(_TransA);
+  _Diag = tolower(_Diag);
+
+  if (_Side != 'l' && _Side != 'r') {
+    throw std::invalid_argument("invalid _Side");
+  } else if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_Diag != 'u' && _Diag != 'n') {
+    throw std::invalid_argument("invalid _Diag");
+  }
+
+  if (_M == 0 || _N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  const bool right = _Side == 'r';
+  const bool trans = _TransA != 'n';
+  const index_t K = right ? _N : _M;
+
+  // B is both an input and the output of the product, so the kernel reads a
+  // copy of it
+  const index_t size_b = (_N - 1) * _ldb + _M;
+  auto b_copy = make_sycl_iterator_buffer<element_t>(size_b);
+  auto vB = make_vector_view(ex, b_, index_t(1), size_b);
+  auto vCopy = make_vector_view(ex, b_copy, index_t(1), size_b);
+  auto copyOp = make_op<Assign>(vCopy, vB);
+  auto ret = ex.execute(copyOp);
+
+  auto mA = make_structured_matrix_view(ex, a_, K, K, _lda,
+                                        matrix_structure_t::triangular,
+                                        _Uplo == 'l', _Diag == 'u');
+  auto mB = make_matrix_view<col_major>(ex, b_copy, _M, _N, _ldb);
+  auto mC = make_matrix_view<col_major>(ex, b_, _M, _N, _ldb);
+  const element_t beta = element_t(0);
+  if (right && trans) {
+    ret = concatenate_vectors(
+        ret, _structured_gemm<false, true, true>(ex, mB, mA, mC, _alpha, beta));
+  } else if (right) {
+    ret = concatenate_vectors(ret, _structured_gemm<false, false, true>(
+                                       ex, mB, mA, mC, _alpha, beta));
+  } else if (trans) {
+    ret = concatenate_vectors(
+        ret, _structured_gemm<true, false, true>(ex, mA, mB, mC, _alpha, beta));
+  } else {
+    ret = concatenate_vectors(ret, _structured_gemm<false, false, true>(
+                                       ex, mA, mB, mC, _alpha, beta));
+  }
+  return ret;
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _symm(
+    executor_t& ex, char _Side, char _Uplo, index_t _M, index_t _N,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
+    index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc) {
+  _Side = tolower(_Side);
+  _Uplo = tolower(_Uplo);
+
+  if (_Side != 'l' && _Side != 'r') {
+    throw std::invalid_argument("invalid _Side");
+  } else if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  }
+
+  if (_M == 0 || _N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  const bool right = _Side == 'r';
+  const index_t K = right ? _N : _M;
+  auto mA = make_structured_matrix_view(
+      ex, a_, K, K, _lda, matrix_structure_t::symmetric, _Uplo == 'l');
+  auto mB = make_matrix_view<col_major>(ex, b_, _M, _N, _ldb);
+  auto mC = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  const bool beta_zero = _beta == element_t(0);
+  if (right && beta_zero) {
+    return _structured_gemm<false, false, true>(ex, mB, mA, mC, _alpha, _beta);
+  } else if (right) {
+    return _structured_gemm<false, false, false>(ex, mB, mA, mC, _alpha,
+                                                 _beta);
+  } else if (beta_zero) {
+    return _structured_gemm<false, false, true>(ex, mA, mB, mC, _alpha, _beta);
+  } else {
+    return _structured_gemm<false, false, false>(ex, mA, mB, mC, _alpha,
+                                                 _beta);
+  }
+}
+
+/*!
+ * @brief Launches the triangular product, op(A) and op(B) being read through
+ * row major views of A and B when they are transposed.
+ */
+template <bool TransA, bool TransB, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemmt_impl(
+    executor_t& ex, bool _lower, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  static constexpr auto a_layout_access =
+      Choose<TransA, access_layout, access_layout::row_major,
+             access_layout::col_major>::type;
+  using a_layout_t = typename Layout<a_layout_access>::type;
+  static constexpr auto b_layout_access =
+      Choose<TransB, access_layout, access_layout::row_major,
+             access_layout::col_major>::type;
+  using b_layout_t = typename Layout<b_layout_access>::type;
+  auto mA = make_matrix_view<a_layout_t>(ex, a_, _N, _K, _lda);
+  auto mB = make_matrix_view<b_layout_t>(ex, b_, _K, _N, _ldb);
+  auto mC = make_matrix_view<col_major>(ex, _C, _N, _N, _ldc);
+  auto gemmt = make_gemmt(mC, mA, mB, _alpha, _beta, _lower);
+  return ex.execute(gemmt);
+}
+
+/*!
+ * @brief Computes the triangle of C by splitting it in two diagonal blocks,
+ * computed recursively, and the off-diagonal block between them, computed by
+ * the tiled _gemm. Only the diagonal blocks of at most gemmt_block_size rows
+ * are computed by the Gemmt kernel, which is untiled.
+ */
+template <bool TransA, bool TransB, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemmt_recursive(
+    executor_t& ex, bool _lower, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  constexpr index_t gemmt_block_size = 64;
+  if (_N <= gemmt_block_size || _K == 0) {
+    return _gemmt_impl<TransA, TransB>(ex, _lower, _N, _K, _alpha, a_, _lda,
+                                       b_, _ldb, _beta, _C, _ldc);
+  }
+  const index_t n1 = _N / 2;
+  const index_t n2 = _N - n1;
+  // offsets of the row n1 of op(A) and of the column n1 of op(B)
+  const index_t a_ofs = TransA ? n1 * _lda : n1;
+  const index_t b_ofs = TransB ? n1 : n1 * _ldb;
+  const char trans_a = TransA ? 't' : 'n';
+  const char trans_b = TransB ? 't' : 'n';
+
+  auto ret = _gemmt_recursive<TransA, TransB>(ex, _lower, n1, _K, _alpha, a_,
+                                              _lda, b_, _ldb, _beta, _C, _ldc);
+  if (_lower) {
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, n2, n1, _K, _alpha,
+                             a_ + a_ofs, _lda, b_, _ldb, _beta, _C + n1,
+                             _ldc));
+  } else {
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, n1, n2, _K, _alpha, a_,
+                             _lda, b_ + b_ofs, _ldb, _beta, _C + n1 * _ldc,
+                             _ldc));
+  }
+  return concatenate_vectors(
+      ret, _gemmt_recursive<TransA, TransB>(
+               ex, _lower, n2, _K, _alpha, a_ + a_ofs, _lda, b_ + b_ofs, _ldb,
+               _beta, _C + (n1 + n1 * _ldc), _ldc));
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemmt(
+    executor_t& ex, char _Uplo, char _TransA, char _TransB, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc) {
+  _Uplo = tolower(_Uplo);
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  } else if (_N < 0 || _K < 0) {
+    throw std::invalid_argument("invalid matrix size");
+  }
+
+  if (_N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  const bool lower = _Uplo == 'l';
+  const bool trans_a = _TransA != 'n';
+  const bool trans_b = _TransB != 'n';
+  if (trans_a && trans_b) {
+    return _gemmt_recursive<true, true>(ex, lower, _N, _K, _alpha, a_, _lda,
+                                        b_, _ldb, _beta, _C, _ldc);
+  } else if (trans_a) {
+    return _gemmt_recursive<true, false>(ex, lower, _N, _K, _alpha, a_, _lda,
+                                         b_, _ldb, _beta, _C, _ldc);
+  } else if (trans_b) {
+    return _gemmt_recursive<false, true>(ex, lower, _N, _K, _alpha, a_, _lda,
+                                         b_, _ldb, _beta, _C, _ldc);
+  } else {
+    return _gemmt_recursive<false, false>(ex, lower, _N, _K, _alpha, a_, _lda,
+                                          b_, _ldb, _beta, _C, _ldc);
+  }
+}
+
+/*!
+ * @brief Launches the sparse times dense matrix product, B and C being read
+ * through views of layout layout_t.
+ */
+template <typename tile_type, typename layout_t, typename executor_t,
+          typename index_t, typename element_t, typename container_0_t,
+          typename container_1_t, typename container_2_t,
+          typename container_3_t>
+typename executor_t::policy_t::event_t _spmm_impl(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, index_t _nnz,
+    element_t _alpha, container_0_t _row_ptr, container_0_t _col_ind,
+    container_1_t _values, container_2_t b_, index_t _ldb, element_t _beta,
+    container_3_t _C, index_t _ldc) {
+  auto mA =
+      make_csr_matrix_view(ex, _row_ptr, _col_ind, _values, _M, _K, _nnz);
+  auto mB = make_matrix_view<layout_t>(ex, b_, _K, _N, _ldb);
+  auto mC = make_matrix_view<layout_t>(ex, _C, _M, _N, _ldc);
+  auto spmm = make_spmm<tile_type>(mC, mA, mB, _alpha, _beta);
+  using spmm_t = decltype(spmm);
+  return ex.execute(spmm, static_cast<index_t>(spmm_t::wg_size),
+                    spmm.get_size(),
+                    static_cast<index_t>(spmm_t::local_memory_size));
+}
+
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t>
+typename executor_t::policy_t::event_t _spmm(
+    executor_t& ex, char _Layout, index_t _M, index_t _N, index_t _K,
+    index_t _nnz, element_t _alpha, container_0_t _row_ptr,
+    container_0_t _col_ind, container_1_t _values, container_2_t b_,
+    index_t _ldb, element_t _beta, container_3_t _C, index_t _ldc) {
+  _Layout = tolower(_Layout);
+
+  if (_Layout != 'c' && _Layout != 'r') {
+    throw std::invalid_argument("invalid _Layout");
+  } else if (_M < 0 || _N < 0 || _K < 0) {
+    throw std::invalid_argument("invalid matrix size");
+  } else if (_nnz < 0) {
+    throw std::invalid_argument("invalid _nnz");
+  } else if (_Layout == 'c' && (_ldb < std::max<index_t>(1, _K) ||
+                                _ldc < std::max<index_t>(1, _M))) {
+    throw std::invalid_argument("invalid leading dimension");
+  } else if (_Layout == 'r' && (_ldb < std::max<index_t>(1, _N) ||
+                                _ldc < std::max<index_t>(1, _N))) {
+    throw std::invalid_argument("invalid leading dimension");
+  }
+
+  if (_M == 0 || _N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  // Each work item computes 2 x 2 elements of a block of 16 x 32 elements,
+  // the 16 nonzeros staged per row sharing the loads of the column indices
+  using tile_type = Tile<2, 2, 8, 16>;
+  if (_Layout == 'c') {
+    return _spmm_impl<tile_type, col_major>(ex, _M, _N, _K, _nnz, _alpha,
+                                            _row_ptr, _col_ind, _values, b_,
+                                            _ldb, _beta, _C, _ldc);
+  } else {
+    return _spmm_impl<tile_type, row_major>(ex, _M, _N, _K, _nnz, _alpha,
+                                            _row_ptr, _col_ind, _values, b_,
+                                            _ldb, _beta, _C, _ldc);
+  }
+}
+
+/*!
+ * @brief Launches the block sparse product on the local memory Gemm. The
+ * blocks of a work group are 32 x 32, so that each step of its K loop
+ * overlaps a single block of the mask when the mask blocks are 32 x 32.
+ */
+template <bool TransA, bool TransB, bool is_beta_zero, typename executor_t,
+          typename index_t, typename element_t, typename container_0_t,
+          typename container_1_t, typename container_2_t>
+typename executor_t::policy_t::event_t _gemm_block_sparse_impl(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_1_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _block_size,
+    container_0_t _mask) {
+  auto buffer_a = make_matrix_view<col_major>(ex, a_, _M, _K, _lda);
+  auto buffer_b = make_matrix_view<col_major>(ex, b_, _K, _N, _ldb);
+  auto buffer_c = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  auto gemm =
+      make_gemm<false, false, false, 64, Tile<4, 4, 8, 8>, TransA, TransB,
+                static_cast<int>(gemm_memory_t::local),
+                static_cast<int>(gemm_algorithm_t::standard), is_beta_zero>(
+          buffer_a, buffer_b, buffer_c, _alpha, _beta, index_t(1));
+  const index_t maskSize = ((_M + _block_size - 1) / _block_size) *
+                           ((_K + _block_size - 1) / _block_size);
+  auto mask = make_vector_view(ex, _mask, index_t(1), maskSize);
+  return ex.execute(make_gemm_block_sparse(gemm, mask, _block_size));
+}
+
+template <bool TransA, bool TransB, typename executor_t, typename index_t,
+          typename element_t, typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemm_block_sparse_is_beta_zero(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_1_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _block_size,
+    container_0_t _mask) {
+  return ((_beta == static_cast<element_t>(0))
+              ? _gemm_block_sparse_impl<TransA, TransB, true>(
+                    ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C,
+                    _ldc, _block_size, _mask)
+              : _gemm_block_sparse_impl<TransA, TransB, false>(
+                    ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C,
+                    _ldc, _block_size, _mask));
+}
+
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemm_block_sparse(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_1_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t _block_size, container_0_t _mask,
+    index_t _nnz_blocks, double _dense_threshold) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  } else if (_M < 0 || _N < 0 || _K < 0) {
+    throw std::invalid_argument("invalid matrix size");
+  } else if (_block_size <= 0) {
+    throw std::invalid_argument("invalid _block_size");
+  }
+  const index_t nBlocks = ((_M + _block_size - 1) / _block_size) *
+                          ((_K + _block_size - 1) / _block_size);
+  if (_nnz_blocks < 0 || _nnz_blocks > nBlocks) {
+    throw std::invalid_argument("invalid _nnz_blocks");
+  }
+
+  if (_M == 0 || _N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  // Above the threshold, too few steps of the K loop are skipped to make up
+  // for the tuned dense kernels
+  if (_nnz_blocks > _dense_threshold * nBlocks) {
+    return internal::_gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda,
+                           b_, _ldb, _beta, _C, _ldc);
+  }
+
+  const bool trans_a = _TransA != 'n';
+  const bool trans_b = _TransB != 'n';
+  if (trans_a && trans_b) {
+    return _gemm_block_sparse_is_beta_zero<true, true>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _block_size, _mask);
+  } else if (trans_a) {
+    return _gemm_block_sparse_is_beta_zero<true, false>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _block_size, _mask);
+  } else if (trans_b) {
+    return _gemm_block_sparse_is_beta_zero<false, true>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _block_size, _mask);
+  } else {
+    return _gemm_block_sparse_is_beta_zero<false, false>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _block_size, _mask);
+  }
+}
+
 }  // namespace internal
 
 }  // namespace blas
@@ -0,0 +1,497 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename complex_interface.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_COMPLEX_INTERFACE_HPP
+#define SYCL_BLAS_COMPLEX_INTERFACE_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+#include "executors/executor.h"
+#include "interface/blas1_interface.hpp"
+#include "interface/blas2_interface.hpp"
+#include "interface/blas3_interface.hpp"
+#include "interface/complex_interface.h"
+#include "operations/blas1_trees.h"
+#include "operations/blas_constants.h"
+#include "operations/blas_operators.hpp"
+
+namespace blas {
+namespace internal {
+
+/*!
+ * @brief Real buffer aliasing a complex buffer, the real and imaginary parts of
+ * the element i being at the offsets 2 * i and 2 * i + 1.
+ */
+template <typename scalar_t>
+inline BufferIterator<scalar_t, codeplay_policy> _complex_as_real(
+    complex_buffer_t<scalar_t> _c) {
+  return BufferIterator<scalar_t, codeplay_policy>(
+      _c.get_buffer().template reinterpret<scalar_t>(
+          cl::sycl::range<1>(2 * _c.get_buffer().get_count())),
+      2 * _c.get_offset());
+}
+
+/*!
+ * @brief Copies the real and imaginary parts of a rows x cols column major
+ * complex matrix to two real matrices with the same leading dimension,
+ * negating the imaginary parts when conj is true.
+ */
+template <typename executor_t, typename scalar_t, typename index_t>
+typename executor_t::policy_t::event_t _complex_split(
+    executor_t &ex, complex_buffer_t<scalar_t> _src, index_t _ld, index_t _rows,
+    index_t _cols, bool _conj, BufferIterator<scalar_t, codeplay_policy> _re,
+    BufferIterator<scalar_t, codeplay_policy> _im) {
+  const index_t size = (_rows > 0 && _cols > 0) ? _ld * (_cols - 1) + _rows : 0;
+  if (size == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+  auto src = _complex_as_real(_src);
+  auto vsrc_re = make_vector_view(ex, src, index_t(2), size);
+  auto vsrc_im = make_vector_view(ex, src + 1, index_t(2), size);
+  auto vre = make_vector_view(ex, _re, index_t(1), size);
+  auto vim = make_vector_view(ex, _im, index_t(1), size);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(
+      _conj ? scalar_t(-1) : scalar_t(1), vsrc_im);
+  auto assignOp = make_op<DoubleAssign>(vre, vim, vsrc_re, scalOp);
+  return ex.execute(assignOp);
+}
+
+/*!
+ * @brief Same as _complex_split, also writing the sum of the real and
+ * imaginary parts to a third matrix in the same kernel.
+ */
+template <typename executor_t, typename scalar_t, typename index_t>
+typename executor_t::policy_t::event_t _complex_split(
+    executor_t &ex, complex_buffer_t<scalar_t> _src, index_t _ld, index_t _rows,
+    index_t _cols, bool _conj, BufferIterator<scalar_t, codeplay_policy> _re,
+    BufferIterator<scalar_t, codeplay_policy> _im,
+    BufferIterator<scalar_t, codeplay_policy> _sum) {
+  const index_t size = (_rows > 0 && _cols > 0) ? _ld * (_cols - 1) + _rows : 0;
+  if (size == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+  auto src = _complex_as_real(_src);
+  auto vsrc_re = make_vector_view(ex, src, index_t(2), size);
+  auto vsrc_im = make_vector_view(ex, src + 1, index_t(2), size);
+  auto vre = make_vector_view(ex, _re, index_t(1), size);
+  auto vim = make_vector_view(ex, _im, index_t(1), size);
+  auto vsum = make_vector_view(ex, _sum, index_t(1), size);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(
+      _conj ? scalar_t(-1) : scalar_t(1), vsrc_im);
+  auto addOp = make_op<BinaryOp, AddOperator>(vsrc_re, scalOp);
+  auto assignOp1 = make_op<DoubleAssign>(vre, vim, vsrc_re, scalOp);
+  auto assignOp2 = make_op<Assign>(vsum, addOp);
+  auto joinOp = make_op<Join>(assignOp1, assignOp2);
+  return ex.execute(joinOp);
+}
+
+/**
+ * \brief AXPY for complex vectors, y = alpha * x + y, in a single kernel
+ * updating the real and imaginary parts of y.
+ */
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy(
+    executor_t &ex, index_t _N, std::complex<scalar_t> _alpha,
+    complex_buffer_t<scalar_t> _vx, increment_t _incx,
+    complex_buffer_t<scalar_t> _vy, increment_t _incy) {
+  const increment_t incx = 2 * _incx;
+  const increment_t incy = 2 * _incy;
+  auto x = _complex_as_real(_vx);
+  auto y = _complex_as_real(_vy);
+  auto vx_re = make_vector_view(ex, x, incx, _N);
+  auto vx_im = make_vector_view(ex, x + 1, incx, _N);
+  auto vy_re = make_vector_view(ex, y, incy, _N);
+  auto vy_im = make_vector_view(ex, y + 1, incy, _N);
+
+  auto scalOp1 = make_op<ScalarOp, ProductOperator>(_alpha.real(), vx_re);
+  auto scalOp2 = make_op<ScalarOp, ProductOperator>(-_alpha.imag(), vx_im);
+  auto scalOp3 = make_op<ScalarOp, ProductOperator>(_alpha.real(), vx_im);
+  auto scalOp4 = make_op<ScalarOp, ProductOperator>(_alpha.imag(), vx_re);
+  auto addOp12 = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
+  auto addOp34 = make_op<BinaryOp, AddOperator>(scalOp3, scalOp4);
+  auto addOpRe = make_op<BinaryOp, AddOperator>(vy_re, addOp12);
+  auto addOpIm = make_op<BinaryOp, AddOperator>(vy_im, addOp34);
+  auto assignOp = make_op<DoubleAssign>(vy_re, vy_im, addOpRe, addOpIm);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
+/**
+ * \brief Inner product of two complex vectors, x being conjugated when Conj
+ * is true. The real and imaginary parts are two reductions.
+ */
+template <bool Conj, typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _dot_complex(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, complex_buffer_t<scalar_t> _vy, increment_t _incy,
+    complex_buffer_t<scalar_t> _rs) {
+  const increment_t incx = 2 * _incx;
+  const increment_t incy = 2 * _incy;
+  auto x = _complex_as_real(_vx);
+  auto y = _complex_as_real(_vy);
+  auto r = _complex_as_real(_rs);
+  auto vx_re = make_vector_view(ex, x, incx, _N);
+  auto vx_im = make_vector_view(ex, x + 1, incx, _N);
+  auto vy_re = make_vector_view(ex, y, incy, _N);
+  auto vy_im = make_vector_view(ex, y + 1, incy, _N);
+  auto rs_re = make_vector_view(ex, r, static_cast<increment_t>(1),
+                                static_cast<index_t>(1));
+  auto rs_im = make_vector_view(ex, r + 1, static_cast<increment_t>(1),
+                                static_cast<index_t>(1));
+
+  // x * y = (xr yr - xi yi) + i (xr yi + xi yr), conjugating x changes the
+  // sign of the terms in xi
+  const scalar_t sign = Conj ? scalar_t(1) : scalar_t(-1);
+  auto prdOpRR = make_op<BinaryOp, ProductOperator>(vx_re, vy_re);
+  auto prdOpII = make_op<BinaryOp, ProductOperator>(vx_im, vy_im);
+  auto prdOpRI = make_op<BinaryOp, ProductOperator>(vx_re, vy_im);
+  auto prdOpIR = make_op<BinaryOp, ProductOperator>(vx_im, vy_re);
+  auto scalOpII = make_op<ScalarOp, ProductOperator>(sign, prdOpII);
+  auto scalOpIR = make_op<ScalarOp, ProductOperator>(-sign, prdOpIR);
+  auto addOpRe = make_op<BinaryOp, AddOperator>(prdOpRR, scalOpII);
+  auto addOpIm = make_op<BinaryOp, AddOperator>(prdOpRI, scalOpIR);
+
+  const auto localSize = ex.get_policy_handler().get_work_group_size();
+  const auto nWG = 2 * localSize;
+  auto assignOpRe = make_AssignReduction<AddOperator>(rs_re, addOpRe, localSize,
+                                                      localSize * nWG);
+  auto assignOpIm = make_AssignReduction<AddOperator>(rs_im, addOpIm, localSize,
+                                                      localSize * nWG);
+  auto ret0 = ex.execute(assignOpRe);
+  auto ret1 = ex.execute(assignOpIm);
+  return blas::concatenate_vectors(ret0, ret1);
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _dot(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, complex_buffer_t<scalar_t> _vy, increment_t _incy,
+    complex_buffer_t<scalar_t> _rs) {
+  return _dot_complex<false>(ex, _N, _vx, _incx, _vy, _incy, _rs);
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _dotc(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, complex_buffer_t<scalar_t> _vy, increment_t _incy,
+    complex_buffer_t<scalar_t> _rs) {
+  return _dot_complex<true>(ex, _N, _vx, _incx, _vy, _incy, _rs);
+}
+
+/**
+ * \brief NRM2 of a complex vector, the square root of the sum of the squares
+ * of the real and imaginary parts.
+ */
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _nrm2(
+    executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+    increment_t _incx, BufferIterator<scalar_t, codeplay_policy> _rs) {
+  const increment_t incx = 2 * _incx;
+  auto x = _complex_as_real(_vx);
+  auto vx_re = make_vector_view(ex, x, incx, _N);
+  auto vx_im = make_vector_view(ex, x + 1, incx, _N);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             static_cast<index_t>(1));
+  auto sqrOpRe = make_op<UnaryOp, SquareOperator>(vx_re);
+  auto sqrOpIm = make_op<UnaryOp, SquareOperator>(vx_im);
+  auto addOp = make_op<BinaryOp, AddOperator>(sqrOpRe, sqrOpIm);
+
+  const auto localSize = ex.get_policy_handler().get_work_group_size();
+  const auto nWG = 2 * localSize;
+  auto assignOp =
+      make_AssignReduction<AddOperator>(rs, addOp, localSize, localSize * nWG);
+  auto ret0 = ex.execute(assignOp);
+  auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
+  auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
+  auto ret1 = ex.execute(assignOpFinal);
+  return blas::concatenate_vectors(ret0, ret1);
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+std::complex<scalar_t> _dot(executor_t &ex, index_t _N,
+                            complex_buffer_t<scalar_t> _vx, increment_t _incx,
+                            complex_buffer_t<scalar_t> _vy, increment_t _incy) {
+  using element_t = std::complex<scalar_t>;
+  auto res = std::vector<element_t>(1);
+  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy, gpu_res);
+  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  return res[0];
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+std::complex<scalar_t> _dotc(executor_t &ex, index_t _N,
+                             complex_buffer_t<scalar_t> _vx, increment_t _incx,
+                             complex_buffer_t<scalar_t> _vy,
+                             increment_t _incy) {
+  using element_t = std::complex<scalar_t>;
+  auto res = std::vector<element_t>(1);
+  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  blas::internal::_dotc(ex, _N, _vx, _incx, _vy, _incy, gpu_res);
+  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  return res[0];
+}
+
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+scalar_t _nrm2(executor_t &ex, index_t _N, complex_buffer_t<scalar_t> _vx,
+               increment_t _incx) {
+  auto res = std::vector<scalar_t>(1, scalar_t(0));
+  auto gpu_res = make_sycl_iterator_buffer<scalar_t>(static_cast<index_t>(1));
+  blas::internal::_nrm2(ex, _N, _vx, _incx, gpu_res);
+  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  return res[0];
+}
+
+/*!
+ * @brief Complex GEMV.
+ *
+ * A is read as a real matrix R of 2 * M rows whose even rows are the real
+ * parts of A and odd rows the imaginary parts, so the products are real GEMVs
+ * on A itself:
+ *  - for 'n', A x = R re(x) + i R im(x), R re(x) and R im(x) being complex
+ *    vectors stored interleaved;
+ *  - for 't' and 'c', op(A) x = R^T z1 + i R^T z2, z1 and z2 being the real
+ *    vectors of 2 * M elements (re(x), s im(x)) and (im(x), -s re(x))
+ *    interleaved, with s = 1 for 'c' and s = -1 for 't'.
+ * The last kernel computes y = alpha * op(A) x + beta * y.
+ */
+template <typename executor_t, typename scalar_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _gemv(
+    executor_t &ex, char _trans, index_t _M, index_t _N,
+    std::complex<scalar_t> _alpha, complex_buffer_t<scalar_t> _mA,
+    index_t _lda, complex_buffer_t<scalar_t> _vx, increment_t _incx,
+    std::complex<scalar_t> _beta, complex_buffer_t<scalar_t> _vy,
+    increment_t _incy) {
+  _trans = tolower(_trans);
+  if (_trans != 'n' && _trans != 't' && _trans != 'c') {
+    throw std::invalid_argument("invalid _trans");
+  }
+  const index_t y_size = (_trans == 'n') ? _M : _N;
+  if (_M == 0 || _N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  auto a = _complex_as_real(_mA);
+  auto x = _complex_as_real(_vx);
+  const index_t m2 = 2 * _M;
+  const index_t lda2 = 2 * _lda;
+  const increment_t incx = 2 * _incx;
+  const increment_t one = 1;
+  const increment_t two = 2;
+  auto y = make_matrix_view<col_major>(ex, _complex_as_real(_vy), index_t(2),
+                                       y_size, static_cast<index_t>(2 * _incy));
+  typename executor_t::policy_t::event_t ret;
+
+  if (_trans == 'n') {
+    auto u = make_sycl_iterator_buffer<scalar_t>(m2);
+    auto v = make_sycl_iterator_buffer<scalar_t>(m2);
+    ret = concatenate_vectors(
+        ret, internal::_gemv(ex, 'n', m2, _N, scalar_t(1), a, lda2, x, incx,
+                             scalar_t(0), u, one));
+    ret = concatenate_vectors(
+        ret, internal::_gemv(ex, 'n', m2, _N, scalar_t(1), a, lda2, x + 1,
+                             incx, scalar_t(0), v, one));
+    auto vu_re = make_vector_view(ex, u, two, _M);
+    auto vu_im = make_vector_view(ex, u + 1, two, _M);
+    auto vv_re = make_vector_view(ex, v, two, _M);
+    auto vv_im = make_vector_view(ex, v + 1, two, _M);
+    auto scalOp = make_op<ScalarOp, ProductOperator>(scalar_t(-1), vv_im);
+    auto w_re = make_op<BinaryOp, AddOperator>(vu_re, scalOp);
+    auto w_im = make_op<BinaryOp, AddOperator>(vu_im, vv_re);
+    auto scaleAddOp = make_complex_scale_add(
+        y, index_t(1), w_re, w_im, _alpha.real(), _alpha.imag(), _beta.real(),
+        _beta.imag());
+    ret = concatenate_vectors(ret, ex.execute(scaleAddOp));
+  } else {
+    const scalar_t sign = (_trans == 'c') ? scalar_t(1) : scalar_t(-1);
+    auto z1 = make_sycl_iterator_buffer<scalar_t>(m2);
+    auto z2 = make_sycl_iterator_buffer<scalar_t>(m2);
+    auto vx_re = make_vector_view(ex, x, incx, _M);
+    auto vx_im = make_vector_view(ex, x + 1, incx, _M);
+    auto vz1_re = make_vector_view(ex, z1, two, _M);
+    auto vz1_im = make_vector_view(ex, z1 + 1, two, _M);
+    auto vz2_re = make_vector_view(ex, z2, two, _M);
+    auto vz2_im = make_vector_view(ex, z2 + 1, two, _M);
+    auto scalOp1 = make_op<ScalarOp, ProductOperator>(sign, vx_im);
+    auto scalOp2 = make_op<ScalarOp, ProductOperator>(-sign, vx_re);
+    auto assignOp1 = make_op<DoubleAssign>(vz1_re, vz1_im, vx_re, scalOp1);
+    auto assignOp2 = make_op<DoubleAssign>(vz2_re, vz2_im, vx_im, scalOp2);
+    auto joinOp = make_op<Join>(assignOp1, assignOp2);
+    ret = concatenate_vectors(ret, ex.execute(joinOp));
+
+    auto p = make_sycl_iterator_buffer<scalar_t>(_N);
+    auto q = make_sycl_iterator_buffer<scalar_t>(_N);
+    ret = concatenate_vectors(
+        ret, internal::_gemv(ex, 't', m2, _N, scalar_t(1), a, lda2, z1, one,
+                             scalar_t(0), p, one));
+    ret = concatenate_vectors(
+        ret, internal::_gemv(ex, 't', m2, _N, scalar_t(1), a, lda2, z2, one,
+                             scalar_t(0), q, one));
+    auto w_re = make_vector_view(ex, p, one, _N);
+    auto w_im = make_vector_view(ex, q, one, _N);
+    auto scaleAddOp = make_complex_scale_add(
+        y, index_t(1), w_re, w_im, _alpha.real(), _alpha.imag(), _beta.real(),
+        _beta.imag());
+    ret = concatenate_vectors(ret, ex.execute(scaleAddOp));
+  }
+  return ret;
+}
+
+/*!
+ * @brief Complex GEMM.
+ *
+ * The real and imaginary parts of A and B are first copied to separate real
+ * matrices, the imaginary part being negated for a conjugate transpose, so
+ * that op(A) op(B) is computed with real GEMMs:
+ *  - four_m: re = Ar Br - Ai Bi and im = Ar Bi + Ai Br;
+ *  - three_m: with T1 = Ar Br, T2 = Ai Bi and T3 = (Ar + Ai) (Br + Bi),
+ *    re = T1 - T2 and im = T3 - T1 - T2.
+ * The last kernel computes C = alpha * op(A) op(B) + beta * C, only touching
+ * the M first rows of each column of C.
+ */
+template <typename executor_t, typename scalar_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t &ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, std::complex<scalar_t> _alpha, complex_buffer_t<scalar_t> a_,
+    index_t _lda, complex_buffer_t<scalar_t> b_, index_t _ldb,
+    std::complex<scalar_t> _beta, complex_buffer_t<scalar_t> _C,
+    index_t _ldc, complex_gemm_t _algorithm) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  if (_M == 0 || _N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  const bool three_m = _algorithm == complex_gemm_t::three_m;
+  const char trans_a = (_TransA == 'n') ? 'n' : 't';
+  const char trans_b = (_TransB == 'n') ? 'n' : 't';
+  const index_t rows_a = (_TransA == 'n') ? _M : _K;
+  const index_t cols_a = (_TransA == 'n') ? _K : _M;
+  const index_t rows_b = (_TransB == 'n') ? _K : _N;
+  const index_t cols_b = (_TransB == 'n') ? _N : _K;
+  const index_t size_a = std::max(index_t(1), _lda * cols_a);
+  const index_t size_b = std::max(index_t(1), _ldb * cols_b);
+  const index_t size_c = _M * _N;
+  typename executor_t::policy_t::event_t ret;
+
+  auto a_re = make_sycl_iterator_buffer<scalar_t>(size_a);
+  auto a_im = make_sycl_iterator_buffer<scalar_t>(size_a);
+  auto b_re = make_sycl_iterator_buffer<scalar_t>(size_b);
+  auto b_im = make_sycl_iterator_buffer<scalar_t>(size_b);
+  auto c = make_matrix_view<col_major>(ex, _complex_as_real(_C), 2 * _M, _N,
+                                       2 * _ldc);
+
+  if (three_m) {
+    auto a_sum = make_sycl_iterator_buffer<scalar_t>(size_a);
+    auto b_sum = make_sycl_iterator_buffer<scalar_t>(size_b);
+    ret = concatenate_vectors(
+        ret, _complex_split(ex, a_, _lda, rows_a, cols_a, _TransA == 'c', a_re,
+                            a_im, a_sum));
+    ret = concatenate_vectors(
+        ret, _complex_split(ex, b_, _ldb, rows_b, cols_b, _TransB == 'c', b_re,
+                            b_im, b_sum));
+
+    auto t1 = make_sycl_iterator_buffer<scalar_t>(size_c);
+    auto t2 = make_sycl_iterator_buffer<scalar_t>(size_c);
+    auto t3 = make_sycl_iterator_buffer<scalar_t>(size_c);
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, _M, _N, _K, scalar_t(1),
+                             a_re, _lda, b_re, _ldb, scalar_t(0), t1, _M));
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, _M, _N, _K, scalar_t(1),
+                             a_im, _lda, b_im, _ldb, scalar_t(0), t2, _M));
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, _M, _N, _K, scalar_t(1),
+                             a_sum, _lda, b_sum, _ldb, scalar_t(0), t3, _M));
+
+    auto vt1 = make_vector_view(ex, t1, index_t(1), size_c);
+    auto vt2 = make_vector_view(ex, t2, index_t(1), size_c);
+    auto vt3 = make_vector_view(ex, t3, index_t(1), size_c);
+    auto scalOp1 = make_op<ScalarOp, ProductOperator>(scalar_t(-1), vt1);
+    auto scalOp2 = make_op<ScalarOp, ProductOperator>(scalar_t(-1), vt2);
+    auto w_re = make_op<BinaryOp, AddOperator>(vt1, scalOp2);
+    auto addOp = make_op<BinaryOp, AddOperator>(vt3, scalOp1);
+    auto w_im = make_op<BinaryOp, AddOperator>(addOp, scalOp2);
+    auto scaleAddOp =
+        make_complex_scale_add(c, _M, w_re, w_im, _alpha.real(),
+                               _alpha.imag(), _beta.real(), _beta.imag());
+    ret = concatenate_vectors(ret, ex.execute(scaleAddOp));
+  } else {
+    ret = concatenate_vectors(
+        ret, _complex_split(ex, a_, _lda, rows_a, cols_a, _TransA == 'c', a_re,
+                            a_im));
+    ret = concatenate_vectors(
+        ret, _complex_split(ex, b_, _ldb, rows_b, cols_b, _TransB == 'c', b_re,
+                            b_im));
+
+    auto p_re = make_sycl_iterator_buffer<scalar_t>(size_c);
+    auto p_im = make_sycl_iterator_buffer<scalar_t>(size_c);
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, _M, _N, _K, scalar_t(1),
+                             a_re, _lda, b_re, _ldb, scalar_t(0), p_re, _M));
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, _M, _N, _K, scalar_t(-1),
+                             a_im, _lda, b_im, _ldb, scalar_t(1), p_re, _M));
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, _M, _N, _K, scalar_t(1),
+                             a_re, _lda, b_im, _ldb, scalar_t(0), p_im, _M));
+    ret = concatenate_vectors(
+        ret, internal::_gemm(ex, trans_a, trans_b, _M, _N, _K, scalar_t(1),
+                             a_im, _lda, b_re, _ldb, scalar_t(1), p_im, _M));
+
+    auto w_re = make_vector_view(ex, p_re, index_t(1), size_c);
+    auto w_im = make_vector_view(ex, p_im, index_t(1), size_c);
+    auto scaleAddOp =
+        make_complex_scale_add(c, _M, w_re, w_im, _alpha.real(),
+                               _alpha.imag(), _beta.real(), _beta.imag());
+    ret = concatenate_vectors(ret, ex.execute(scaleAddOp));
+  }
+  return ret;
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_COMPLEX_INTERFACE_HPP
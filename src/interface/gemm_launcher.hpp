@@ -55,7 +55,18 @@ Gemm_Launcher<WgSize, DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, TransA,
                 TransB, GemmMemoryType, GemmAlgorithm, is_beta_zero>(
           buffer_a, buffer_b, buffer_c, element_t(_alpha), element_t(_beta),
           batch_size);
-  return ex.execute(gemm);
+  auto ret = ex.execute(gemm);
+  // The configuration is numbered once per instantiation, and the work of
+  // beta counted when the kernel applies it
+  static const auto slot = RuntimeStatistics::gemm_slot(
+      internal::get_tree_name<decltype(gemm)>(0));
+  ex.get_statistics().record_gemm(
+      slot,
+      static_cast<double>(batch_size) *
+          internal::gemm_work<element_t>(_M, _N, _K,
+                                         element_t(is_beta_zero ? 0 : 1)),
+      ret);
+  return ret;
 }
 
 }  // namespace blas
@@ -0,0 +1,637 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_interface.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_LAPACK_INTERFACE_HPP
+#define SYCL_BLAS_LAPACK_INTERFACE_HPP
+
+#include "blas_meta.h"
+#include "executors/executor.h"
+#include "interface/blas1_interface.hpp"
+#include "interface/blas2_interface.hpp"
+#include "interface/blas3_interface.hpp"
+#include "interface/lapack_interface.h"
+#include "operations/lapack_trees.h"
+#include "policy/sycl_policy_handler.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace blas {
+namespace internal {
+
+/*!
+ * @brief Factors a batch of matrices in local memory, one per work group.
+ *
+ * @param mA view of the matrices, in lower form (see LocalPotrf)
+ */
+template <bool Lower, typename executor_t, typename matrix_t, typename index_t>
+typename executor_t::policy_t::event_t _potrf_local(executor_t& ex,
+                                                    matrix_t mA, index_t _N,
+                                                    index_t batch_size) {
+  const index_t wgSize = ex.get_policy_handler().get_work_group_size();
+  const index_t localSize = std::min(wgSize, _N * _N);
+  const index_t globalSize = batch_size * localSize;
+  const index_t localMemSize = _N * _N;
+  auto potrf = make_local_potrf<Lower>(mA, _N, batch_size);
+  return ex.execute(potrf, localSize, globalSize, localMemSize);
+}
+
+/*!
+ * @brief Implementation of the blocked Cholesky factorization.
+ *
+ * The algorithm is the left-looking blocked variant of LAPACK. For each block
+ * column j, expressed on the lower triangle:
+ *  - A[j, j] -= L[j, 0:j] * L[j, 0:j]^T, with a GEMMT on its lower triangle
+ *  - A[j, j] = L[j, j] * L[j, j]^T, in a local memory kernel
+ *  - A[j+1:, j] -= L[j+1:, 0:j] * L[j, 0:j]^T, with a GEMM
+ *  - L[j+1:, j] = A[j+1:, j] * L[j, j]^-T, with a TRSM
+ * The upper case applies the transposed operations to the upper triangle. The
+ * local memory kernel reads it through row major views.
+ */
+template <bool Lower, typename executor_t, typename container_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _potrf_impl(executor_t& ex, index_t _N,
+                                                   container_t a_,
+                                                   index_t _lda,
+                                                   index_t _block_size) {
+  using element_t = typename ValueType<container_t>::type;
+  typename executor_t::policy_t::event_t ret{};
+  static constexpr auto layout_access =
+      Choose<Lower, access_layout, access_layout::col_major,
+             access_layout::row_major>::type;
+  using layout_t = typename Layout<layout_access>::type;
+  const index_t block_size = (_block_size == 0) ? index_t(32) : _block_size;
+
+  for (index_t j0 = 0; j0 < _N; j0 += block_size) {
+    const index_t jb = std::min(block_size, _N - j0);
+    if (j0 > 0 && Lower) {
+      ret = concatenate_vectors(
+          ret, internal::_gemmt(ex, 'l', 'n', 't', jb, j0, element_t(-1),
+                                a_ + j0, _lda, a_ + j0, _lda, element_t(1),
+                                a_ + (j0 + j0 * _lda), _lda));
+    } else if (j0 > 0) {
+      ret = concatenate_vectors(
+          ret, internal::_gemmt(ex, 'u', 't', 'n', jb, j0, element_t(-1),
+                                a_ + j0 * _lda, _lda, a_ + j0 * _lda, _lda,
+                                element_t(1), a_ + (j0 + j0 * _lda), _lda));
+    }
+    auto mD = make_matrix_view<layout_t>(ex, a_ + (j0 + j0 * _lda), jb, jb,
+                                         _lda);
+    ret = concatenate_vectors(ret,
+                              _potrf_local<Lower>(ex, mD, jb, index_t(1)));
+
+    const index_t r0 = j0 + jb;
+    const index_t rn = _N - r0;
+    if (rn == 0) {
+      continue;
+    }
+    if (Lower) {
+      if (j0 > 0) {
+        ret = concatenate_vectors(
+            ret, _gemm_backend(ex, 'n', 't', rn, jb, j0, element_t(-1),
+                               a_ + r0, _lda, a_ + j0, _lda, element_t(1),
+                               a_ + (r0 + j0 * _lda), _lda, index_t(1)));
+      }
+      ret = concatenate_vectors(
+          ret, internal::_trsm(ex, 'r', 'l', 't', 'n', rn, jb, element_t(1),
+                               a_ + (j0 + j0 * _lda), _lda,
+                               a_ + (r0 + j0 * _lda), _lda, jb));
+    } else {
+      if (j0 > 0) {
+        ret = concatenate_vectors(
+            ret, _gemm_backend(ex, 't', 'n', jb, rn, j0, element_t(-1),
+                               a_ + j0 * _lda, _lda, a_ + r0 * _lda, _lda,
+                               element_t(1), a_ + (j0 + r0 * _lda), _lda,
+                               index_t(1)));
+      }
+      ret = concatenate_vectors(
+          ret, internal::_trsm(ex, 'l', 'u', 't', 'n', jb, rn, element_t(1),
+                               a_ + (j0 + j0 * _lda), _lda,
+                               a_ + (j0 + r0 * _lda), _lda, jb));
+    }
+  }
+  return ret;
+}
+
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _potrf(executor_t& ex, char _Uplo,
+                                              index_t _N, container_t a_,
+                                              index_t _lda,
+                                              index_t _block_size) {
+  _Uplo = tolower(_Uplo);
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_lda < std::max(index_t(1), _N)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_block_size < 0) {
+    throw std::invalid_argument("invalid _block_size");
+  }
+
+  if (_N == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  if (_Uplo == 'l') {
+    return _potrf_impl<true>(ex, _N, a_, _lda, _block_size);
+  } else {
+    return _potrf_impl<false>(ex, _N, a_, _lda, _block_size);
+  }
+}
+
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _potrf_batched(executor_t& ex,
+                                                      char _Uplo, index_t _N,
+                                                      container_t a_,
+                                                      index_t _lda,
+                                                      index_t batch_size) {
+  _Uplo = tolower(_Uplo);
+  if (_Uplo != 'u' && _Uplo != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_N < 0 || _N > 32) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_lda < std::max(index_t(1), _N)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (batch_size < 0) {
+    throw std::invalid_argument("invalid batch_size");
+  }
+
+  if (_N == 0 || batch_size == 0) {
+    return typename executor_t::policy_t::event_t{};
+  }
+
+  // In lower form the matrices are consecutive columns (lower) or rows (upper)
+  // of a single view, see LocalPotrf
+  if (_Uplo == 'l') {
+    auto mA = make_matrix_view<col_major>(ex, a_, _N, _N * batch_size, _lda);
+    return _potrf_local<true>(ex, mA, _N, batch_size);
+  } else {
+    auto mA = make_matrix_view<row_major>(ex, a_, _N * batch_size, _N, _lda);
+    return _potrf_local<false>(ex, mA, _N, batch_size);
+  }
+}
+
+/*!
+ * @brief Recursive factorization of the panel made of the columns
+ * [_J, _J + _Nb) and the rows [_J, _M) of the matrix.
+ *
+ * The pivot of a single column is searched with IAMAX and read back on the
+ * host; the rows are then interchanged across the whole matrix, so that no
+ * interchange is left to apply afterwards. Wider panels are split in two: the
+ * right half is updated with a TRSM and a GEMM once the left half is factored.
+ *
+ * @param rs_ device buffer of one IndexValueTuple, receiving the pivot
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename tuple_container_t>
+typename executor_t::policy_t::event_t _getrf_panel(
+    executor_t& ex, index_t _M, index_t _N, container_t a_, index_t _lda,
+    index_t* _ipiv, index_t _J, index_t _Nb, tuple_container_t rs_) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<index_t, element_t>;
+  typename executor_t::policy_t::event_t ret{};
+
+  if (_Nb == 1) {
+    IndValTuple pivot(index_t(0), element_t(0));
+    internal::_iamax(ex, _M - _J, a_ + (_J + _J * _lda), index_t(1), rs_);
+    auto event = ex.get_policy_handler().copy_to_host(rs_, &pivot, 1);
+    ex.get_policy_handler().wait(event);
+
+    const index_t p = _J + pivot.get_index();
+    _ipiv[_J] = p;
+    if (p != _J) {
+      ret = concatenate_vectors(
+          ret, internal::_swap(ex, _N, a_ + _J, _lda, a_ + p, _lda));
+    }
+    // A zero pivot means the matrix is singular, the column is left as is
+    if (pivot.get_value() != element_t(0) && _M - _J > 1) {
+      ret = concatenate_vectors(
+          ret, internal::_scal(ex, _M - _J - 1,
+                               element_t(1) / pivot.get_value(),
+                               a_ + (_J + 1 + _J * _lda), index_t(1)));
+    }
+    return ret;
+  }
+
+  const index_t n1 = _Nb / 2;
+  const index_t n2 = _Nb - n1;
+  const index_t j1 = _J + n1;
+  ret = concatenate_vectors(
+      ret, _getrf_panel(ex, _M, _N, a_, _lda, _ipiv, _J, n1, rs_));
+  ret = concatenate_vectors(
+      ret, internal::_trsm(ex, 'l', 'l', 'n', 'u', n1, n2, element_t(1),
+                           a_ + (_J + _J * _lda), _lda, a_ + (_J + j1 * _lda),
+                           _lda, index_t(0)));
+  if (_M > j1) {
+    ret = concatenate_vectors(
+        ret, _gemm_backend(ex, 'n', 'n', _M - j1, n2, n1, element_t(-1),
+                           a_ + (j1 + _J * _lda), _lda, a_ + (_J + j1 * _lda),
+                           _lda, element_t(1), a_ + (j1 + j1 * _lda), _lda,
+                           index_t(1)));
+  }
+  ret = concatenate_vectors(
+      ret, _getrf_panel(ex, _M, _N, a_, _lda, _ipiv, j1, n2, rs_));
+  return ret;
+}
+
+template <typename executor_t, typename container_t, typename index_t>
+typename executor_t::policy_t::event_t _getrf(executor_t& ex, index_t _M,
+                                              index_t _N, container_t a_,
+                                              index_t _lda, index_t* _ipiv,
+                                              index_t _block_size) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<index_t, element_t>;
+  if (_M < 0) {
+    throw std::invalid_argument("invalid _M");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_lda < std::max(index_t(1), _M)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_block_size < 0) {
+    throw std::invalid_argument("invalid _block_size");
+  }
+
+  typename executor_t::policy_t::event_t ret{};
+  const index_t K = std::min(_M, _N);
+  if (K == 0) {
+    return ret;
+  }
+
+  // Right-looking blocked algorithm: the panel is factored, then the block
+  // row on its right is solved and the trailing matrix updated
+  const index_t block_size = (_block_size == 0) ? index_t(32) : _block_size;
+  auto rs = make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
+  for (index_t j0 = 0; j0 < K; j0 += block_size) {
+    const index_t jb = std::min(block_size, K - j0);
+    const index_t r0 = j0 + jb;
+    ret = concatenate_vectors(
+        ret, _getrf_panel(ex, _M, _N, a_, _lda, _ipiv, j0, jb, rs));
+    if (r0 == _N) {
+      continue;
+    }
+    ret = concatenate_vectors(
+        ret, internal::_trsm(ex, 'l', 'l', 'n', 'u', jb, _N - r0,
+                             element_t(1), a_ + (j0 + j0 * _lda), _lda,
+                             a_ + (j0 + r0 * _lda), _lda, index_t(0)));
+    if (_M > r0) {
+      ret = concatenate_vectors(
+          ret, _gemm_backend(ex, 'n', 'n', _M - r0, _N - r0, jb,
+                             element_t(-1), a_ + (r0 + j0 * _lda), _lda,
+                             a_ + (j0 + r0 * _lda), _lda, element_t(1),
+                             a_ + (r0 + r0 * _lda), _lda, index_t(1)));
+    }
+  }
+  return ret;
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _getrs(executor_t& ex, char _Trans,
+                                              index_t _N, index_t _NRHS,
+                                              container_0_t a_, index_t _lda,
+                                              const index_t* _ipiv,
+                                              container_1_t b_, index_t _ldb) {
+  using element_t = typename ValueType<container_0_t>::type;
+  _Trans = tolower(_Trans);
+  if (_Trans != 'n' && _Trans != 't' && _Trans != 'c') {
+    throw std::invalid_argument("invalid _Trans");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_NRHS < 0) {
+    throw std::invalid_argument("invalid _NRHS");
+  } else if (_lda < std::max(index_t(1), _N)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_ldb < std::max(index_t(1), _N)) {
+    throw std::invalid_argument("invalid _ldb");
+  }
+
+  typename executor_t::policy_t::event_t ret{};
+  if (_N == 0 || _NRHS == 0) {
+    return ret;
+  }
+
+  if (_Trans == 'n') {
+    // X = U^-1 * L^-1 * P^T * B
+    for (index_t i = 0; i < _N; i++) {
+      if (_ipiv[i] != i) {
+        ret = concatenate_vectors(
+            ret, internal::_swap(ex, _NRHS, b_ + i, _ldb, b_ + _ipiv[i],
+                                 _ldb));
+      }
+    }
+    ret = concatenate_vectors(
+        ret, internal::_trsm(ex, 'l', 'l', 'n', 'u', _N, _NRHS, element_t(1),
+                             a_, _lda, b_, _ldb, index_t(0)));
+    ret = concatenate_vectors(
+        ret, internal::_trsm(ex, 'l', 'u', 'n', 'n', _N, _NRHS, element_t(1),
+                             a_, _lda, b_, _ldb, index_t(0)));
+  } else {
+    // X = P * L^-T * U^-T * B
+    ret = concatenate_vectors(
+        ret, internal::_trsm(ex, 'l', 'u', 't', 'n', _N, _NRHS, element_t(1),
+                             a_, _lda, b_, _ldb, index_t(0)));
+    ret = concatenate_vectors(
+        ret, internal::_trsm(ex, 'l', 'l', 't', 'u', _N, _NRHS, element_t(1),
+                             a_, _lda, b_, _ldb, index_t(0)));
+    for (index_t i = _N - 1; i >= 0; i--) {
+      if (_ipiv[i] != i) {
+        ret = concatenate_vectors(
+            ret, internal::_swap(ex, _NRHS, b_ + i, _ldb, b_ + _ipiv[i],
+                                 _ldb));
+      }
+    }
+  }
+  return ret;
+}
+
+/*!
+ * @brief Unblocked Householder QR factorization of the M x N panel A, with
+ * M >= N.
+ *
+ * For each column, the norm below the diagonal is computed with NRM2 and read
+ * back on the host together with the diagonal element, to form the reflector
+ * as LAPACK's larfg does. The reflector is then applied to the rest of the
+ * panel with a GEMV and a GER, its unit first element being temporarily
+ * stored on the diagonal.
+ */
+template <typename executor_t, typename container_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _geqr2(executor_t& ex, index_t _M,
+                                              index_t _N, container_t a_,
+                                              index_t _lda, element_t* _tau) {
+  typename executor_t::policy_t::event_t ret{};
+  auto rs = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  std::vector<element_t> zeros(_N, element_t(0));
+  auto w = make_sycl_iterator_buffer<element_t>(_N);
+  // GEMV reads its output even though beta is zero, so it must not be NaN
+  auto event = ex.get_policy_handler().copy_to_device(zeros.data(), w, _N);
+  ex.get_policy_handler().wait(event);
+
+  for (index_t c = 0; c < _N; c++) {
+    const index_t rows = _M - c;
+    auto diag = a_ + (c + c * _lda);
+    element_t alpha(0);
+    element_t xnorm(0);
+    event = ex.get_policy_handler().copy_to_host(diag, &alpha, 1);
+    ex.get_policy_handler().wait(event);
+    if (rows > 1) {
+      internal::_nrm2(ex, rows - 1, diag + 1, index_t(1), rs);
+      event = ex.get_policy_handler().copy_to_host(rs, &xnorm, 1);
+      ex.get_policy_handler().wait(event);
+    }
+
+    // H = I when the column is already zero below the diagonal
+    _tau[c] = element_t(0);
+    if (xnorm == element_t(0)) {
+      continue;
+    }
+    element_t beta = -std::copysign(std::hypot(alpha, xnorm), alpha);
+    _tau[c] = (beta - alpha) / beta;
+    ret = concatenate_vectors(
+        ret, internal::_scal(ex, rows - 1, element_t(1) / (alpha - beta),
+                             diag + 1, index_t(1)));
+
+    const index_t nr = _N - c - 1;
+    if (nr > 0) {
+      const element_t one(1);
+      event = ex.get_policy_handler().copy_to_device(&one, diag, 1);
+      ex.get_policy_handler().wait(event);
+      ret = concatenate_vectors(
+          ret, internal::_gemv(ex, 't', rows, nr, element_t(1), diag + _lda,
+                               _lda, diag, index_t(1), element_t(0), w,
+                               index_t(1)));
+      ret = concatenate_vectors(
+          ret, internal::_ger(ex, rows, nr, -_tau[c], diag, index_t(1), w,
+                              index_t(1), diag + _lda, _lda));
+    }
+    event = ex.get_policy_handler().copy_to_device(&beta, diag, 1);
+    ex.get_policy_handler().wait(event);
+  }
+  return ret;
+}
+
+/*!
+ * @brief Forms the triangular factor T of the compact WY representation
+ * I - V * T * V^T of the product of _K reflectors, as LAPACK's larft does.
+ *
+ * V^T * V is computed on the device with a single GEMM, T is then built on
+ * the host from it and from _tau, and copied to t_ (_K x _K, column major).
+ *
+ * @param v_ the _M x _K reflectors, below the diagonal of a_ (see _geqrf)
+ */
+template <typename executor_t, typename container_0_t, typename element_t,
+          typename container_1_t, typename index_t>
+typename executor_t::policy_t::event_t _larft(executor_t& ex, index_t _M,
+                                              index_t _K, container_0_t v_,
+                                              index_t _ldv,
+                                              const element_t* _tau,
+                                              container_1_t t_) {
+  auto mV = make_structured_matrix_view(
+      ex, v_, _M, _K, _ldv, matrix_structure_t::triangular, true, true);
+  auto mG = make_matrix_view<col_major>(ex, t_, _K, _K, _K);
+  auto event = _structured_gemm<true, false, true>(ex, mV, mV, mG,
+                                                   element_t(1), element_t(0));
+  std::vector<element_t> g(_K * _K);
+  event = concatenate_vectors(
+      event, ex.get_policy_handler().copy_to_host(t_, g.data(), _K * _K));
+  ex.get_policy_handler().wait(event);
+
+  // T(0:i, i) = -tau[i] * T(0:i, 0:i) * V(:, 0:i)^T * v_i
+  std::vector<element_t> t(_K * _K, element_t(0));
+  for (index_t i = 0; i < _K; i++) {
+    for (index_t r = 0; r < i; r++) {
+      element_t sum(0);
+      for (index_t q = r; q < i; q++) {
+        sum += t[r + q * _K] * g[q + i * _K];
+      }
+      t[r + i * _K] = -_tau[i] * sum;
+    }
+    t[i + i * _K] = _tau[i];
+  }
+  event = ex.get_policy_handler().copy_to_device(t.data(), t_, _K * _K);
+  ex.get_policy_handler().wait(event);
+  return event;
+}
+
+/*!
+ * @brief Applies the block reflector I - V * T * V^T, or its transpose, to
+ * the _M x _N matrix C from the left or the right, as LAPACK's larfb does:
+ *
+ * C -= V * (op(T) * (V^T * C))  or  C -= ((C * V) * op(T)) * V^T
+ *
+ * V is read through a unit lower triangular structured view, so the upper
+ * part of the panel holding it is never referenced.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename executor_t::policy_t::event_t _larfb(executor_t& ex, char _Side,
+                                              char _Trans, index_t _M,
+                                              index_t _N, index_t _K,
+                                              container_0_t v_, index_t _ldv,
+                                              container_1_t t_,
+                                              container_2_t c_,
+                                              index_t _ldc) {
+  using element_t = typename ValueType<container_2_t>::type;
+  const bool left = _Side == 'l';
+  const index_t nv = left ? _M : _N;
+  const index_t w_rows = left ? _K : _M;
+  const index_t w_cols = left ? _N : _K;
+  auto w = make_sycl_iterator_buffer<element_t>(w_rows * w_cols);
+
+  auto mV = make_structured_matrix_view(
+      ex, v_, nv, _K, _ldv, matrix_structure_t::triangular, true, true);
+  auto mC = make_matrix_view<col_major>(ex, c_, _M, _N, _ldc);
+  auto mW = make_matrix_view<col_major>(ex, w, w_rows, w_cols, w_rows);
+
+  typename executor_t::policy_t::event_t ret{};
+  if (left) {
+    ret = concatenate_vectors(
+        ret, _structured_gemm<true, false, true>(ex, mV, mC, mW, element_t(1),
+                                                 element_t(0)));
+    ret = concatenate_vectors(
+        ret, internal::_trmm(ex, 'l', 'u', _Trans, 'n', _K, _N, element_t(1),
+                             t_, _K, w, _K));
+    ret = concatenate_vectors(
+        ret, _structured_gemm<false, false, false>(
+                 ex, mV, mW, mC, element_t(-1), element_t(1)));
+  } else {
+    ret = concatenate_vectors(
+        ret, _structured_gemm<false, false, true>(ex, mC, mV, mW, element_t(1),
+                                                  element_t(0)));
+    ret = concatenate_vectors(
+        ret, internal::_trmm(ex, 'r', 'u', _Trans, 'n', _M, _K, element_t(1),
+                             t_, _K, w, _M));
+    ret = concatenate_vectors(
+        ret, _structured_gemm<false, true, false>(ex, mW, mV, mC,
+                                                  element_t(-1), element_t(1)));
+  }
+  return ret;
+}
+
+template <typename executor_t, typename container_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _geqrf(executor_t& ex, index_t _M,
+                                              index_t _N, container_t a_,
+                                              index_t _lda, element_t* _tau,
+                                              index_t _block_size) {
+  if (_M < 0) {
+    throw std::invalid_argument("invalid _M");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_lda < std::max(index_t(1), _M)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_block_size < 0) {
+    throw std::invalid_argument("invalid _block_size");
+  }
+
+  typename executor_t::policy_t::event_t ret{};
+  const index_t K = std::min(_M, _N);
+  if (K == 0) {
+    return ret;
+  }
+
+  const index_t block_size = (_block_size == 0) ? index_t(32) : _block_size;
+  auto t = make_sycl_iterator_buffer<element_t>(block_size * block_size);
+  for (index_t j0 = 0; j0 < K; j0 += block_size) {
+    const index_t jb = std::min(block_size, K - j0);
+    const index_t r0 = j0 + jb;
+    auto panel = a_ + (j0 + j0 * _lda);
+    ret = concatenate_vectors(
+        ret, _geqr2(ex, _M - j0, jb, panel, _lda, _tau + j0));
+    if (r0 < _N) {
+      ret = concatenate_vectors(
+          ret, _larft(ex, _M - j0, jb, panel, _lda, _tau + j0, t));
+      ret = concatenate_vectors(
+          ret, _larfb(ex, 'l', 't', _M - j0, _N - r0, jb, panel, _lda, t,
+                      a_ + (j0 + r0 * _lda), _lda));
+    }
+  }
+  return ret;
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _ormqr(
+    executor_t& ex, char _Side, char _Trans, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, const element_t* _tau,
+    container_1_t c_, index_t _ldc, index_t _block_size) {
+  _Side = tolower(_Side);
+  _Trans = tolower(_Trans);
+  const index_t nq = (_Side == 'l') ? _M : _N;
+  if (_Side != 'l' && _Side != 'r') {
+    throw std::invalid_argument("invalid _Side");
+  } else if (_Trans != 'n' && _Trans != 't' && _Trans != 'c') {
+    throw std::invalid_argument("invalid _Trans");
+  } else if (_M < 0) {
+    throw std::invalid_argument("invalid _M");
+  } else if (_N < 0) {
+    throw std::invalid_argument("invalid _N");
+  } else if (_K < 0 || _K > nq) {
+    throw std::invalid_argument("invalid _K");
+  } else if (_lda < std::max(index_t(1), nq)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_ldc < std::max(index_t(1), _M)) {
+    throw std::invalid_argument("invalid _ldc");
+  } else if (_block_size < 0) {
+    throw std::invalid_argument("invalid _block_size");
+  }
+
+  typename executor_t::policy_t::event_t ret{};
+  if (_M == 0 || _N == 0 || _K == 0) {
+    return ret;
+  }
+
+  const bool left = _Side == 'l';
+  const char trans = (_Trans == 'n') ? 'n' : 't';
+  // Q = H(0) * H(1) * ... so Q^T * C and C * Q apply the blocks in order
+  const bool forward = left == (trans == 't');
+  const index_t block_size = (_block_size == 0) ? index_t(32) : _block_size;
+  const index_t nBlocks = (_K - 1) / block_size + 1;
+  auto t = make_sycl_iterator_buffer<element_t>(block_size * block_size);
+  for (index_t blk = 0; blk < nBlocks; blk++) {
+    const index_t i0 = (forward ? blk : nBlocks - 1 - blk) * block_size;
+    const index_t ib = std::min(block_size, _K - i0);
+    auto v = a_ + (i0 + i0 * _lda);
+    ret = concatenate_vectors(
+        ret, _larft(ex, nq - i0, ib, v, _lda, _tau + i0, t));
+    if (left) {
+      ret = concatenate_vectors(ret, _larfb(ex, 'l', trans, _M - i0, _N, ib,
+                                            v, _lda, t, c_ + i0, _ldc));
+    } else {
+      ret = concatenate_vectors(ret,
+                                _larfb(ex, 'r', trans, _M, _N - i0, ib, v,
+                                       _lda, t, c_ + i0 * _ldc, _ldc));
+    }
+  }
+  return ret;
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_LAPACK_INTERFACE_HPP
@@ -0,0 +1,169 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename rank_update.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_RANK_UPDATE_HPP
+#define SYCL_BLAS_RANK_UPDATE_HPP
+
+#include <stdexcept>
+
+#include "container/sycl_iterator.h"
+#include "interface/blas1_interface.h"
+#include "interface/blas3_interface.h"
+#include "interface/rank_update.h"
+
+namespace blas {
+
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+RankUpdateAccumulator<executor_t, container_t, index_t, increment_t>::
+    RankUpdateAccumulator(executor_t& ex, char _Uplo, index_t _M, index_t _N,
+                          container_t _mA, index_t _lda, index_t _max_rank)
+    : ex_(ex),
+      uplo_(tolower(_Uplo)),
+      m_(_M),
+      n_(_N),
+      mA_(_mA),
+      lda_(_lda),
+      max_rank_(_max_rank),
+      rank_(0),
+      mX_(make_sycl_iterator_buffer<element_t>(_M * _max_rank)),
+      mY_(make_sycl_iterator_buffer<element_t>(_N * _max_rank)) {
+  if (uplo_ != 'g' && uplo_ != 'u' && uplo_ != 'l') {
+    throw std::invalid_argument("invalid _Uplo");
+  } else if (_M <= 0 || _N <= 0 || (uplo_ != 'g' && _M != _N)) {
+    throw std::invalid_argument("invalid matrix size");
+  } else if (_lda < _M) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_max_rank <= 0) {
+    throw std::invalid_argument("invalid _max_rank");
+  }
+}
+
+/*!
+ * @brief Stores alpha*x and y in the next columns of X and Y, applying the
+ * pending updates first if X and Y are full.
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+typename RankUpdateAccumulator<executor_t, container_t, index_t,
+                               increment_t>::event_t
+RankUpdateAccumulator<executor_t, container_t, index_t, increment_t>::push(
+    element_t _alpha, container_t _vx, increment_t _incx, container_t _vy,
+    increment_t _incy) {
+  event_t ret;
+  if (rank_ == max_rank_) {
+    ret = concatenate_vectors(ret, flush());
+  }
+  auto colX = mX_ + rank_ * m_;
+  auto colY = mY_ + rank_ * n_;
+  ret = concatenate_vectors(
+      ret, internal::_copy(ex_, m_, _vx, _incx, colX, increment_t(1)));
+  ret = concatenate_vectors(
+      ret, internal::_scal(ex_, m_, _alpha, colX, increment_t(1)));
+  ret = concatenate_vectors(
+      ret, internal::_copy(ex_, n_, _vy, _incy, colY, increment_t(1)));
+  rank_++;
+  return ret;
+}
+
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+typename RankUpdateAccumulator<executor_t, container_t, index_t,
+                               increment_t>::event_t
+RankUpdateAccumulator<executor_t, container_t, index_t, increment_t>::ger(
+    element_t _alpha, container_t _vx, increment_t _incx, container_t _vy,
+    increment_t _incy) {
+  if (uplo_ != 'g') {
+    throw std::invalid_argument("ger requires a general matrix");
+  }
+  return push(_alpha, _vx, _incx, _vy, _incy);
+}
+
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+typename RankUpdateAccumulator<executor_t, container_t, index_t,
+                               increment_t>::event_t
+RankUpdateAccumulator<executor_t, container_t, index_t, increment_t>::syr(
+    element_t _alpha, container_t _vx, increment_t _incx) {
+  if (uplo_ == 'g') {
+    throw std::invalid_argument("syr requires a symmetric matrix");
+  }
+  return push(_alpha, _vx, _incx, _vx, _incx);
+}
+
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+typename RankUpdateAccumulator<executor_t, container_t, index_t,
+                               increment_t>::event_t
+RankUpdateAccumulator<executor_t, container_t, index_t, increment_t>::syr2(
+    element_t _alpha, container_t _vx, increment_t _incx, container_t _vy,
+    increment_t _incy) {
+  if (uplo_ == 'g') {
+    throw std::invalid_argument("syr2 requires a symmetric matrix");
+  }
+  auto ret = push(_alpha, _vx, _incx, _vy, _incy);
+  return concatenate_vectors(ret, push(_alpha, _vy, _incy, _vx, _incx));
+}
+
+/*!
+ * @brief Applies A = X * Y^T + A. X * Y^T is symmetric when the updates are
+ * symmetric, so only the stored triangle of a symmetric A is computed.
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+typename RankUpdateAccumulator<executor_t, container_t, index_t,
+                               increment_t>::event_t
+RankUpdateAccumulator<executor_t, container_t, index_t, increment_t>::flush() {
+  if (rank_ == 0) {
+    return event_t{};
+  }
+  const index_t k = rank_;
+  rank_ = 0;
+  const double m = static_cast<double>(m_);
+  const double n = static_cast<double>(n_);
+  const double rank = static_cast<double>(k);
+  static const auto slot = RuntimeStatistics::routine_slot("_rank_update");
+  if (uplo_ == 'g') {
+    auto ret = internal::_gemm(ex_, 'n', 't', m_, n_, k, element_t(1), mX_, m_,
+                               mY_, n_, element_t(1), mA_, lda_);
+    ex_.get_statistics().record_routine(
+        slot, internal::product_work<element_t>(
+                  2 * rank * m * n, m * n, (m + n) * rank + m * n, false),
+        ret);
+    return ret;
+  }
+  auto ret = internal::_gemmt(ex_, uplo_, 'n', 't', n_, k, element_t(1), mX_,
+                              n_, mY_, n_, element_t(1), mA_, lda_);
+  const double triangle = internal::triangle_elements(n);
+  ex_.get_statistics().record_routine(
+      slot, internal::product_work<element_t>(2 * rank * triangle, triangle,
+                                              2 * n * rank + triangle, false),
+      ret);
+  return ret;
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_RANK_UPDATE_HPP
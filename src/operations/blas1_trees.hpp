@@ -46,6 +46,10 @@ struct DetectScalar {
   static typename element_t::value_t get_scalar(element_t &opSCL) {
     return opSCL.eval(0);
   }
+  static void bind(element_t &opSCL, cl::sycl::handler &h) { opSCL.bind(h); }
+  static void adjust_access_displacement(element_t &opSCL) {
+    opSCL.adjust_access_displacement();
+  }
 };
 
 /*! DetectScalar.
@@ -55,6 +59,8 @@ template <>
 struct DetectScalar<int> {
   using element_t = int;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! DetectScalar.
@@ -64,6 +70,8 @@ template <>
 struct DetectScalar<float> {
   using element_t = float;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! DetectScalar.
@@ -73,6 +81,8 @@ template <>
 struct DetectScalar<double> {
   using element_t = double;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! DetectScalar.
@@ -82,6 +92,8 @@ template <>
 struct DetectScalar<std::complex<float>> {
   using element_t = std::complex<float>;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! DetectScalar.
@@ -91,6 +103,8 @@ template <>
 struct DetectScalar<std::complex<double>> {
   using element_t = std::complex<double>;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! get_scalar.
@@ -101,6 +115,23 @@ auto get_scalar(element_t &scalar_)
     -> decltype(DetectScalar<element_t>::get_scalar(scalar_)) {
   return DetectScalar<element_t>::get_scalar(scalar_);
 }
+
+/*! bind_scalar.
+ * @brief Binds the scalar of a ScalarOp node when it is a view in device
+ * memory, does nothing for a host value.
+ */
+template <typename element_t>
+void bind_scalar(element_t &scalar_, cl::sycl::handler &h) {
+  DetectScalar<element_t>::bind(scalar_, h);
+}
+
+/*! adjust_scalar_access_displacement.
+ * @brief See bind_scalar.
+ */
+template <typename element_t>
+void adjust_scalar_access_displacement(element_t &scalar_) {
+  DetectScalar<element_t>::adjust_access_displacement(scalar_);
+}
 }  // namespace internal
 
 /** Join.
@@ -252,6 +283,83 @@ DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::adjust_access_displacement() {
   rhs_2_.adjust_access_displacement();
 }
 
+/*! ComplexScaleAdd.
+ */
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::ComplexScaleAdd(
+    lhs_t &_l, typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::index_t _rows,
+    rhs_1_t _r1, rhs_2_t _r2,
+    typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::value_t _alpha_re,
+    typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::value_t _alpha_im,
+    typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::value_t _beta_re,
+    typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::value_t _beta_im)
+    : lhs_(_l),
+      rhs_re_(_r1),
+      rhs_im_(_r2),
+      rows_(_rows),
+      alpha_re_(_alpha_re),
+      alpha_im_(_alpha_im),
+      beta_re_(_beta_re),
+      beta_im_(_beta_im) {}
+
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::index_t
+ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::get_size() const {
+  return rhs_re_.get_size();
+}
+
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE bool ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < get_size()));
+}
+
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::value_t
+ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::eval(
+    typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::index_t i) {
+  using value_t = typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::value_t;
+  using index_t = typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::index_t;
+  const index_t col = i / rows_;
+  const index_t row = 2 * (i - col * rows_);
+  const value_t w_re = rhs_re_.eval(i);
+  const value_t w_im = rhs_im_.eval(i);
+  value_t val_re = alpha_re_ * w_re - alpha_im_ * w_im;
+  value_t val_im = alpha_re_ * w_im + alpha_im_ * w_re;
+  if (beta_re_ != value_t(0) || beta_im_ != value_t(0)) {
+    const value_t c_re = lhs_.eval(row, col);
+    const value_t c_im = lhs_.eval(row + 1, col);
+    val_re += beta_re_ * c_re - beta_im_ * c_im;
+    val_im += beta_re_ * c_im + beta_im_ * c_re;
+  }
+  lhs_.eval(row, col) = val_re;
+  lhs_.eval(row + 1, col) = val_im;
+  return val_re;
+}
+
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::value_t
+ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::eval(
+      ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE void ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_re_.bind(h);
+  rhs_im_.bind(h);
+}
+
+template <typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE void
+ComplexScaleAdd<lhs_t, rhs_1_t, rhs_2_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_re_.adjust_access_displacement();
+  rhs_im_.adjust_access_displacement();
+}
+
 /*!ScalarOp.
  * @brief Implements an scalar operation.
  * (e.g alpha OP x, with alpha scalar and x vector)
@@ -285,12 +393,14 @@ ScalarOp<operator_t, scalar_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
 template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE void ScalarOp<operator_t, scalar_t, rhs_t>::bind(
     cl::sycl::handler &h) {
+  internal::bind_scalar(scalar_, h);
   rhs_.bind(h);
 }
 
 template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE void
 ScalarOp<operator_t, scalar_t, rhs_t>::adjust_access_displacement() {
+  internal::adjust_scalar_access_displacement(scalar_);
   rhs_.adjust_access_displacement();
 }
 /*! UnaryOp.
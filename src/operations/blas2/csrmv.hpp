@@ -0,0 +1,418 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename csrmv.hpp
+ *
+ **************************************************************************/
+
+
+#ifndef SYCL_BLAS_BLAS2_CSRMV_HPP
+#define SYCL_BLAS_BLAS2_CSRMV_HPP
+
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+/**** CSRMV ****/
+
+template <typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE Csrmv<matrix_t, vector_t>::Csrmv(matrix_t &_matrix,
+                                                  vector_t &_vector)
+    : matrix_(_matrix), vector_(_vector) {}
+
+template <typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Csrmv<matrix_t, vector_t>::index_t
+Csrmv<matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size_row();
+}
+
+template <typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool Csrmv<matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Csrmv<matrix_t, vector_t>::value_t
+Csrmv<matrix_t, vector_t>::eval(typename Csrmv<matrix_t, vector_t>::index_t i) {
+  const index_t last = matrix_.row_end(i);
+  value_t acc = value_t(0);
+  for (index_t k = matrix_.row_begin(i); k < last; k++) {
+    acc += matrix_.value(k) * vector_.eval(matrix_.col(k));
+  }
+  return acc;
+}
+
+template <typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Csrmv<matrix_t, vector_t>::value_t
+Csrmv<matrix_t, vector_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void Csrmv<matrix_t, vector_t>::bind(cl::sycl::handler &h) {
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void Csrmv<matrix_t, vector_t>::adjust_access_displacement() {
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+/**** CSRMV VECTOR PER ROW ****/
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE CsrmvVector<lhs_t, matrix_t, vector_t>::CsrmvVector(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename CsrmvVector<lhs_t, matrix_t, vector_t>::value_t _alpha,
+    typename CsrmvVector<lhs_t, matrix_t, vector_t>::value_t _beta,
+    typename CsrmvVector<lhs_t, matrix_t, vector_t>::index_t _vector_size)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      alpha_(_alpha),
+      beta_(_beta),
+      vector_size_(_vector_size) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename CsrmvVector<lhs_t, matrix_t, vector_t>::index_t
+CsrmvVector<lhs_t, matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size_row() * vector_size_;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool CsrmvVector<lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Each group of vector_size_ work items computes one row. Every work
+ * item takes part in the barriers of the reduction, including those past the
+ * last row.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename CsrmvVector<lhs_t, matrix_t, vector_t>::value_t
+CsrmvVector<lhs_t, matrix_t, vector_t>::eval(sharedT shrMem,
+                                             cl::sycl::nd_item<1> ndItem) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t lane = local_id % vector_size_;
+  const index_t row = ndItem.get_global_id(0) / vector_size_;
+  const bool valid_row = row < matrix_.get_size_row();
+
+  value_t acc = value_t(0);
+  if (valid_row) {
+    const index_t last = matrix_.row_end(row);
+    for (index_t k = matrix_.row_begin(row) + lane; k < last;
+         k += vector_size_) {
+      acc += matrix_.value(k) * vector_.eval(matrix_.col(k));
+    }
+  }
+  shrMem[local_id] = acc;
+
+  for (index_t offset = vector_size_ / 2; offset > 0; offset /= 2) {
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    if (lane < offset) {
+      shrMem[local_id] += shrMem[local_id + offset];
+    }
+  }
+
+  if (valid_row && lane == 0) {
+    const value_t sum = shrMem[local_id];
+    const value_t res = (beta_ == value_t(0))
+                            ? alpha_ * sum
+                            : alpha_ * sum + beta_ * lhs_.eval(row);
+    lhs_.eval(row) = res;
+    return res;
+  }
+  return acc;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void CsrmvVector<lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void
+CsrmvVector<lhs_t, matrix_t, vector_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+/**** CSRMV MERGE PATH ****/
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE
+CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t, carry_val_t>::
+    CsrmvMergePath(
+        lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+        carry_row_t &_carry_row, carry_val_t &_carry_val,
+        typename CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t,
+                                carry_val_t>::value_t _alpha,
+        typename CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t,
+                                carry_val_t>::value_t _beta,
+        typename CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t,
+                                carry_val_t>::index_t _items_per_thread)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      carry_row_(_carry_row),
+      carry_val_(_carry_val),
+      alpha_(_alpha),
+      beta_(_beta),
+      items_per_thread_(_items_per_thread) {}
+
+/*!
+ * @brief Number of work items, each of them handling items_per_thread_ items
+ * of the merge of the matrix_.get_size_row() row ends with the
+ * matrix_.get_nnz() nonzeros.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE typename CsrmvMergePath<lhs_t, matrix_t, vector_t,
+                                         carry_row_t, carry_val_t>::index_t
+CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t,
+               carry_val_t>::get_size() const {
+  return (matrix_.get_size_row() + matrix_.get_nnz() + items_per_thread_ - 1) /
+         items_per_thread_;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE bool
+CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t,
+               carry_val_t>::valid_thread(cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Row at which the merge path crosses the given diagonal, i.e. the
+ * number of row ends among the first diagonal items of the merge, the other
+ * diagonal - row items being nonzeros. The row end of row i comes before the
+ * nonzero k iff matrix_.row_end(i) <= k.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE typename CsrmvMergePath<lhs_t, matrix_t, vector_t,
+                                         carry_row_t, carry_val_t>::index_t
+CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t, carry_val_t>::
+    merge_path_search(index_t diagonal) const {
+  const index_t nnz = matrix_.get_nnz();
+  index_t lo = (diagonal > nnz) ? diagonal - nnz : index_t(0);
+  index_t hi = cl::sycl::min(diagonal, matrix_.get_size_row());
+  while (lo < hi) {
+    const index_t mid = (lo + hi) / 2;
+    if (matrix_.row_end(mid) <= diagonal - mid - 1) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE typename CsrmvMergePath<lhs_t, matrix_t, vector_t,
+                                         carry_row_t, carry_val_t>::value_t
+CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t, carry_val_t>::eval(
+    index_t t) {
+  const index_t total = matrix_.get_size_row() + matrix_.get_nnz();
+  const index_t first = cl::sycl::min(t * items_per_thread_, total);
+  const index_t last = cl::sycl::min(first + items_per_thread_, total);
+  const index_t row_last = merge_path_search(last);
+  const index_t k_last = last - row_last;
+  index_t row = merge_path_search(first);
+  index_t k = first - row;
+
+  value_t acc = value_t(0);
+  // The rows which end in this chunk
+  for (; row < row_last; row++) {
+    const index_t row_end = matrix_.row_end(row);
+    for (; k < row_end; k++) {
+      acc += matrix_.value(k) * vector_.eval(matrix_.col(k));
+    }
+    lhs_.eval(row) = (beta_ == value_t(0))
+                         ? alpha_ * acc
+                         : alpha_ * acc + beta_ * lhs_.eval(row);
+    acc = value_t(0);
+  }
+  // The beginning of the row which ends after this chunk
+  for (; k < k_last; k++) {
+    acc += matrix_.value(k) * vector_.eval(matrix_.col(k));
+  }
+  carry_row_.eval(t) = row_last;
+  carry_val_.eval(t) = acc;
+  return acc;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE typename CsrmvMergePath<lhs_t, matrix_t, vector_t,
+                                         carry_row_t, carry_val_t>::value_t
+CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t, carry_val_t>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE void CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t,
+                                     carry_val_t>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+  carry_row_.bind(h);
+  carry_val_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE void
+CsrmvMergePath<lhs_t, matrix_t, vector_t, carry_row_t,
+               carry_val_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+  carry_row_.adjust_access_displacement();
+  carry_val_.adjust_access_displacement();
+}
+
+/**** CSRMV MERGE PATH FIXUP ****/
+
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE
+CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::CsrmvMergeFixup(
+    lhs_t &_l, carry_row_t &_carry_row, carry_val_t &_carry_val,
+    carry_row_t &_carry_row_out, carry_val_t &_carry_val_out,
+    typename CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::value_t _alpha)
+    : lhs_(_l),
+      carry_row_(_carry_row),
+      carry_val_(_carry_val),
+      carry_row_out_(_carry_row_out),
+      carry_val_out_(_carry_val_out),
+      alpha_(_alpha) {}
+
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE
+    typename CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::index_t
+    CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::get_size() const {
+  return carry_val_.get_size();
+}
+
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE bool
+CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Row of the partial sum t, the items past the last partial sum taking
+ * the row lhs_.get_size(), which is not added to lhs_.
+ */
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE
+    typename CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::index_t
+    CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::get_row(
+        index_t t) const {
+  return (t < get_size()) ? static_cast<index_t>(carry_row_.eval(t))
+                          : static_cast<index_t>(lhs_.get_size());
+}
+
+/*!
+ * @brief Every work item takes part in the barriers of the scan, including
+ * those past the last partial sum.
+ */
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE
+    typename CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::value_t
+    CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::eval(
+        sharedT shrMem, cl::sycl::nd_item<1> ndItem) {
+  const index_t size = get_size();
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t local_size = ndItem.get_local_range(0);
+  const index_t group = ndItem.get_group(0);
+  const index_t t = ndItem.get_global_id(0);
+  const index_t row = get_row(t);
+
+  shrMem[local_id] = (t < size) ? carry_val_.eval(t) : value_t(0);
+  // The rows are sorted, so a partial sum of the same row offset items before
+  // is in the same segment, as are all the partial sums in between
+  for (index_t offset = 1; offset < local_size; offset *= 2) {
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    const value_t prev = (local_id >= offset && get_row(t - offset) == row)
+                             ? shrMem[local_id - offset]
+                             : value_t(0);
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    shrMem[local_id] += prev;
+  }
+
+  const index_t group_last =
+      cl::sycl::min((group + 1) * local_size, size) - 1;
+  if (t > group_last) {
+    return value_t(0);
+  }
+  const value_t sum = shrMem[local_id];
+  if (t == group_last && group_last < size - 1) {
+    carry_row_out_.eval(group) = row;
+    carry_val_out_.eval(group) = sum;
+  } else if ((t == group_last || get_row(t + 1) != row) &&
+             row < lhs_.get_size()) {
+    lhs_.eval(row) += alpha_ * sum;
+  }
+  return sum;
+}
+
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE void CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  carry_row_.bind(h);
+  carry_val_.bind(h);
+  carry_row_out_.bind(h);
+  carry_val_out_.bind(h);
+}
+
+template <typename lhs_t, typename carry_row_t, typename carry_val_t>
+SYCL_BLAS_INLINE void
+CsrmvMergeFixup<lhs_t, carry_row_t, carry_val_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  carry_row_.adjust_access_displacement();
+  carry_val_.adjust_access_displacement();
+  carry_row_out_.adjust_access_displacement();
+  carry_val_out_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS2_CSRMV_HPP
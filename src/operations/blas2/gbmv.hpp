@@ -0,0 +1,106 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gbmv.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS2_GBMV_HPP
+#define SYCL_BLAS_BLAS2_GBMV_HPP
+
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE Gbmv<Trans, lhs_t, matrix_t, vector_t>::Gbmv(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename Gbmv<Trans, lhs_t, matrix_t, vector_t>::value_t _alpha,
+    typename Gbmv<Trans, lhs_t, matrix_t, vector_t>::value_t _beta)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Gbmv<Trans, lhs_t, matrix_t, vector_t>::index_t
+Gbmv<Trans, lhs_t, matrix_t, vector_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool Gbmv<Trans, lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Computes the element i of lhs_. The band of row i of op(matrix_)
+ * spans the columns i - kl to i + ku, kl and ku being swapped by the
+ * transposition.
+ */
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Gbmv<Trans, lhs_t, matrix_t, vector_t>::value_t
+Gbmv<Trans, lhs_t, matrix_t, vector_t>::eval(
+    typename Gbmv<Trans, lhs_t, matrix_t, vector_t>::index_t i) {
+  const index_t lo = Trans ? matrix_.get_ku() : matrix_.get_kl();
+  const index_t up = Trans ? matrix_.get_kl() : matrix_.get_ku();
+  const index_t first = (i > lo) ? i - lo : index_t(0);
+  const index_t last = cl::sycl::min(vector_.get_size(), i + up + 1);
+
+  value_t acc = value_t(0);
+  for (index_t j = first; j < last; j++) {
+    const value_t a = Trans ? matrix_.eval(j, i) : matrix_.eval(i, j);
+    acc += a * vector_.eval(j);
+  }
+  const value_t res = (beta_ == value_t(0))
+                          ? alpha_ * acc
+                          : alpha_ * acc + beta_ * lhs_.eval(i);
+  lhs_.eval(i) = res;
+  return res;
+}
+
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Gbmv<Trans, lhs_t, matrix_t, vector_t>::value_t
+Gbmv<Trans, lhs_t, matrix_t, vector_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void Gbmv<Trans, lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <bool Trans, typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void
+Gbmv<Trans, lhs_t, matrix_t, vector_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS2_GBMV_HPP
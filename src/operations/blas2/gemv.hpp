@@ -26,6 +26,7 @@
 #ifndef GEMV_HPP
 #define GEMV_HPP
 #include "operations/blas2_trees.h"
+#include "operations/blas2/triangle_block_map.hpp"
 #include "operations/blas_operators.hpp"
 #include "views/view_sycl.hpp"
 #include <stdexcept>
@@ -80,6 +81,138 @@ SYCL_BLAS_INLINE void AddSetColumns<rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/**** SINGLE PASS GEMV ****/
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE Gemv<lhs_t, matrix_t, vector_t>::Gemv(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename Gemv<lhs_t, matrix_t, vector_t>::value_t _alpha,
+    typename Gemv<lhs_t, matrix_t, vector_t>::value_t _beta,
+    typename Gemv<lhs_t, matrix_t, vector_t>::index_t _nWG_batch,
+    typename Gemv<lhs_t, matrix_t, vector_t>::index_t _stride_a,
+    typename Gemv<lhs_t, matrix_t, vector_t>::index_t _stride_x,
+    typename Gemv<lhs_t, matrix_t, vector_t>::index_t _stride_y)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      alpha_(_alpha),
+      beta_(_beta),
+      nWG_batch_(_nWG_batch),
+      stride_a_(_stride_a),
+      stride_x_(_stride_x),
+      stride_y_(_stride_y) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Gemv<lhs_t, matrix_t, vector_t>::index_t
+Gemv<lhs_t, matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size_row();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool Gemv<lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Every work item takes part in the barriers
+  return true;
+}
+
+/*!
+ * @brief Computes the rows of the work group and writes
+ * alpha * (A * x) + beta * y for each of them. y is not read when beta is
+ * zero.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void Gemv<lhs_t, matrix_t, vector_t>::eval(
+    local_memory_t shrMem, cl::sycl::nd_item<1> ndItem) {
+  using index_t = typename Gemv<lhs_t, matrix_t, vector_t>::index_t;
+  using value_t = typename Gemv<lhs_t, matrix_t, vector_t>::value_t;
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  const index_t batch = ndItem.get_group(0) / nWG_batch_;
+  const index_t groupid = ndItem.get_group(0) - batch * nWG_batch_;
+  const index_t dimR = matrix_.get_size_row();
+  const index_t dimC = matrix_.get_size_col();
+  const index_t lda = matrix_.getSizeL();
+  const auto incx = vector_.get_stride();
+  const auto incy = lhs_.get_stride();
+  const auto a = matrix_.get_pointer() + batch * stride_a_;
+  const auto x = vector_.get_pointer() + batch * stride_x_;
+  const auto y = lhs_.get_pointer() + batch * stride_y_;
+  constexpr bool is_col_major = matrix_t::access_layout_t::is_col_major();
+
+  value_t val = value_t(0);
+  index_t row;
+  if (is_col_major) {
+    // One row per work item, consecutive work items read consecutive
+    // elements of each column
+    row = groupid * localSz + localid;
+    for (index_t col0 = 0; col0 < dimC; col0 += localSz) {
+      const index_t cols = cl::sycl::min(localSz, dimC - col0);
+      if (localid < cols) {
+        shrMem[localid] = x[(col0 + localid) * incx];
+      }
+      // This barrier is mandatory to be sure the data is on the shared memory
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      if (row < dimR) {
+        for (index_t k = 0; k < cols; k++) {
+          val += static_cast<value_t>(a[row + (col0 + k) * lda]) * shrMem[k];
+        }
+      }
+      // The slice is overwritten by the next iteration
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+  } else {
+    // One row per work group, consecutive work items read consecutive
+    // elements of the row
+    row = groupid;
+    for (index_t j = localid; j < dimC; j += localSz) {
+      val += static_cast<value_t>(a[row * lda + j]) * x[j * incx];
+    }
+    shrMem[localid] = val;
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    // The tree reduction runs on the next power of two of the work group
+    // size, the missing elements counting as zeros
+    index_t width = 1;
+    while (width < localSz) {
+      width <<= 1;
+    }
+    for (index_t offset = width >> 1; offset > 0; offset >>= 1) {
+      if (localid < offset && localid + offset < localSz) {
+        shrMem[localid] += shrMem[localid + offset];
+      }
+      // This barrier is mandatory to be sure the data are on the shared
+      // memory
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+    val = shrMem[0];
+    if (localid != 0) {
+      row = dimR;
+    }
+  }
+
+  if (row < dimR) {
+    y[row * incy] = (beta_ == value_t(0))
+                        ? alpha_ * val
+                        : alpha_ * val + beta_ * y[row * incy];
+  }
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void Gemv<lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void
+Gemv<lhs_t, matrix_t, vector_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
 /**** GEMV BY ROWS M ROWS x N BLOCK ****/
 /**
  * @struct GemvRow
@@ -112,6 +245,77 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t,
         vector_t>::get_size() const {
   return matrix_.get_size();
 }
+
+/*!
+ * @brief Blocks of columns and rows of the matrix computed by the work groups.
+ * Only the blocks which intersect the referenced triangle are launched.
+ */
+template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
+          typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t,
+                                  matrix_t, vector_t>::block_map_t
+GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t,
+        vector_t>::get_block_map(index_t localSz) const {
+  index_t dimR = matrix_.get_size_row();
+  index_t dimC = matrix_.get_size_col();
+  index_t rowSz = (dimR + nWG_row_ - 1) / nWG_row_;
+  index_t dimWFC =
+      ((dimC + (localSz * nWG_col_) - 1) / (localSz * nWG_col_)) * localSz;
+  return block_map_t(dimC, nWG_col_, nWG_row_, dimWFC, rowSz);
+}
+
+template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
+          typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t,
+                                  matrix_t, vector_t>::index_t
+GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t,
+        vector_t>::get_num_groups(index_t localSz) const {
+  return get_block_map(localSz).get_num_blocks();
+}
+
+/*!
+ * @brief The blocks which don't intersect the triangle are not launched, but
+ * the reduction sums the partial results of every block. The first block
+ * launched in each band of rows writes the zero results of the others, in the
+ * columns of the scratch matrix which they would have used.
+ */
+template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
+          typename lhs_t, typename matrix_t, typename vector_t>
+template <bool Shared>
+SYCL_BLAS_INLINE void
+GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::
+    clear_skipped_blocks(const block_map_t &map, index_t idWFR, index_t idWFC,
+                         index_t frs_row, index_t lst_row, index_t localid,
+                         index_t localSz) {
+  if (Lower && Upper) {
+    return;
+  }
+  index_t first, last;
+  map.get_inner_range(idWFR, first, last);
+  if (idWFC != first) {
+    return;
+  }
+  auto val = AdditionIdentity::eval(vector_.eval(0));
+  for (index_t colid = 0; colid < nWG_col_; colid++) {
+    if ((colid >= first) && (colid < last)) {
+      continue;
+    }
+    if (Shared) {
+      if (localid == 0) {
+        for (index_t rowid = frs_row; rowid < lst_row; rowid++) {
+          lhs_.eval(rowid, colid) = val;
+        }
+      }
+    } else {
+      index_t id_col_thr = colid * localSz + localid;
+      if (id_col_thr < lhs_.get_size_col()) {
+        for (index_t rowid = frs_row; rowid < lst_row; rowid++) {
+          lhs_.eval(rowid, id_col_thr) = val;
+        }
+      }
+    }
+  }
+}
 template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
           typename lhs_t, typename matrix_t, typename vector_t>
 SYCL_BLAS_INLINE bool
@@ -135,7 +339,7 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
   for (typename GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t,
                         vector_t>::index_t j = 0;
        j < dim; j++) {
-    auto prod = ProductOperator::eval(matrix_.eval(i, j), vector_.eval(j));
+    auto prod = ProductOperator::eval(load_matrix(i, j), vector_.eval(j));
     val = AddOperator::eval(val, prod);
   }
   return lhs_.eval(i) = val;
@@ -158,16 +362,19 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
   //
   index_t dimC = matrix_.get_size_col();
 
-  index_t rowSz = (dimR + nWG_row_ - 1) / nWG_row_;
+  const auto map = get_block_map(localSz);
+  index_t rowSz = map.outer_sz_;
 
-  index_t idWFR = groupid / nWG_col_;  // row bloq id of the current workgroup
-  index_t idWFC = groupid % nWG_col_;  // col blq id of the current workgroup
+  index_t idWFR;  // row bloq id of the current workgroup
+  index_t idWFC;  // col blq id of the current workgroup
+  map.get_block(groupid, idWFC, idWFR);
 
-  index_t dimWFC =
-      ((dimC + (localSz * nWG_col_) - 1) / (localSz * nWG_col_)) * localSz;
+  index_t dimWFC = map.inner_sz_;
 
   index_t frs_row = idWFR * rowSz;
   index_t lst_row = std::min(dimR, frs_row + rowSz);
+  clear_skipped_blocks<false>(map, idWFR, idWFC, frs_row, lst_row, localid,
+                              localSz);
 
   index_t frs_col = idWFC * dimWFC + interLoop * localid;
   index_t lst_col = std::min(dimC, frs_col + dimWFC);
@@ -196,18 +403,18 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
           val = init_val;
           for (index_t id_col = frs_col; id_col < lst_col; id_col += localSz) {
             if (Lower && Upper && Diag && !Unit) {
-              auto prod = ProductOperator::eval(matrix_.eval(id_row, id_col),
+              auto prod = ProductOperator::eval(load_matrix(id_row, id_col),
                                                 vector_.eval(id_col));
               val = AddOperator::eval(val, prod);
             } else {
               if ((Lower && ((id_col + ((!Diag || Unit) ? 1 : 0)) <= id_row)) ||
                   (Upper && (id_col >= (id_row + ((!Diag || Unit) ? 1 : 0))))) {
-                auto prod = ProductOperator::eval(matrix_.eval(id_row, id_col),
+                auto prod = ProductOperator::eval(load_matrix(id_row, id_col),
                                                   vector_.eval(id_col));
                 val = AddOperator::eval(val, prod);
               }
               if (Diag && Unit && (id_row == id_col)) {
-                val = AddOperator::eval(val, matrix_.eval(id_row, id_col));
+                val = AddOperator::eval(val, load_matrix(id_row, id_col));
               }
             }
           }
@@ -240,7 +447,7 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
                         : std::min(row + ((!Diag || Unit) ? 0 : 1), lst_k_int));
                k_int++) {
             // calculate the product between the row and the vector_.
-            auto prod = ProductOperator::eval(matrix_.eval(id_row, k_int),
+            auto prod = ProductOperator::eval(load_matrix(id_row, k_int),
                                               vector_.eval(k_int));
             // add that to val?
             // Reassignment!
@@ -279,16 +486,19 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
   index_t dimC = matrix_.get_size_col();
 
   //
-  index_t rowSz = (dimR + nWG_row_ - 1) / nWG_row_;
+  const auto map = get_block_map(localSz);
+  index_t rowSz = map.outer_sz_;
   index_t shrSz = local_memory_size_ / localSz;
 
-  index_t idWFR = groupid / nWG_col_;  // row bloq id of the current workgroup
-  index_t idWFC = groupid % nWG_col_;  // col blq id of the current workgroup
-  index_t dimWFC =
-      ((dimC + (localSz * nWG_col_) - 1) / (localSz * nWG_col_)) * localSz;
+  index_t idWFR;  // row bloq id of the current workgroup
+  index_t idWFC;  // col blq id of the current workgroup
+  map.get_block(groupid, idWFC, idWFR);
+  index_t dimWFC = map.inner_sz_;
 
   index_t frs_row = idWFR * rowSz;
   index_t lst_row = std::min(dimR, frs_row + rowSz);
+  clear_skipped_blocks<true>(map, idWFR, idWFC, frs_row, lst_row, localid,
+                             localSz);
 
   index_t frs_col = idWFC * dimWFC + interLoop * localid;
   index_t lst_col = std::min(dimC, frs_col + dimWFC);
@@ -317,13 +527,13 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
                     : init_val;
           for (index_t id_col = frs_col; id_col < lst_col; id_col += localSz) {
             if (Lower && Upper && Diag && !Unit) {
-              auto prod = ProductOperator::eval(matrix_.eval(id_row, id_col),
+              auto prod = ProductOperator::eval(load_matrix(id_row, id_col),
                                                 vector_.eval(id_col));
               val = AddOperator::eval(val, prod);
             } else {
               if ((Lower && ((id_col + ((!Diag || Unit) ? 1 : 0)) <= id_row)) ||
                   (Upper && (id_col >= (id_row + ((!Diag || Unit) ? 1 : 0))))) {
-                auto prod = ProductOperator::eval(matrix_.eval(id_row, id_col),
+                auto prod = ProductOperator::eval(load_matrix(id_row, id_col),
                                                   vector_.eval(id_col));
                 val = AddOperator::eval(val, prod);
               }
@@ -339,7 +549,7 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
             for (index_t k_int = id_col;
                  k_int < std::min(id_col + interLoop, lst_col); k_int++) {
               if (Lower && Upper && Diag && !Unit) {
-                auto prod = ProductOperator::eval(matrix_.eval(id_row, k_int),
+                auto prod = ProductOperator::eval(load_matrix(id_row, k_int),
                                                   vector_.eval(k_int));
                 val = AddOperator::eval(val, prod);
               } else {
@@ -347,12 +557,12 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
                      ((id_col + ((!Diag || Unit) ? 1 : 0)) <= id_row)) ||
                     (Upper &&
                      (id_col >= (id_row + ((!Diag || Unit) ? 1 : 0))))) {
-                  auto prod = ProductOperator::eval(matrix_.eval(id_row, k_int),
+                  auto prod = ProductOperator::eval(load_matrix(id_row, k_int),
                                                     vector_.eval(k_int));
                   val = AddOperator::eval(val, prod);
                 }
                 if (Diag && Unit && (id_row == id_col)) {
-                  val = AddOperator::eval(val, matrix_.eval(id_row, k_int));
+                  val = AddOperator::eval(val, load_matrix(id_row, k_int));
                 }
               }
             }
@@ -386,6 +596,23 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
 
   return init_val;
 }
+
+/*!
+ * @brief Reads an element of the matrix, converted at load time to the type
+ * of the vector, in which the product is computed.
+ */
+template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
+          typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t,
+                                  matrix_t, vector_t>::value_t
+GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::
+    load_matrix(typename GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t,
+                                 matrix_t, vector_t>::index_t i,
+                typename GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t,
+                                 matrix_t, vector_t>::index_t j) {
+  return static_cast<value_t>(matrix_.eval(i, j));
+}
+
 template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
           typename lhs_t, typename matrix_t, typename vector_t>
 SYCL_BLAS_INLINE void GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t,
@@ -434,6 +661,63 @@ SYCL_BLAS_INLINE typename GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t,
 GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::get_size() const {
   return matrix_.get_size_row();
 }
+
+/*!
+ * @brief Blocks of rows and columns of the matrix computed by the work groups.
+ * Only the blocks which intersect the referenced triangle are launched.
+ */
+template <bool Lower, bool Diag, bool Upper, bool Unit, typename lhs_t,
+          typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t,
+                                  vector_t>::block_map_t
+GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::get_block_map(
+    index_t localSz) const {
+  index_t dimR = matrix_.get_size_row();
+  index_t dimC = matrix_.get_size_col();
+  index_t colSz = (dimC + nWG_col_ - 1) / nWG_col_;
+  index_t dimWFR =
+      (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
+  return block_map_t(dimR, nWG_row_, nWG_col_, dimWFR, colSz);
+}
+
+template <bool Lower, bool Diag, bool Upper, bool Unit, typename lhs_t,
+          typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t,
+                                  vector_t>::index_t
+GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::get_num_groups(
+    index_t localSz) const {
+  return get_block_map(localSz).get_num_blocks();
+}
+
+/*!
+ * @brief The blocks which don't intersect the triangle are not launched, but
+ * the reduction sums the partial results of every block. The first block
+ * launched in each band of rows writes the zero results of the others.
+ */
+template <bool Lower, bool Diag, bool Upper, bool Unit, typename lhs_t,
+          typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void
+GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::
+    clear_skipped_blocks(const block_map_t &map, index_t idWFR, index_t idWFC,
+                         index_t frs_row, index_t lst_row, index_t localSz) {
+  if (Lower && Upper) {
+    return;
+  }
+  index_t first = 0;
+  while (!map.is_launched(idWFR, first)) {
+    first++;
+  }
+  if (idWFC == first) {
+    auto val = AdditionIdentity::eval(vector_.eval(0));
+    for (index_t colid = 0; colid < nWG_col_; colid++) {
+      if (!map.is_launched(idWFR, colid)) {
+        for (index_t rowid = frs_row; rowid < lst_row; rowid += localSz) {
+          lhs_.eval(rowid, colid) = val;
+        }
+      }
+    }
+  }
+}
 template <bool Lower, bool Diag, bool Upper, bool Unit, typename lhs_t,
           typename matrix_t, typename vector_t>
 SYCL_BLAS_INLINE bool
@@ -451,7 +735,7 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(index_t i) {
 
   auto val = AdditionIdentity::eval(vector_.eval(0));
   for (index_t j = 0; j < dim; j++) {
-    auto prod = ProductOperator::eval(matrix_.eval(i, j), vector_.eval(j));
+    auto prod = ProductOperator::eval(load_matrix(i, j), vector_.eval(j));
     val = AddOperator::eval(val, prod);
   }
   return lhs_.eval(i) = val;
@@ -471,18 +755,20 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
 
   index_t dimR = matrix_.get_size_row();
   index_t dimC = matrix_.get_size_col();
-  index_t colSz = (dimC + nWG_col_ - 1) / nWG_col_;
 
-  index_t idWFR = (groupid % nWG_row_);
-  index_t idWFC = (groupid / nWG_row_);
-  index_t dimWFR =
-      (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
+  const auto map = get_block_map(localSz);
+  index_t colSz = map.outer_sz_;
+  index_t dimWFR = map.inner_sz_;
+  index_t idWFR;
+  index_t idWFC;
+  map.get_block(groupid, idWFR, idWFC);
 
   index_t frs_row = idWFR * dimWFR + localid;
   index_t lst_row = std::min(dimR, frs_row + dimWFR);
 
   index_t frs_col = idWFC * colSz;
   index_t lst_col = std::min(dimC, frs_col + colSz);
+  clear_skipped_blocks(map, idWFR, idWFC, frs_row, lst_row, localSz);
   // PROBLEM IF ONLY SOME THREADS OF A WORKGROUP ARE CANCELED
   // TO SOLVE IT, USE GLOBAL VALUES OF frs_row AND lst_row
   if ((!Upper &&
@@ -497,7 +783,7 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
     for (index_t rowid = frs_row; rowid < lst_row; rowid += localSz) {
       // The initial value of val is different for the first iteration
       auto val = (Diag && Unit && ((rowid >= frs_col) && (rowid < lst_col)))
-                     ? matrix_.eval(rowid, rowid)
+                     ? load_matrix(rowid, rowid)
                      : AdditionIdentity::eval(vector_.eval(0));
       for (index_t id_col =
                ((Lower) ? frs_col
@@ -506,7 +792,7 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
            ((Upper) ? lst_col
                     : std::min(rowid + ((!Diag || Unit) ? 0 : 1), lst_col));
            id_col++) {
-        auto prod = ProductOperator::eval(matrix_.eval(rowid, id_col),
+        auto prod = ProductOperator::eval(load_matrix(rowid, id_col),
                                           vector_.eval(id_col));
         val = AddOperator::eval(val, prod);
       }
@@ -534,17 +820,19 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
   index_t dimR = matrix_.get_size_row();
   index_t dimC = matrix_.get_size_col();
 
-  index_t colSz = (dimC + nWG_col_ - 1) / nWG_col_;
-  index_t idWFR = (groupid % nWG_row_);
-  index_t idWFC = (groupid / nWG_row_);
-  index_t dimWFR =
-      (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
+  const auto map = get_block_map(localSz);
+  index_t colSz = map.outer_sz_;
+  index_t dimWFR = map.inner_sz_;
+  index_t idWFR;
+  index_t idWFC;
+  map.get_block(groupid, idWFR, idWFC);
 
   index_t frs_row = idWFR * dimWFR + localid;
   index_t lst_row = std::min(dimR, frs_row + dimWFR);
 
   index_t frs_col = idWFC * colSz;
   index_t lst_col = std::min(dimC, frs_col + colSz);
+  clear_skipped_blocks(map, idWFR, idWFC, frs_row, lst_row, localSz);
 
   // PROBLEM IF ONLY SOME THREADS OF A WORKGROUP ARE CANCELED
   // TO SOLVE IT, USE GLOBAL VALUES OF frs_row AND lst_row
@@ -585,12 +873,12 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
         for (index_t id_col = colid, col = 0; col < blqSz; id_col++, col++) {
           if (Lower && Upper && Diag && !Unit) {
             auto prod =
-                ProductOperator::eval(matrix_.eval(rowid, id_col), shrMem[col]);
+                ProductOperator::eval(load_matrix(rowid, id_col), shrMem[col]);
             val = AddOperator::eval(val, prod);
           } else {
             if ((Lower && ((id_col + ((!Diag || Unit) ? 1 : 0)) <= rowid)) ||
                 (Upper && (id_col >= (rowid + ((!Diag || Unit) ? 1 : 0))))) {
-              auto prod = ProductOperator::eval(matrix_.eval(rowid, id_col),
+              auto prod = ProductOperator::eval(load_matrix(rowid, id_col),
                                                 shrMem[col]);
               val = AddOperator::eval(val, prod);
             }
@@ -603,6 +891,23 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
   }
   return lhs_.eval(frs_row, idWFC);
 }
+
+/*!
+ * @brief Reads an element of the matrix, converted at load time to the type
+ * of the vector, in which the product is computed.
+ */
+template <bool Lower, bool Diag, bool Upper, bool Unit, typename lhs_t,
+          typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t,
+                                  vector_t>::value_t
+GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::load_matrix(
+    typename GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t,
+                     vector_t>::index_t i,
+    typename GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t,
+                     vector_t>::index_t j) {
+  return static_cast<value_t>(matrix_.eval(i, j));
+}
+
 template <bool Lower, bool Diag, bool Upper, bool Unit, typename lhs_t,
           typename matrix_t, typename vector_t>
 SYCL_BLAS_INLINE void GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t,
@@ -621,5 +926,125 @@ SYCL_BLAS_INLINE void GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t,
   vector_.adjust_access_displacement();
 }
 
+/**** FUSED DUAL GEMV ****/
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE GemvDual<lhs_t, matrix_t, vector_t>::GemvDual(
+    lhs_t &_l, lhs_t &_lT, matrix_t &_matrix, vector_t &_vector,
+    vector_t &_vectorT,
+    typename GemvDual<lhs_t, matrix_t, vector_t>::index_t _tile_size)
+    : lhs_(_l),
+      lhsT_(_lT),
+      matrix_(_matrix),
+      vector_(_vector),
+      vectorT_(_vectorT),
+      tile_size_(_tile_size) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename GemvDual<lhs_t, matrix_t, vector_t>::index_t
+GemvDual<lhs_t, matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool GemvDual<lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Every work item takes part in loading the tile to local memory
+  return true;
+}
+
+/*!
+ * @brief Computes the contributions of one tile. The local memory holds the
+ * tile (tile_size_ x (tile_size_ + 1), column major, padded to avoid bank
+ * conflicts when it is read by columns), followed by the slice of vector_
+ * matching its columns and the slice of vectorT_ matching its rows.
+ *
+ * GemvRow and GemvCol only keep the slice of the vector in local memory and
+ * read A from global memory in the layout of their single product, so their
+ * loops cannot feed the transposed product with the same reads. The tile is
+ * instead staged in local memory as in Symv, which also reads each tile for
+ * both A and A^T, and work items [0, rows) then read it by rows while the
+ * next cols work items read it by columns.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void GemvDual<lhs_t, matrix_t, vector_t>::eval(
+    local_memory_t shrMem, cl::sycl::nd_item<1> ndItem) {
+  using index_t = typename GemvDual<lhs_t, matrix_t, vector_t>::index_t;
+  using value_t = typename GemvDual<lhs_t, matrix_t, vector_t>::value_t;
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  const index_t groupid = ndItem.get_group(0);
+  const index_t dimR = matrix_.get_size_row();
+  const index_t dimC = matrix_.get_size_col();
+  const index_t nb = tile_size_;
+  const index_t ld = nb + 1;
+  const index_t xc_disp = nb * ld;
+  const index_t wr_disp = xc_disp + nb;
+
+  // Consecutive work groups process the tiles of a block column
+  const index_t nTilesPerCol = (dimR - 1) / nb + 1;
+  const index_t bi = groupid % nTilesPerCol;
+  const index_t bj = groupid / nTilesPerCol;
+  const index_t row0 = bi * nb;
+  const index_t col0 = bj * nb;
+  const index_t rows = std::min(nb, dimR - row0);
+  const index_t cols = std::min(nb, dimC - col0);
+
+  // Consecutive work items load consecutive elements in memory
+  constexpr bool is_col_major = matrix_t::access_layout_t::is_col_major();
+  for (index_t idx = localid; idx < nb * nb; idx += localSz) {
+    const index_t i = is_col_major ? idx % nb : idx / nb;
+    const index_t j = is_col_major ? idx / nb : idx % nb;
+    shrMem[i + j * ld] = ((i < rows) && (j < cols))
+                             ? matrix_.eval(row0 + i, col0 + j)
+                             : value_t(0);
+  }
+  for (index_t i = localid; i < nb; i += localSz) {
+    shrMem[xc_disp + i] = (i < cols) ? vector_.eval(col0 + i) : value_t(0);
+    shrMem[wr_disp + i] = (i < rows) ? vectorT_.eval(row0 + i) : value_t(0);
+  }
+  // This barrier is mandatory to be sure the tile is in local memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Work items [0, rows) compute A * x for the block row, the next ones
+  // compute A^T * w for the block column
+  for (index_t task = localid; task < rows + cols; task += localSz) {
+    value_t val = value_t(0);
+    if (task < rows) {
+      const index_t i = task;
+      for (index_t j = 0; j < cols; j++) {
+        val += shrMem[i + j * ld] * shrMem[xc_disp + j];
+      }
+      lhs_.eval(row0 + i, bj) = val;
+    } else {
+      const index_t j = task - rows;
+      for (index_t i = 0; i < rows; i++) {
+        val += shrMem[i + j * ld] * shrMem[wr_disp + i];
+      }
+      lhsT_.eval(col0 + j, bi) = val;
+    }
+  }
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void GemvDual<lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  lhsT_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+  vectorT_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void
+GemvDual<lhs_t, matrix_t, vector_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  lhsT_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+  vectorT_.adjust_access_displacement();
+}
+
 }  // namespace blas
 #endif
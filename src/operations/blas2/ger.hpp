@@ -28,6 +28,7 @@
 
 #include <operations/blas2_trees.h>
 #include <operations/blas_operators.hpp>
+#include <operations/blas2/triangle_block_map.hpp>
 #include <stdexcept>
 #include <vector>
 #include <views/view_sycl.hpp>
@@ -298,6 +299,33 @@ SYCL_BLAS_INLINE typename GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t,
 GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>::get_size() const {
   return rhs_1_.get_size();
 }
+
+/*!
+ * @brief Blocks of rows and columns of the matrix updated by the work groups.
+ * Only the blocks which intersect the updated triangle are launched.
+ */
+template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t,
+                                 rhs_2_t>::block_map_t
+GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>::get_block_map(
+    index_t localSz) const {
+  index_t dimR = lhs_.get_size_row();
+  index_t dimC = lhs_.get_size_col();
+  index_t colSz = (dimR < localSz) ? localSz : (dimC + nWG_col_ - 1) / nWG_col_;
+  index_t dimWFR =
+      (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
+  return block_map_t(dimR, nWG_row_, nWG_col_, dimWFR, colSz);
+}
+
+template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t,
+                                 rhs_2_t>::index_t
+GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>::get_num_groups(
+    index_t localSz) const {
+  return get_block_map(localSz).get_num_blocks();
+}
 template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
           typename rhs_1_t, typename rhs_2_t>
 SYCL_BLAS_INLINE bool
@@ -337,12 +365,13 @@ GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>::eval(
   index_t dimR = lhs_.get_size_row();
   index_t dimC = lhs_.get_size_col();
 
-  index_t colSz = (dimR < localSz) ? localSz : (dimC + nWG_col_ - 1) / nWG_col_;
+  const auto map = get_block_map(localSz);
+  index_t colSz = map.outer_sz_;
+  index_t dimWFR = map.inner_sz_;
 
-  index_t idWFR = groupid % nWG_row_;  // row bloq id of the current workgroup
-  index_t idWFC = groupid / nWG_row_;  // col blq id of the current workgroup
-  index_t dimWFR =
-      (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
+  index_t idWFR;  // row bloq id of the current workgroup
+  index_t idWFC;  // col blq id of the current workgroup
+  map.get_block(groupid, idWFR, idWFC);
 
   index_t frs_row = idWFR * dimWFR + localid;
   index_t lst_row = std::min(dimR, frs_row + dimWFR);
@@ -399,16 +428,18 @@ GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>::eval(
   index_t dimR = lhs_.get_size_row();
   index_t dimC = lhs_.get_size_col();
 
-  index_t colSz = (dimR < localSz) ? localSz : (dimC + nWG_col_ - 1) / nWG_col_;
+  const auto map = get_block_map(localSz);
+  index_t colSz = map.outer_sz_;
+  index_t dimWFR = map.inner_sz_;
 
-  index_t idWFR = groupid % nWG_row_;  // row bloq id of the current workgroup
-  index_t dimWFR =
-      (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
+  index_t idWFR;  // row bloq id of the current workgroup
+  index_t idWFC;  // col blq id of the current workgroup
+  map.get_block(groupid, idWFR, idWFC);
 
   index_t frs_row = idWFR * dimWFR + localid;
   index_t lst_row = std::min(dimR, frs_row + dimWFR);
 
-  index_t frs_col = (groupid / nWG_row_) * colSz;
+  index_t frs_col = idWFC * colSz;
   index_t lst_col = std::min(dimC, frs_col + colSz);
   // PROBLEM IF ONLY SOME THREADS OF A WORKGROUP ARE CANCELED
   // TO SOLVE IT, USE GLOBAL VALUES OF frs_row AND lst_row
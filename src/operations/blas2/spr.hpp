@@ -0,0 +1,98 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename spr.hpp
+ *
+ **************************************************************************/
+
+
+#ifndef SYCL_BLAS_BLAS2_SPR_HPP
+#define SYCL_BLAS_BLAS2_SPR_HPP
+
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::Spr(
+    lhs_t &_l, typename Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::value_t _alpha,
+    rhs_1_t &_r1, rhs_2_t &_r2)
+    : lhs_(_l), alpha_(_alpha), rhs_1_(_r1), rhs_2_(_r2) {}
+
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::index_t
+Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::get_size() const {
+  return lhs_.get_packed_size();
+}
+
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE bool Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Updates the element k of the packed storage.
+ */
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::value_t
+Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::eval(
+    typename Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::index_t k) {
+  index_t i;
+  index_t j;
+  get_packed_coordinates(k, lhs_.get_size_row(), lhs_.is_lower(), i, j);
+
+  const value_t prod = Single ? rhs_1_.eval(i) * rhs_1_.eval(j)
+                              : rhs_1_.eval(i) * rhs_2_.eval(j) +
+                                    rhs_2_.eval(i) * rhs_1_.eval(j);
+  lhs_.eval(k) += alpha_ * prod;
+  return lhs_.eval(k);
+}
+
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::value_t
+Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE void Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_1_.bind(h);
+  if (!Single) {
+    rhs_2_.bind(h);
+  }
+}
+
+template <bool Single, typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE void
+Spr<Single, lhs_t, rhs_1_t, rhs_2_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_1_.adjust_access_displacement();
+  if (!Single) {
+    rhs_2_.adjust_access_displacement();
+  }
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS2_SPR_HPP
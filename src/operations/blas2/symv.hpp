@@ -0,0 +1,146 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename symv.hpp
+ *
+ **************************************************************************/
+
+
+#ifndef SYMV_HPP
+#define SYMV_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+namespace blas {
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE Symv<lhs_t, matrix_t, vector_t>::Symv(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+    typename Symv<lhs_t, matrix_t, vector_t>::index_t _tile_size)
+    : lhs_(_l), matrix_(_matrix), vector_(_vector), tile_size_(_tile_size) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE typename Symv<lhs_t, matrix_t, vector_t>::index_t
+Symv<lhs_t, matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size_row();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE bool Symv<lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Every work item takes part in loading the tile to local memory
+  return true;
+}
+
+/*!
+ * @brief Computes the contributions of one tile. The local memory holds the
+ * tile (tile_size_ x (tile_size_ + 1), column major, padded to avoid bank
+ * conflicts when it is read by columns), followed by the slices of the vector
+ * matching its rows and its columns.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void Symv<lhs_t, matrix_t, vector_t>::eval(
+    local_memory_t shrMem, cl::sycl::nd_item<1> ndItem) {
+  using index_t = typename Symv<lhs_t, matrix_t, vector_t>::index_t;
+  using value_t = typename Symv<lhs_t, matrix_t, vector_t>::value_t;
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  const index_t groupid = ndItem.get_group(0);
+  const index_t dim = matrix_.get_size_row();
+  const index_t nb = tile_size_;
+  const index_t ld = nb + 1;
+  const index_t xr_disp = nb * ld;
+  const index_t xc_disp = xr_disp + nb;
+
+  // The tiles of the lower triangle are numbered row by row
+  index_t bi = static_cast<index_t>(
+      (cl::sycl::sqrt(8.f * static_cast<float>(groupid) + 1.f) - 1.f) / 2.f);
+  while (bi * (bi + 1) / 2 > groupid) {
+    bi--;
+  }
+  while ((bi + 1) * (bi + 2) / 2 <= groupid) {
+    bi++;
+  }
+  const index_t bj = groupid - bi * (bi + 1) / 2;
+  const bool diag = (bi == bj);
+  const index_t row0 = bi * nb;
+  const index_t col0 = bj * nb;
+  const index_t rows = std::min(nb, dim - row0);
+  const index_t cols = std::min(nb, dim - col0);
+
+  // Consecutive work items load consecutive elements in memory
+  constexpr bool is_col_major = matrix_t::access_layout_t::is_col_major();
+  for (index_t idx = localid; idx < nb * nb; idx += localSz) {
+    const index_t i = is_col_major ? idx % nb : idx / nb;
+    const index_t j = is_col_major ? idx / nb : idx % nb;
+    const bool stored = (i < rows) && (j < cols) && (!diag || i >= j);
+    shrMem[i + j * ld] = stored ? matrix_.eval(row0 + i, col0 + j) : value_t(0);
+  }
+  for (index_t i = localid; i < nb; i += localSz) {
+    shrMem[xr_disp + i] = (i < rows) ? vector_.eval(row0 + i) : value_t(0);
+    shrMem[xc_disp + i] = (i < cols) ? vector_.eval(col0 + i) : value_t(0);
+  }
+  // This barrier is mandatory to be sure the tile is in local memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Work items [0, rows) compute A * x for the block row, the next ones
+  // compute A^T * x for the block column of an off-diagonal tile
+  const index_t nTasks = diag ? rows : rows + cols;
+  for (index_t task = localid; task < nTasks; task += localSz) {
+    value_t val = value_t(0);
+    if (task < rows) {
+      const index_t i = task;
+      for (index_t j = 0; j < cols; j++) {
+        // A diagonal tile only holds its lower triangle
+        const value_t a =
+            (diag && i < j) ? shrMem[j + i * ld] : shrMem[i + j * ld];
+        val += a * shrMem[xc_disp + j];
+      }
+      lhs_.eval(row0 + i, bj) = val;
+    } else {
+      const index_t j = task - rows;
+      for (index_t i = 0; i < rows; i++) {
+        val += shrMem[i + j * ld] * shrMem[xr_disp + i];
+      }
+      lhs_.eval(col0 + j, bi) = val;
+    }
+  }
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void Symv<lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t>
+SYCL_BLAS_INLINE void
+Symv<lhs_t, matrix_t, vector_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
@@ -0,0 +1,247 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename triangle_block_map.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS2_TRIANGLE_BLOCK_MAP_HPP
+#define SYCL_BLAS_BLAS2_TRIANGLE_BLOCK_MAP_HPP
+
+#include "operations/blas2_trees.h"
+
+namespace blas {
+
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE
+TriangleBlockMap<Lower, Diag, Upper, index_t>::TriangleBlockMap(
+    index_t _dim, index_t _nWG_inner, index_t _nWG_outer, index_t _inner_sz,
+    index_t _outer_sz)
+    : dim_(_dim),
+      nWG_inner_(_nWG_inner),
+      nWG_outer_(_nWG_outer),
+      inner_sz_(_inner_sz),
+      outer_sz_(_outer_sz) {}
+
+/*!
+ * @brief Range [first, last) of the inner blocks of the outer block outer
+ * which are launched.
+ */
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE void
+TriangleBlockMap<Lower, Diag, Upper, index_t>::get_inner_range(
+    index_t outer, index_t &first, index_t &last) const {
+  if (is_full()) {
+    first = 0;
+    last = nWG_inner_;
+    return;
+  }
+  const index_t off_diag = Diag ? 0 : 1;
+  const index_t nInner =
+      std::min(nWG_inner_, (dim_ + inner_sz_ - 1) / inner_sz_);
+  const index_t frs_outer = outer * outer_sz_;
+  const index_t lst_outer = std::min(dim_, frs_outer + outer_sz_);
+  if (frs_outer + (Upper ? 0 : off_diag) >= dim_) {
+    first = last = 0;
+    return;
+  }
+  // A block is launched if its last inner index is at least the first outer
+  // one (Lower), or if its first inner index is at most the last outer one
+  // (Upper), excluding the diagonal unless Diag
+  first = Upper ? 0 : std::min(nInner, (frs_outer + off_diag) / inner_sz_);
+  last = Lower ? nInner
+               : ((lst_outer - off_diag > 0)
+                      ? std::min(nInner,
+                                 (lst_outer - 1 - off_diag) / inner_sz_ + 1)
+                      : index_t(0));
+  last = std::max(first, last);
+}
+
+/*!
+ * @brief Whether every block is launched: when the whole matrix is
+ * referenced, or when there is a single inner block, which intersects the
+ * triangle in every outer block but maybe an empty last one. The kernels
+ * clear the results of the blocks outside the triangle, so launching them
+ * all avoids any mapping.
+ */
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE bool TriangleBlockMap<Lower, Diag, Upper, index_t>::is_full()
+    const {
+  return (Lower && Upper) || (nWG_inner_ == 1);
+}
+
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE bool
+TriangleBlockMap<Lower, Diag, Upper, index_t>::is_launched(
+    index_t inner, index_t outer) const {
+  index_t first, last;
+  get_inner_range(outer, first, last);
+  return (inner >= first) && (inner < last);
+}
+
+/*!
+ * @brief Sum of floor((a * i + b) / c) for i in [0, n), with a, b >= 0 and
+ * c > 0, in a number of steps logarithmic in a and c (as Euclid's algorithm).
+ */
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE index_t
+TriangleBlockMap<Lower, Diag, Upper, index_t>::floor_sum(index_t n, index_t a,
+                                                         index_t b, index_t c) {
+  index_t sum = 0;
+  while (n > 0) {
+    sum += ((n * (n - 1)) / 2) * (a / c) + n * (b / c);
+    a %= c;
+    b %= c;
+    const index_t y_max = a * n + b;
+    if (y_max < c) {
+      break;
+    }
+    // The terms are counted again by columns of the lattice below the line
+    n = y_max / c;
+    b = y_max % c;
+    const index_t tmp = a;
+    a = c;
+    c = tmp;
+  }
+  return sum;
+}
+
+/*!
+ * @brief Number of outer blocks whose inner range is given by the closed
+ * formula of get_first_block. They are the outer blocks which intersect the
+ * triangle (Lower), or which are full (Upper); the next one is the last
+ * outer block which can be launched.
+ */
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE index_t
+TriangleBlockMap<Lower, Diag, Upper, index_t>::get_num_regular() const {
+  const index_t off_diag = Diag ? 0 : 1;
+  return std::min(nWG_outer_, Upper ? dim_ / outer_sz_
+                                    : (dim_ - off_diag + outer_sz_ - 1) /
+                                          outer_sz_);
+}
+
+/*!
+ * @brief Number of blocks launched in the outer blocks before outer, i.e.
+ * first work group of the outer block outer.
+ *
+ * The first inner block of the regular outer block p is
+ * floor((p * outer_sz_ + off_diag) / inner_sz_) (Lower), and its last one
+ * floor((p * outer_sz_ + outer_sz_ - 1 - off_diag) / inner_sz_) (Upper), so
+ * the number of blocks is a sum of floors of a linear function, which
+ * floor_sum computes without walking the outer blocks.
+ */
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE index_t
+TriangleBlockMap<Lower, Diag, Upper, index_t>::get_first_block(
+    index_t outer) const {
+  if (is_full()) {
+    return outer * nWG_inner_;
+  }
+  const index_t off_diag = Diag ? 0 : 1;
+  const index_t nInner =
+      std::min(nWG_inner_, (dim_ + inner_sz_ - 1) / inner_sz_);
+  const index_t num_regular = get_num_regular();
+  const index_t n = std::min(outer, num_regular);
+  // The inner blocks cover the matrix, so no first or last inner block of a
+  // regular outer block is clamped to nInner
+  index_t num_blocks =
+      Upper ? floor_sum(n, outer_sz_, outer_sz_ - 1 - off_diag + inner_sz_,
+                        inner_sz_)
+            : n * nInner - floor_sum(n, outer_sz_, off_diag, inner_sz_);
+  if ((outer > num_regular) && (num_regular < nWG_outer_)) {
+    index_t first, last;
+    get_inner_range(num_regular, first, last);
+    num_blocks += last - first;
+  }
+  return num_blocks;
+}
+
+/*!
+ * @brief Number of blocks launched, i.e. of work groups of the kernel.
+ */
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE index_t
+TriangleBlockMap<Lower, Diag, Upper, index_t>::get_num_blocks() const {
+  return get_first_block(nWG_outer_);
+}
+
+/*!
+ * @brief Block computed by the work group groupid.
+ *
+ * The number of blocks before an outer block is close to a quadratic function
+ * of it, which is inverted as get_packed_coordinates inverts the triangular
+ * numbers. The guess is checked with get_first_block, and bisected when the
+ * rounding of the blocks makes it wrong, so the cost is at most logarithmic
+ * in nWG_outer_.
+ */
+template <bool Lower, bool Diag, bool Upper, typename index_t>
+SYCL_BLAS_INLINE void TriangleBlockMap<Lower, Diag, Upper, index_t>::get_block(
+    index_t groupid, index_t &inner, index_t &outer) const {
+  if (is_full()) {
+    inner = groupid % nWG_inner_;
+    outer = groupid / nWG_inner_;
+    return;
+  }
+  const index_t off_diag = Diag ? 0 : 1;
+  const index_t nInner =
+      std::min(nWG_inner_, (dim_ + inner_sz_ - 1) / inner_sz_);
+  // get_first_block(p) ~ b * p - slope * p^2 / 2 (Lower), or
+  // d * p + slope * p^2 / 2 (Upper), counting each floor as its mean
+  const float slope =
+      static_cast<float>(outer_sz_) / static_cast<float>(inner_sz_);
+  const float d =
+      static_cast<float>(outer_sz_ + inner_sz_ - 1 - 2 * off_diag) /
+      static_cast<float>(2 * inner_sz_);
+  const float b = static_cast<float>(nInner) + d;
+  const float g = static_cast<float>(groupid);
+  const float guess =
+      Upper ? (cl::sycl::sqrt(d * d + 2.0f * slope * g) - d) / slope
+            : (b - cl::sycl::sqrt(cl::sycl::fmax(
+                       b * b - 2.0f * slope * g, 0.0f))) /
+                  slope;
+  index_t lo = std::min(nWG_outer_ - 1,
+                        std::max(index_t(0), static_cast<index_t>(guess)));
+  index_t hi = nWG_outer_;
+  if (get_first_block(lo) > groupid) {
+    hi = lo;
+    lo = 0;
+  } else if (get_first_block(lo + 1) > groupid) {
+    hi = lo + 1;
+  } else {
+    lo++;
+  }
+  while (hi - lo > 1) {
+    const index_t mid = (lo + hi) / 2;
+    if (get_first_block(mid) > groupid) {
+      hi = mid;
+    } else {
+      lo = mid;
+    }
+  }
+  outer = lo;
+  index_t first, last;
+  get_inner_range(outer, first, last);
+  inner = first + groupid - get_first_block(outer);
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS2_TRIANGLE_BLOCK_MAP_HPP
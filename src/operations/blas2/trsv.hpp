@@ -0,0 +1,101 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trsv.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS2_TRSV_HPP
+#define SYCL_BLAS_BLAS2_TRSV_HPP
+
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t>::
+    DiagonalBlockTrsv(lhs_t &_l, matrix_t &_matrix)
+    : lhs_(_l), matrix_(_matrix) {}
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE
+    typename DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t>::index_t
+    DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t>::get_size() const {
+  return matrix_.get_size_row();
+}
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE bool
+DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Every work item reaches the barriers of the substitution
+  return true;
+}
+
+/*!
+ * @brief Solves the diagonal block. Each solved element is written to its own
+ * slot of local memory, so that a single barrier per row is enough: the slot
+ * of the next row is never the one still being read.
+ */
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t>::eval(
+    local_memory_t shrMem, cl::sycl::nd_item<1> ndItem) {
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t rows = matrix_.get_size_row();
+  const bool active = localid < rows;
+
+  value_t val = active ? lhs_.eval(localid) : value_t(0);
+  for (index_t step = 0; step < rows; step++) {
+    const index_t i = Lower ? step : rows - 1 - step;
+    if (localid == i) {
+      if (!Unit) {
+        val /= matrix_.eval(i, i);
+      }
+      shrMem[i] = val;
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    if (active && (Lower ? localid > i : localid < i)) {
+      val -= matrix_.eval(localid, i) * shrMem[i];
+    }
+  }
+  if (active) {
+    lhs_.eval(localid) = val;
+  }
+}
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE void DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+}
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE void
+DiagonalBlockTrsv<Lower, Unit, lhs_t, matrix_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS2_TRSV_HPP
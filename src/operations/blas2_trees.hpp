@@ -26,7 +26,13 @@
 #ifndef SYCL_BLAS_BLAS2_TREES_HPP
 #define SYCL_BLAS_BLAS2_TREES_HPP
 
+#include "blas2/csrmv.hpp"
+#include "blas2/gbmv.hpp"
 #include "blas2/gemv.hpp"
 #include "blas2/ger.hpp"
+#include "blas2/spr.hpp"
+#include "blas2/symv.hpp"
+#include "blas2/triangle_block_map.hpp"
+#include "blas2/trsv.hpp"
 
 #endif  // BLAS2_TREES_HPP
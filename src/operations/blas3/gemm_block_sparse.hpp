@@ -0,0 +1,107 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_block_sparse.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GEMM_BLOCK_SPARSE_HPP
+#define SYCL_BLAS_BLAS3_GEMM_BLOCK_SPARSE_HPP
+
+#include "gemm_common.hpp"
+#include "gemm_local.hpp"
+
+namespace blas {
+
+template <typename gemm_t, typename mask_t>
+SYCL_BLAS_INLINE GemmBlockSparse<gemm_t, mask_t>::GemmBlockSparse(
+    gemm_t _gemm, mask_t _mask,
+    typename GemmBlockSparse<gemm_t, mask_t>::index_t _block_size)
+    : gemm_(_gemm),
+      mask_(_mask),
+      block_size_(_block_size),
+      rows_(_gemm.m_),
+      depth_(_gemm.k_),
+      mask_rows_((_gemm.m_ + _block_size - 1) / _block_size) {}
+
+template <typename gemm_t, typename mask_t>
+SYCL_BLAS_INLINE typename GemmBlockSparse<gemm_t, mask_t>::index_t
+GemmBlockSparse<gemm_t, mask_t>::get_size() const {
+  return gemm_.get_size();
+}
+
+template <typename gemm_t, typename mask_t>
+SYCL_BLAS_INLINE bool GemmBlockSparse<gemm_t, mask_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+/*!
+ * @brief Whether any of the blocks of op(A) overlapping its rows [row, row +
+ * rows) and its columns [col, col + cols) holds nonzeros. The Gemm calls it
+ * with the same arguments in all the work items of a work group.
+ */
+template <typename gemm_t, typename mask_t>
+SYCL_BLAS_INLINE bool GemmBlockSparse<gemm_t, mask_t>::operator()(
+    typename GemmBlockSparse<gemm_t, mask_t>::index_t row,
+    typename GemmBlockSparse<gemm_t, mask_t>::index_t rows,
+    typename GemmBlockSparse<gemm_t, mask_t>::index_t col,
+    typename GemmBlockSparse<gemm_t, mask_t>::index_t cols) const {
+  if (row >= rows_) {
+    return false;
+  }
+  const index_t last_block_row =
+      (cl::sycl::min(row + rows, rows_) - 1) / block_size_;
+  const index_t last_block_col =
+      (cl::sycl::min(col + cols, depth_) - 1) / block_size_;
+  for (index_t j = col / block_size_; j <= last_block_col; j++) {
+    for (index_t i = row / block_size_; i <= last_block_row; i++) {
+      if (mask_.eval(i + j * mask_rows_) != 0) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+template <typename gemm_t, typename mask_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE void GemmBlockSparse<gemm_t, mask_t>::eval(
+    sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+  gemm_.eval(scratch, ndItem, *this);
+}
+
+template <typename gemm_t, typename mask_t>
+SYCL_BLAS_INLINE void GemmBlockSparse<gemm_t, mask_t>::bind(
+    cl::sycl::handler &h) {
+  gemm_.bind(h);
+  mask_.bind(h);
+}
+
+template <typename gemm_t, typename mask_t>
+SYCL_BLAS_INLINE void
+GemmBlockSparse<gemm_t, mask_t>::adjust_access_displacement() {
+  gemm_.adjust_access_displacement();
+  mask_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GEMM_BLOCK_SPARSE_HPP
@@ -85,6 +85,21 @@ SYCL_BLAS_INLINE bool do_check<false>(bool) {
   return true;
 }
 
+/*!
+ * @brief Filter of the blocks of A visited by the K loop of a dense Gemm,
+ * which visits all of them.
+ *
+ * A filter is called with the first row and the number of rows of a block of
+ * op(A), and its first column and number of columns, and returns false when
+ * all the elements of the block are zero.
+ */
+struct GemmDenseBlocks {
+  template <typename index_t>
+  SYCL_BLAS_INLINE bool operator()(index_t, index_t, index_t, index_t) const {
+    return true;
+  }
+};
+
 }  // namespace blas
 
 #endif  // SYCL_BLAS_BLAS3_GEMM_COMMON_HPP
@@ -0,0 +1,117 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_device_scalars.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GEMM_DEVICE_SCALARS_HPP
+#define SYCL_BLAS_BLAS3_GEMM_DEVICE_SCALARS_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+SYCL_BLAS_INLINE
+GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t>::GemmDeviceScalars(
+    gemm_t _gemm, gemm_beta_zero_t _gemm_beta_zero, scalar_t _alpha,
+    scalar_t _beta)
+    : gemm_(_gemm),
+      gemm_beta_zero_(_gemm_beta_zero),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+SYCL_BLAS_INLINE
+    typename GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t>::index_t
+    GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t>::get_size() const {
+  return gemm_.get_size();
+}
+
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+SYCL_BLAS_INLINE bool
+GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return gemm_.valid_thread(ndItem);
+}
+
+/*!
+ * @brief Runs the Gemm with local memory. beta is the same for all the work
+ * items, so they all take the same branch.
+ */
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE void
+GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t>::eval(
+    sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+  const value_t alpha = alpha_.eval(0);
+  const value_t beta = beta_.eval(0);
+  if (beta == value_t(0)) {
+    gemm_beta_zero_.alpha_ = alpha;
+    gemm_beta_zero_.eval(scratch, ndItem);
+  } else {
+    gemm_.alpha_ = alpha;
+    gemm_.beta_ = beta;
+    gemm_.eval(scratch, ndItem);
+  }
+}
+
+/*!
+ * @brief Runs the Gemm without local memory.
+ */
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+SYCL_BLAS_INLINE void
+GemmDeviceScalars<gemm_t, gemm_beta_zero_t, scalar_t>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  const value_t alpha = alpha_.eval(0);
+  const value_t beta = beta_.eval(0);
+  if (beta == value_t(0)) {
+    gemm_beta_zero_.alpha_ = alpha;
+    gemm_beta_zero_.eval(ndItem);
+  } else {
+    gemm_.alpha_ = alpha;
+    gemm_.beta_ = beta;
+    gemm_.eval(ndItem);
+  }
+}
+
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+SYCL_BLAS_INLINE void GemmDeviceScalars<gemm_t, gemm_beta_zero_t,
+                                        scalar_t>::bind(cl::sycl::handler &h) {
+  gemm_.bind(h);
+  gemm_beta_zero_.bind(h);
+  alpha_.bind(h);
+  beta_.bind(h);
+}
+
+template <typename gemm_t, typename gemm_beta_zero_t, typename scalar_t>
+SYCL_BLAS_INLINE void
+GemmDeviceScalars<gemm_t, gemm_beta_zero_t,
+                  scalar_t>::adjust_access_displacement() {
+  gemm_.adjust_access_displacement();
+  gemm_beta_zero_.adjust_access_displacement();
+  alpha_.adjust_access_displacement();
+  beta_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GEMM_DEVICE_SCALARS_HPP
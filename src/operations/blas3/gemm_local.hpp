@@ -62,11 +62,11 @@ namespace blas {
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename TileType, bool TransA, bool TransB,
-          typename element_t, bool is_beta_zero>
+          typename element_t, bool is_beta_zero, typename input_b_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
            TransA, TransB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::local),
-           static_cast<int>(gemm_algorithm_t::standard)> {
+           static_cast<int>(gemm_algorithm_t::standard), input_b_t> {
  public:
   using tile_type = TileType;
   using value_t = element_t;
@@ -127,7 +127,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
       (double_buffer + 1) * (ldsa * cl_elems + ldsb * block_cols);
 
   input_t a_;
-  input_t b_;
+  input_b_t b_;
   output_t c_;
   element_t alpha_;
   element_t beta_;
@@ -139,7 +139,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   index_t ldc_;
   index_t batch_size_;
 
-  SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
+  SYCL_BLAS_INLINE Gemm(input_t A, input_b_t B, output_t C, element_t alpha,
                         element_t beta, index_t batch_size)
       : a_(A),
         b_(B),
@@ -228,6 +228,21 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   template <typename local_memory_t>
   SYCL_BLAS_INLINE void eval(local_memory_t scratch_acc,
                              cl::sycl::nd_item<1> id) noexcept {
+    eval(scratch_acc, id, GemmDenseBlocks());
+  }
+
+  /*!
+   * @brief Run the generated GEMM device function, the K loop only visiting
+   * the blocks of A accepted by nonzero_block (see GemmDenseBlocks). The
+   * blocks are the same for all the work items of a work group, so they all
+   * skip the same steps and their barriers.
+   * @tparam k_block_filter_t type of the filter of the blocks of A
+   * @param nonzero_block filter of the blocks of A
+   */
+  template <typename local_memory_t, typename k_block_filter_t>
+  SYCL_BLAS_INLINE void eval(local_memory_t scratch_acc,
+                             cl::sycl::nd_item<1> id,
+                             const k_block_filter_t &nonzero_block) noexcept {
     // The batch index that each workgroup should start working with
     const index_t wg_batch_id = id.get_group(0) / get_workgroup_cluster(m_, n_);
     // This will disable all workgroups that dont have any batch to work on
@@ -301,13 +316,13 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
           id, item_id, m_, mc, n_, nc, a_.get_size_col(), k_, a_size, b_size,
           c_size, alpha_, orig_A, lda_, orig_B, ldb_, beta_, orig_C, ldc_, s1,
           s2, s3, s4, reg_a, reg_b, out_of_range, batch_stride, wg_batch_id,
-          batch_size_);
+          batch_size_, wg_row, nonzero_block);
     } else {
       compute_panel_gemm<double_buffer, true, true>(
           id, item_id, m_, mc, n_, nc, a_.get_size_col(), k_, a_size, b_size,
           c_size, alpha_, orig_A, lda_, orig_B, ldb_, beta_, orig_C, ldc_, s1,
           s2, s3, s4, reg_a, reg_b, out_of_range, batch_stride, wg_batch_id,
-          batch_size_);
+          batch_size_, wg_row, nonzero_block);
     }
   }
 
@@ -338,20 +353,25 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
    *                        out-of-bound
    * @tparam check_n_limit  iff true, check if no indexes of C are
    *                        out-of-bound
+   * @param wg_row  first row of the block-row of A
+   * @param nonzero_block  filter of the blocks of A, the steps of the K loop
+   *                       on blocks of zeros being skipped
    */
   template <bool double_buffer, bool check_m_limit, bool check_n_limit,
-            typename InputPointerType, typename OutputPointerType,
-            typename ScratchPointerType>
+            typename InputPointerTypeA, typename InputPointerTypeB,
+            typename OutputPointerType, typename ScratchPointerType,
+            typename k_block_filter_t>
   static SYCL_BLAS_INLINE void compute_panel_gemm(
       cl::sycl::nd_item<1> id, index_t item_id, index_t m, index_t mc,
       index_t n, index_t nc, index_t orig_k, index_t k, index_t a_size,
-      index_t b_size, index_t c_size, element_t alpha, InputPointerType orig_A,
-      index_t lda, InputPointerType orig_B, index_t ldb, element_t beta,
+      index_t b_size, index_t c_size, element_t alpha, InputPointerTypeA orig_A,
+      index_t lda, InputPointerTypeB orig_B, index_t ldb, element_t beta,
       OutputPointerType orig_C, index_t ldc, ScratchPointerType s1,
       ScratchPointerType s2, ScratchPointerType s3, ScratchPointerType s4,
       element_t (&reg_a)[item_rows], element_t &reg_b, const bool out_of_range,
       const index_t batch_stride, const index_t wg_batch_id,
-      index_t batch_size) noexcept {
+      index_t batch_size, const index_t wg_row,
+      const k_block_filter_t &nonzero_block) noexcept {
     index_t ofs = 1;
     do {
       auto A = orig_A;
@@ -359,18 +379,20 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
       auto C = orig_C;
       element_t reg_res[item_rows][item_cols] = {};
       while (k >= cl_elems) {
-        extract_input_blocks<check_m_limit, check_n_limit, false>(
-            item_id, m, n, k, A, lda, B, ldb, s1, s3, out_of_range);
-        id.barrier(cl::sycl::access::fence_space::local_space);
-        compute_block_gemm(s2, s4, reg_a, reg_b, reg_res);
+        if (nonzero_block(wg_row, block_rows, orig_k - k, cl_elems)) {
+          extract_input_blocks<check_m_limit, check_n_limit, false>(
+              item_id, m, n, k, A, lda, B, ldb, s1, s3, out_of_range);
+          id.barrier(cl::sycl::access::fence_space::local_space);
+          compute_block_gemm(s2, s4, reg_a, reg_b, reg_res);
+          sync_smem<double_buffer, block_cols * ldsb, block_cols * ldsb,
+                    ldsa * cl_elems, ldsa * cl_elems>(id, ofs, s1, s2, s3, s4);
+        }
         A = A + cl_elems * (trans_a ? 1 : lda);
         B = B + cl_elems * (trans_b ? ldb : 1);
         k -= cl_elems;
-        sync_smem<double_buffer, block_cols * ldsb, block_cols * ldsb,
-                  ldsa * cl_elems, ldsa * cl_elems>(id, ofs, s1, s2, s3, s4);
       }
 
-      if (k > 0) {
+      if (k > 0 && nonzero_block(wg_row, block_rows, orig_k - k, k)) {
         extract_input_blocks<check_m_limit, check_n_limit, true>(
             item_id, m, n, k, A, lda, B, ldb, s1, s3, out_of_range);
         id.barrier(cl::sycl::access::fence_space::local_space);
@@ -443,10 +465,11 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
    * @see GemmFactory::extract_block()
    */
   template <bool check_m_limit, bool check_n_limit, bool check_k_limit,
-            typename InputPointerType, typename ScratchPointerType>
+            typename InputPointerTypeA, typename InputPointerTypeB,
+            typename ScratchPointerType>
   static SYCL_BLAS_INLINE void extract_input_blocks(
-      index_t item_id, index_t m, index_t n, index_t k, InputPointerType A,
-      index_t lda, InputPointerType B, index_t ldb, ScratchPointerType sB,
+      index_t item_id, index_t m, index_t n, index_t k, InputPointerTypeA A,
+      index_t lda, InputPointerTypeB B, index_t ldb, ScratchPointerType sB,
       ScratchPointerType sA, const bool out_of_range) noexcept {
     if (out_of_range) {
       return;
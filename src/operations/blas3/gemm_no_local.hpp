@@ -53,11 +53,11 @@ namespace blas {
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
-          typename element_t, bool is_beta_zero>
+          typename element_t, bool is_beta_zero, typename input_b_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::no_local),
-           static_cast<int>(gemm_algorithm_t::standard)> {
+           static_cast<int>(gemm_algorithm_t::standard), input_b_t> {
  public:
   using value_t = element_t;
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
@@ -89,7 +89,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
                 " --- this is ensured iff: item_rows | wg_cols");
 
   input_t a_;
-  input_t b_;
+  input_b_t b_;
   output_t c_;
   element_t alpha_;
   element_t beta_;
@@ -100,7 +100,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   index_t ldb_;
   index_t ldc_;
   index_t batch_size_;
-  SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
+  SYCL_BLAS_INLINE Gemm(input_t A, input_b_t B, output_t C, element_t alpha,
                         element_t beta, index_t batch_size)
       : a_(A),
         b_(B),
@@ -47,12 +47,14 @@ namespace blas {
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
-     TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm>::
-    Gemm(input_t A, input_t B, output_t C, element_t alpha, element_t beta,
-         typename std::make_signed<typename input_t::index_t>::type batch_size)
+     TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
+     input_b_t>::Gemm(input_t A, input_b_t B, output_t C, element_t alpha,
+                      element_t beta,
+                      typename std::make_signed<
+                          typename input_t::index_t>::type batch_size)
     : a_(A),
       b_(B),
       c_(C),
@@ -68,11 +70,11 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE std::string
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType,
-     GemmAlgorithm>::get_type_string() noexcept {
+     GemmAlgorithm, input_b_t>::get_type_string() noexcept {
   std::ostringstream str{};
   str << "ReferenceGemmFactory<" << wg_size << ", "
       << type_string<value_t>::get_value() << ">";
@@ -86,14 +88,15 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE
     typename Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
                   tile_type, TransA, TransB, element_t, is_beta_zero,
-                  GemmMemoryType, GemmAlgorithm>::index_t
+                  GemmMemoryType, GemmAlgorithm, input_b_t>::index_t
     Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
          TransB, element_t, is_beta_zero, GemmMemoryType,
-         GemmAlgorithm>::get_workgroup_cluster(index_t m, index_t n) noexcept {
+         GemmAlgorithm, input_b_t>::get_workgroup_cluster(index_t m,
+                                                          index_t n) noexcept {
   return ((m * n - 1) / wg_size + 1);
 }
 /*!
@@ -106,73 +109,78 @@ SYCL_BLAS_INLINE
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE typename Gemm<
     input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
-    TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm>::index_t
+    TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
+    input_b_t>::index_t
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
-     TransB, element_t, is_beta_zero, GemmMemoryType,
-     GemmAlgorithm>::get_num_workgroup_cluster(index_t m, index_t n,
-                                               index_t compute_units) noexcept {
+     TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
+     input_b_t>::get_num_workgroup_cluster(index_t m, index_t n,
+                                           index_t compute_units) noexcept {
   constexpr index_t num_gemm_per_compute_units = 4;
   return ((num_gemm_per_compute_units * compute_units - 1) /
               Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
                    tile_type, TransA, TransB, element_t, is_beta_zero,
-                   GemmMemoryType, GemmAlgorithm>::get_workgroup_cluster(m, n) +
+                   GemmMemoryType, GemmAlgorithm,
+                   input_b_t>::get_workgroup_cluster(m, n) +
           1);
 }
 
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE cl::sycl::nd_range<1>
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType,
-     GemmAlgorithm>::get_nd_range(index_t m, index_t n,
-                                  index_t compute_units) noexcept {
+     GemmAlgorithm, input_b_t>::get_nd_range(index_t m, index_t n,
+                                             index_t compute_units) noexcept {
   const cl::sycl::range<1> nwg(
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm>::get_workgroup_cluster(m, n) *
+           GemmAlgorithm, input_b_t>::get_workgroup_cluster(m, n) *
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm>::get_num_workgroup_cluster(m, n, compute_units));
+           GemmAlgorithm, input_b_t>::get_num_workgroup_cluster(m, n,
+                                                                compute_units));
   const cl::sycl::range<1> wgs(wg_size);
   return cl::sycl::nd_range<1>(nwg * wgs, wgs);
 }
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE typename Gemm<
     input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
-    TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm>::index_t
+    TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
+    input_b_t>::index_t
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
-     TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm>::get_size()
-    const {
+     TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
+     input_b_t>::get_size() const {
   return m_ * n_;
 }
 
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE bool
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType,
-     GemmAlgorithm>::valid_thread(cl::sycl::nd_item<1> ndItem) const {
+     GemmAlgorithm, input_b_t>::valid_thread(cl::sycl::nd_item<1> ndItem)
+    const {
   return true;
 }
 
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType,
-     GemmAlgorithm>::eval(cl::sycl::nd_item<1> id) noexcept {
+     GemmAlgorithm, input_b_t>::eval(cl::sycl::nd_item<1> id) noexcept {
   const index_t wg_batch_id = id.get_group(0) / get_workgroup_cluster(m_, n_);
   // This will disable all workgroups that dont have any batch to work on
   if (wg_batch_id >= batch_size_) {
@@ -234,11 +242,11 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType,
-     GemmAlgorithm>::bind(cl::sycl::handler &h) {
+     GemmAlgorithm, input_b_t>::bind(cl::sycl::handler &h) {
   a_.bind(h);
   b_.bind(h);
   c_.bind(h);
@@ -247,11 +255,11 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
-          int GemmAlgorithm>
+          int GemmAlgorithm, typename input_b_t>
 SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType,
-     GemmAlgorithm>::adjust_access_displacement() {
+     GemmAlgorithm, input_b_t>::adjust_access_displacement() {
   a_.adjust_access_displacement();
   b_.adjust_access_displacement();
   c_.adjust_access_displacement();
@@ -0,0 +1,98 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemmt.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GEMMT_HPP
+#define SYCL_BLAS_BLAS3_GEMMT_HPP
+
+#include "operations/blas3_trees.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <typename lhs_t, typename a_t, typename b_t>
+SYCL_BLAS_INLINE Gemmt<lhs_t, a_t, b_t>::Gemmt(
+    lhs_t &_l, a_t &_a, b_t &_b,
+    typename Gemmt<lhs_t, a_t, b_t>::value_t _alpha,
+    typename Gemmt<lhs_t, a_t, b_t>::value_t _beta, bool _lower)
+    : lhs_(_l),
+      a_(_a),
+      b_(_b),
+      alpha_(_alpha),
+      beta_(_beta),
+      lower_(_lower) {}
+
+template <typename lhs_t, typename a_t, typename b_t>
+SYCL_BLAS_INLINE typename Gemmt<lhs_t, a_t, b_t>::index_t
+Gemmt<lhs_t, a_t, b_t>::get_size() const {
+  return triangular_number(lhs_.get_size_row());
+}
+
+template <typename lhs_t, typename a_t, typename b_t>
+SYCL_BLAS_INLINE bool Gemmt<lhs_t, a_t, b_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <typename lhs_t, typename a_t, typename b_t>
+SYCL_BLAS_INLINE typename Gemmt<lhs_t, a_t, b_t>::value_t
+Gemmt<lhs_t, a_t, b_t>::eval(typename Gemmt<lhs_t, a_t, b_t>::index_t k) {
+  index_t i;
+  index_t j;
+  get_packed_coordinates(k, lhs_.get_size_row(), lower_, i, j);
+
+  const index_t depth = a_.get_size_col();
+  value_t acc = value_t(0);
+  for (index_t p = 0; p < depth; p++) {
+    acc += a_.eval(i, p) * b_.eval(p, j);
+  }
+  const value_t res = (beta_ == value_t(0))
+                          ? alpha_ * acc
+                          : alpha_ * acc + beta_ * lhs_.eval(i, j);
+  lhs_.eval(i, j) = res;
+  return res;
+}
+
+template <typename lhs_t, typename a_t, typename b_t>
+SYCL_BLAS_INLINE typename Gemmt<lhs_t, a_t, b_t>::value_t
+Gemmt<lhs_t, a_t, b_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename a_t, typename b_t>
+SYCL_BLAS_INLINE void Gemmt<lhs_t, a_t, b_t>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  a_.bind(h);
+  b_.bind(h);
+}
+
+template <typename lhs_t, typename a_t, typename b_t>
+SYCL_BLAS_INLINE void Gemmt<lhs_t, a_t, b_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  a_.adjust_access_displacement();
+  b_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GEMMT_HPP
@@ -0,0 +1,213 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename spmm.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_SPMM_HPP
+#define SYCL_BLAS_BLAS3_SPMM_HPP
+
+#include "executors/kernel_constructor.h"
+#include "operations/blas3_trees.h"
+#include "operations/blas_constants.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+/*!
+ * @brief The local memory of Spmm holds the column and the value of the
+ * staged nonzeros.
+ */
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+struct LocalMemoryType<using_local_memory::enabled,
+                       Spmm<tile_type, lhs_t, matrix_t, rhs_t>> {
+  using spmm_t = Spmm<tile_type, lhs_t, matrix_t, rhs_t>;
+  using type = IndexValueTuple<typename spmm_t::index_t,
+                               typename spmm_t::value_t>;
+};
+
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE Spmm<tile_type, lhs_t, matrix_t, rhs_t>::Spmm(
+    lhs_t &_l, matrix_t &_matrix, rhs_t &_rhs,
+    typename Spmm<tile_type, lhs_t, matrix_t, rhs_t>::value_t _alpha,
+    typename Spmm<tile_type, lhs_t, matrix_t, rhs_t>::value_t _beta)
+    : lhs_(_l), matrix_(_matrix), rhs_(_rhs), alpha_(_alpha), beta_(_beta) {}
+
+/*!
+ * @brief Number of work groups, one per block of the output matrix.
+ */
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE typename Spmm<tile_type, lhs_t, matrix_t, rhs_t>::index_t
+Spmm<tile_type, lhs_t, matrix_t, rhs_t>::get_num_groups() const {
+  const index_t row_blocks =
+      (lhs_.get_size_row() + block_rows - 1) / block_rows;
+  const index_t col_blocks =
+      (lhs_.get_size_col() + block_cols - 1) / block_cols;
+  return row_blocks * col_blocks;
+}
+
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE typename Spmm<tile_type, lhs_t, matrix_t, rhs_t>::index_t
+Spmm<tile_type, lhs_t, matrix_t, rhs_t>::get_size() const {
+  return get_num_groups() * wg_size;
+}
+
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE bool Spmm<tile_type, lhs_t, matrix_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Every work item takes part in the barriers, the number of steps
+ * being given by the longest row of the block. The elements past the last
+ * row or column are neither computed nor written.
+ */
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename Spmm<tile_type, lhs_t, matrix_t, rhs_t>::value_t
+Spmm<tile_type, lhs_t, matrix_t, rhs_t>::eval(sharedT shrMem,
+                                              cl::sycl::nd_item<1> ndItem) {
+  using nonzero_t = IndexValueTuple<index_t, value_t>;
+  constexpr index_t item_rows = tile_type::item_rows;
+  constexpr index_t item_cols = tile_type::item_cols;
+  constexpr index_t wg_rows = tile_type::wg_rows;
+  constexpr index_t wg_cols = tile_type::wg_cols;
+
+  const index_t m = lhs_.get_size_row();
+  const index_t n = lhs_.get_size_col();
+  const index_t col_blocks = (n + block_cols - 1) / block_cols;
+  const index_t group = ndItem.get_group(0);
+  const index_t row0 = (group / col_blocks) * block_rows;
+  const index_t col0 = (group % col_blocks) * block_cols;
+  const index_t local_id = ndItem.get_local_id(0);
+  // Consecutive work items compute consecutive elements of lhs_ in memory
+  constexpr bool is_col_major = lhs_t::access_layout_t::is_col_major();
+  const index_t item_row =
+      is_col_major ? local_id % wg_rows : local_id / wg_cols;
+  const index_t item_col =
+      is_col_major ? local_id / wg_rows : local_id % wg_cols;
+
+  // The longest row of the block is found once by the work group, in the
+  // local memory used afterwards for the nonzeros
+  index_t max_row_nnz = 0;
+  for (index_t r = local_id; r < block_rows; r += wg_size) {
+    const index_t i = row0 + r;
+    if (i < m) {
+      max_row_nnz = cl::sycl::max(max_row_nnz,
+                                  matrix_.row_end(i) - matrix_.row_begin(i));
+    }
+  }
+  shrMem[local_id] = nonzero_t(max_row_nnz, value_t(0));
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  index_t offset = 1;
+  while (offset < wg_size) {
+    offset <<= 1;
+  }
+  for (offset >>= 1; offset > 0; offset >>= 1) {
+    if (local_id < offset && local_id + offset < wg_size) {
+      shrMem[local_id] = nonzero_t(
+          cl::sycl::max(shrMem[local_id].get_index(),
+                        shrMem[local_id + offset].get_index()),
+          value_t(0));
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+  max_row_nnz = shrMem[0].get_index();
+  // The shared memory is overwritten by the nonzeros
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  index_t row_begin[item_rows];
+  index_t row_nnz[item_rows];
+  value_t acc[item_rows][item_cols];
+  for (index_t ir = 0; ir < item_rows; ir++) {
+    const index_t i = row0 + item_row + ir * wg_rows;
+    row_begin[ir] = (i < m) ? matrix_.row_begin(i) : index_t(0);
+    row_nnz[ir] = (i < m) ? matrix_.row_end(i) - row_begin[ir] : index_t(0);
+    for (index_t ic = 0; ic < item_cols; ic++) {
+      acc[ir][ic] = value_t(0);
+    }
+  }
+
+  for (index_t k0 = 0; k0 < max_row_nnz; k0 += wg_cols) {
+    // Each work item stages one nonzero of each of its rows
+    for (index_t ir = 0; ir < item_rows; ir++) {
+      const index_t k = k0 + item_col;
+      const index_t slot = (item_row + ir * wg_rows) * wg_cols + item_col;
+      shrMem[slot] = (k < row_nnz[ir])
+                         ? nonzero_t(matrix_.col(row_begin[ir] + k),
+                                     matrix_.value(row_begin[ir] + k))
+                         : nonzero_t(index_t(0), value_t(0));
+    }
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+    for (index_t ir = 0; ir < item_rows; ir++) {
+      const index_t staged = cl::sycl::min(wg_cols, row_nnz[ir] - k0);
+      const index_t base = (item_row + ir * wg_rows) * wg_cols;
+      for (index_t s = 0; s < staged; s++) {
+        const nonzero_t nonzero = shrMem[base + s];
+        for (index_t ic = 0; ic < item_cols; ic++) {
+          const index_t j = col0 + item_col + ic * wg_cols;
+          if (j < n) {
+            acc[ir][ic] +=
+                nonzero.get_value() * rhs_.eval(nonzero.get_index(), j);
+          }
+        }
+      }
+    }
+    // The shared memory is overwritten by the next step
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+  for (index_t ir = 0; ir < item_rows; ir++) {
+    const index_t i = row0 + item_row + ir * wg_rows;
+    for (index_t ic = 0; ic < item_cols; ic++) {
+      const index_t j = col0 + item_col + ic * wg_cols;
+      if (i < m && j < n) {
+        lhs_.eval(i, j) = (beta_ == value_t(0))
+                              ? alpha_ * acc[ir][ic]
+                              : alpha_ * acc[ir][ic] + beta_ * lhs_.eval(i, j);
+      }
+    }
+  }
+  return acc[0][0];
+}
+
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE void Spmm<tile_type, lhs_t, matrix_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  rhs_.bind(h);
+}
+
+template <typename tile_type, typename lhs_t, typename matrix_t, typename rhs_t>
+SYCL_BLAS_INLINE void
+Spmm<tile_type, lhs_t, matrix_t, rhs_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_SPMM_HPP
@@ -0,0 +1,124 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trsm.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_TRSM_HPP
+#define SYCL_BLAS_BLAS3_TRSM_HPP
+
+#include "operations/blas3_trees.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::
+    DiagonalBlockTrsm(lhs_t &_l, matrix_t &_matrix,
+                      typename DiagonalBlockTrsm<Lower, Unit, lhs_t,
+                                                 matrix_t>::value_t _alpha)
+    : lhs_(_l), matrix_(_matrix), alpha_(_alpha) {}
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE
+    typename DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::index_t
+    DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::get_size() const {
+  return lhs_.get_size_col();
+}
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE bool
+DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Every work item takes part in loading the triangle to local memory
+  return true;
+}
+
+/*!
+ * @brief Solves the diagonal block. The local memory holds the triangle
+ * (rows * rows elements, column major) followed by one slice of rows elements
+ * per work item, interleaved so that consecutive work items access
+ * consecutive addresses.
+ */
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::eval(
+    local_memory_t shrMem, cl::sycl::nd_item<1> ndItem) {
+  using index_t =
+      typename DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::index_t;
+  using value_t =
+      typename DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::value_t;
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  const index_t col = ndItem.get_global_id(0);
+
+  const index_t rows = matrix_.get_size_row();
+  const index_t nrhs = lhs_.get_size_col();
+  const index_t rhs_disp = rows * rows;
+
+  for (index_t idx = localid; idx < rows * rows; idx += localSz) {
+    const index_t j = idx / rows;
+    const index_t i = idx - j * rows;
+    shrMem[idx] = matrix_.eval(i, j);
+  }
+  if (col < nrhs) {
+    for (index_t i = 0; i < rows; i++) {
+      shrMem[rhs_disp + i * localSz + localid] = alpha_ * lhs_.eval(i, col);
+    }
+  }
+  // This barrier is mandatory to be sure the triangle is in local memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  if (col < nrhs) {
+    for (index_t step = 0; step < rows; step++) {
+      const index_t i = Lower ? step : rows - 1 - step;
+      value_t val = shrMem[rhs_disp + i * localSz + localid];
+      const index_t k_start = Lower ? 0 : i + 1;
+      const index_t k_end = Lower ? i : rows;
+      for (index_t k = k_start; k < k_end; k++) {
+        val -= shrMem[i + k * rows] * shrMem[rhs_disp + k * localSz + localid];
+      }
+      if (!Unit) {
+        val /= shrMem[i + i * rows];
+      }
+      shrMem[rhs_disp + i * localSz + localid] = val;
+      lhs_.eval(i, col) = val;
+    }
+  }
+}
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE void DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+}
+
+template <bool Lower, bool Unit, typename lhs_t, typename matrix_t>
+SYCL_BLAS_INLINE void
+DiagonalBlockTrsm<Lower, Unit, lhs_t, matrix_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_TRSM_HPP
@@ -29,5 +29,10 @@
 #include "blas3/gemm_no_local.hpp"
 #include "blas3/gemm_local.hpp"
 #include "blas3/gemm_partial_local.hpp"
+#include "blas3/gemm_block_sparse.hpp"
+#include "blas3/gemm_device_scalars.hpp"
+#include "blas3/gemmt.hpp"
+#include "blas3/spmm.hpp"
+#include "blas3/trsm.hpp"
 
 #endif  // SYCL_BLAS_BLAS3_TREES_HPP
@@ -0,0 +1,131 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename potrf.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_LAPACK_POTRF_HPP
+#define SYCL_BLAS_LAPACK_POTRF_HPP
+
+#include "operations/lapack_trees.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <bool Lower, typename matrix_t>
+SYCL_BLAS_INLINE LocalPotrf<Lower, matrix_t>::LocalPotrf(
+    matrix_t &_matrix, typename LocalPotrf<Lower, matrix_t>::index_t _n,
+    typename LocalPotrf<Lower, matrix_t>::index_t _batch_size)
+    : matrix_(_matrix), n_(_n), batch_size_(_batch_size) {}
+
+template <bool Lower, typename matrix_t>
+SYCL_BLAS_INLINE typename LocalPotrf<Lower, matrix_t>::index_t
+LocalPotrf<Lower, matrix_t>::get_size() const {
+  return n_ * n_ * batch_size_;
+}
+
+template <bool Lower, typename matrix_t>
+SYCL_BLAS_INLINE bool LocalPotrf<Lower, matrix_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Every work item of a group takes part in the factorization of its matrix
+  return true;
+}
+
+/*!
+ * @brief Factors the matrix of the work group. The local memory holds the
+ * lower triangle of the matrix, column major, and the factorization proceeds
+ * one column at a time with two barriers per column: one after the column is
+ * scaled by the square root of its diagonal element, one after the trailing
+ * triangle is updated.
+ */
+template <bool Lower, typename matrix_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void LocalPotrf<Lower, matrix_t>::eval(
+    local_memory_t shrMem, cl::sycl::nd_item<1> ndItem) {
+  using index_t = typename LocalPotrf<Lower, matrix_t>::index_t;
+  using value_t = typename LocalPotrf<Lower, matrix_t>::value_t;
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  const index_t n = n_;
+  // Consecutive matrices are consecutive columns of a column major view and
+  // consecutive rows of a row major view
+  const index_t batch_disp = ndItem.get_group(0) * n;
+  const index_t row_disp = Lower ? 0 : batch_disp;
+  const index_t col_disp = Lower ? batch_disp : 0;
+
+  for (index_t idx = localid; idx < n * n; idx += localSz) {
+    const index_t j = idx / n;
+    const index_t i = idx - j * n;
+    if (i >= j) {
+      shrMem[idx] = matrix_.eval(row_disp + i, col_disp + j);
+    }
+  }
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  for (index_t k = 0; k < n; k++) {
+    // The diagonal element is only written back once the column is no longer
+    // needed, so every work item can read it here
+    const value_t diag = cl::sycl::sqrt(shrMem[k + k * n]);
+    for (index_t i = k + 1 + localid; i < n; i += localSz) {
+      shrMem[i + k * n] /= diag;
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+    const index_t m = n - k - 1;
+    for (index_t idx = localid; idx < m * m; idx += localSz) {
+      const index_t jj = idx / m;
+      const index_t ii = idx - jj * m;
+      if (ii >= jj) {
+        const index_t i = k + 1 + ii;
+        const index_t j = k + 1 + jj;
+        shrMem[i + j * n] -= shrMem[i + k * n] * shrMem[j + k * n];
+      }
+    }
+    if (localid == 0) {
+      shrMem[k + k * n] = diag;
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+  for (index_t idx = localid; idx < n * n; idx += localSz) {
+    const index_t j = idx / n;
+    const index_t i = idx - j * n;
+    if (i >= j) {
+      matrix_.eval(row_disp + i, col_disp + j) = shrMem[idx];
+    }
+  }
+}
+
+template <bool Lower, typename matrix_t>
+SYCL_BLAS_INLINE void LocalPotrf<Lower, matrix_t>::bind(
+    cl::sycl::handler &h) {
+  matrix_.bind(h);
+}
+
+template <bool Lower, typename matrix_t>
+SYCL_BLAS_INLINE void
+LocalPotrf<Lower, matrix_t>::adjust_access_displacement() {
+  matrix_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_LAPACK_POTRF_HPP
@@ -0,0 +1,30 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_trees.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_LAPACK_TREES_HPP
+#define SYCL_BLAS_LAPACK_TREES_HPP
+
+#include "lapack/potrf.hpp"
+
+#endif  // SYCL_BLAS_LAPACK_TREES_HPP
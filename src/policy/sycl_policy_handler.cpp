@@ -74,6 +74,12 @@ namespace blas {
 
 INSTANTIATE_TEMPLATE_METHODS(float)
 INSTANTIATE_TEMPLATE_METHODS(double)
+// Index arrays, e.g. of sparse matrices
+INSTANTIATE_TEMPLATE_METHODS(int)
+#ifdef COMPLEX_SUPPORT
+INSTANTIATE_TEMPLATE_METHODS(std::complex<float>)
+INSTANTIATE_TEMPLATE_METHODS(std::complex<double>)
+#endif
 
 #define INSTANTIATE_TEMPLATE_METHODS_SPECIAL(ind, val)                        \
   template IndexValueTuple<ind, val>                                          \
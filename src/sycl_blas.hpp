@@ -36,6 +36,8 @@
 
 #include "interface/blas3_interface.hpp"
 
+#include "interface/lapack_interface.hpp"
+
 #include "interface/gemm_launcher.hpp"
 
 #include "operations/blas1_trees.hpp"
@@ -46,6 +48,8 @@
 
 #include "operations/extension_trees.hpp"
 
+#include "operations/lapack_trees.hpp"
+
 #include "operations/blas_constants.hpp"
 
 #include "operations/blas_operators.hpp"
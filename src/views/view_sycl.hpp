@@ -303,6 +303,349 @@ struct MatrixView<
   }
 };
 
+/*!
+ * @brief Pointer into a column-major matrix stored in a single triangle.
+ *
+ * It supports the pointer arithmetic the Gemm kernels use on their inputs.
+ * Reads locate the element from its linear offset and, when it falls in the
+ * triangle which is not stored, return either the mirrored element or zero.
+ */
+template <typename value_t, typename index_t>
+struct StructuredPointer {
+  value_t *ptr_;
+  index_t ofs_;
+  index_t ld_;
+  matrix_structure_t structure_;
+  bool lower_;
+  bool unit_;
+
+  SYCL_BLAS_INLINE StructuredPointer operator+(index_t i) const {
+    StructuredPointer p = *this;
+    p.ofs_ += i;
+    return p;
+  }
+
+  SYCL_BLAS_INLINE StructuredPointer &operator+=(index_t i) {
+    ofs_ += i;
+    return *this;
+  }
+
+  SYCL_BLAS_INLINE value_t operator[](index_t i) const {
+    const index_t idx = ofs_ + i;
+    const index_t col = idx / ld_;
+    const index_t row = idx - col * ld_;
+    const bool stored = lower_ ? (row >= col) : (row <= col);
+    if (structure_ == matrix_structure_t::symmetric) {
+      return stored ? ptr_[idx] : ptr_[col + row * ld_];
+    }
+    return (unit_ && row == col) ? value_t(1)
+                                 : (stored ? ptr_[idx] : value_t(0));
+  }
+};
+
+template <typename matrix_t>
+struct StructuredMatrixView {
+  using access_layout_t = typename matrix_t::access_layout_t;
+  using scalar_t = typename matrix_t::scalar_t;
+  using value_t = typename matrix_t::value_t;
+  using index_t = typename matrix_t::index_t;
+  using pointer_t = StructuredPointer<scalar_t, index_t>;
+
+  static_assert(access_layout_t::is_col_major(),
+                "Structured matrices must be column major");
+
+  matrix_t matrix_;
+  const matrix_structure_t structure_;
+  const bool lower_;
+  const bool unit_;
+
+  SYCL_BLAS_INLINE StructuredMatrixView(matrix_t matrix,
+                                        matrix_structure_t structure,
+                                        bool lower, bool unit)
+      : matrix_(matrix), structure_(structure), lower_(lower), unit_(unit) {}
+
+  SYCL_BLAS_INLINE const index_t get_size() const {
+    return matrix_.get_size();
+  }
+
+  SYCL_BLAS_INLINE const index_t getSizeL() const { return matrix_.getSizeL(); }
+
+  SYCL_BLAS_INLINE const index_t get_size_row() const {
+    return matrix_.get_size_row();
+  }
+
+  SYCL_BLAS_INLINE const index_t get_size_col() const {
+    return matrix_.get_size_col();
+  }
+
+  SYCL_BLAS_INLINE pointer_t get_pointer() const {
+    return pointer_t{matrix_.get_pointer(), index_t(0), matrix_.getSizeL(),
+                     structure_, lower_, unit_};
+  }
+
+  SYCL_BLAS_INLINE value_t eval(index_t i, index_t j) const noexcept {
+    return get_pointer()[i + matrix_.getSizeL() * j];
+  }
+
+  SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) { matrix_.bind(h); }
+
+  SYCL_BLAS_INLINE void adjust_access_displacement() {
+    matrix_.adjust_access_displacement();
+  }
+};
+
+template <typename matrix_t>
+struct BandMatrixView {
+  using access_layout_t = typename matrix_t::access_layout_t;
+  using scalar_t = typename matrix_t::scalar_t;
+  using value_t = typename matrix_t::value_t;
+  using index_t = typename matrix_t::index_t;
+
+  static_assert(access_layout_t::is_col_major(),
+                "The band storage must be column major");
+
+  matrix_t matrix_;
+  const index_t sizeR_;  // number of rows of the band matrix
+  const index_t kl_;     // number of stored subdiagonals
+  const index_t ku_;     // number of stored superdiagonals
+  const matrix_structure_t structure_;
+  const bool lower_;
+  const bool unit_;
+
+  SYCL_BLAS_INLINE BandMatrixView(matrix_t matrix, index_t sizeR, index_t kl,
+                                  index_t ku, matrix_structure_t structure,
+                                  bool lower, bool unit)
+      : matrix_(matrix),
+        sizeR_(sizeR),
+        kl_(kl),
+        ku_(ku),
+        structure_(structure),
+        lower_(lower),
+        unit_(unit) {}
+
+  SYCL_BLAS_INLINE const index_t get_size() const {
+    return sizeR_ * matrix_.get_size_col();
+  }
+
+  SYCL_BLAS_INLINE const index_t get_size_row() const { return sizeR_; }
+
+  SYCL_BLAS_INLINE const index_t get_size_col() const {
+    return matrix_.get_size_col();
+  }
+
+  /*!
+   * @brief Number of subdiagonals of the matrix, including the mirrored ones
+   * of a symmetric matrix.
+   */
+  SYCL_BLAS_INLINE const index_t get_kl() const {
+    return (structure_ == matrix_structure_t::symmetric) ? kl_ + ku_ : kl_;
+  }
+
+  /*!
+   * @brief Number of superdiagonals of the matrix, including the mirrored
+   * ones of a symmetric matrix.
+   */
+  SYCL_BLAS_INLINE const index_t get_ku() const {
+    return (structure_ == matrix_structure_t::symmetric) ? kl_ + ku_ : ku_;
+  }
+
+  SYCL_BLAS_INLINE value_t eval(index_t i, index_t j) const noexcept {
+    if (structure_ == matrix_structure_t::triangular && unit_ && i == j) {
+      return value_t(1);
+    }
+    const bool mirrored = (structure_ == matrix_structure_t::symmetric) &&
+                          (lower_ ? (i < j) : (i > j));
+    const index_t si = mirrored ? j : i;
+    const index_t sj = mirrored ? i : j;
+    const index_t d = si - sj;
+    return (d <= kl_ && -d <= ku_) ? matrix_.eval(ku_ + d, sj) : value_t(0);
+  }
+
+  SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) { matrix_.bind(h); }
+
+  SYCL_BLAS_INLINE void adjust_access_displacement() {
+    matrix_.adjust_access_displacement();
+  }
+};
+
+/*!
+ * @brief Computes the row i and the column j of the element k of a triangle of
+ * order n stored in the packed layout (see PackedMatrixView).
+ *
+ * The offset of the element (i, j) of an upper triangle is i + j * (j + 1) / 2,
+ * so its column is recovered with a square root, corrected for the rounding.
+ * A lower triangle stored in the packed layout, read backwards, is the upper
+ * triangle of the matrix with its rows and columns reversed.
+ */
+template <typename index_t>
+SYCL_BLAS_INLINE void get_packed_coordinates(index_t k, index_t n, bool lower,
+                                             index_t &i, index_t &j) {
+  const index_t r = lower ? triangular_number(n) - 1 - k : k;
+  j = static_cast<index_t>(
+      (cl::sycl::sqrt(8.0f * static_cast<float>(r) + 1.0f) - 1.0f) / 2.0f);
+  while (triangular_number(j) > r) {
+    j--;
+  }
+  while (triangular_number(j + 1) <= r) {
+    j++;
+  }
+  i = r - triangular_number(j);
+  if (lower) {
+    i = n - 1 - i;
+    j = n - 1 - j;
+  }
+}
+
+template <typename vector_t>
+struct PackedMatrixView {
+  using scalar_t = typename vector_t::scalar_t;
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  vector_t data_;
+  const index_t n_;  // order of the matrix
+  const matrix_structure_t structure_;
+  const bool lower_;
+  const bool unit_;
+
+  SYCL_BLAS_INLINE PackedMatrixView(vector_t data, index_t n,
+                                    matrix_structure_t structure, bool lower,
+                                    bool unit)
+      : data_(data), n_(n), structure_(structure), lower_(lower), unit_(unit) {}
+
+  SYCL_BLAS_INLINE const index_t get_size() const { return n_ * n_; }
+
+  /*!
+   * @brief Number of elements of the packed storage.
+   */
+  SYCL_BLAS_INLINE const index_t get_packed_size() const {
+    return triangular_number(n_);
+  }
+
+  SYCL_BLAS_INLINE const index_t get_size_row() const { return n_; }
+
+  SYCL_BLAS_INLINE const index_t get_size_col() const { return n_; }
+
+  SYCL_BLAS_INLINE bool is_lower() const { return lower_; }
+
+  /*!
+   * @brief Number of subdiagonals and superdiagonals which may be non-zero,
+   * so that the band kernels skip the triangle of zeros of a triangular
+   * matrix.
+   */
+  SYCL_BLAS_INLINE const index_t get_kl() const {
+    return (structure_ == matrix_structure_t::triangular && !lower_)
+               ? index_t(0)
+               : n_ - 1;
+  }
+
+  SYCL_BLAS_INLINE const index_t get_ku() const {
+    return (structure_ == matrix_structure_t::triangular && lower_)
+               ? index_t(0)
+               : n_ - 1;
+  }
+
+  /*!
+   * @brief Offset in the packed storage of the element (i, j) of the stored
+   * triangle.
+   */
+  SYCL_BLAS_INLINE index_t packed_index(index_t i, index_t j) const {
+    return get_packed_index(i, j, n_, lower_);
+  }
+
+  SYCL_BLAS_INLINE value_t eval(index_t i, index_t j) const noexcept {
+    const bool stored = lower_ ? (i >= j) : (i <= j);
+    if (structure_ == matrix_structure_t::symmetric) {
+      return stored ? data_.eval(packed_index(i, j))
+                    : data_.eval(packed_index(j, i));
+    }
+    return (unit_ && i == j)
+               ? value_t(1)
+               : (stored ? data_.eval(packed_index(i, j)) : value_t(0));
+  }
+
+  /*!
+   * @brief Reference to the element k of the packed storage.
+   */
+  SYCL_BLAS_INLINE scalar_t &eval(index_t k) { return data_.eval(k); }
+
+  SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) { data_.bind(h); }
+
+  SYCL_BLAS_INLINE void adjust_access_displacement() {
+    data_.adjust_access_displacement();
+  }
+};
+
+template <typename index_vector_t, typename value_vector_t>
+struct CsrMatrixView {
+  using scalar_t = typename value_vector_t::scalar_t;
+  using value_t = typename value_vector_t::value_t;
+  using index_t = typename value_vector_t::index_t;
+
+  index_vector_t row_ptr_;
+  index_vector_t col_ind_;
+  value_vector_t values_;
+  const index_t rows_;  // number of rows
+  const index_t cols_;  // number of columns
+  const index_t nnz_;   // number of nonzeros
+
+  SYCL_BLAS_INLINE CsrMatrixView(index_vector_t row_ptr,
+                                 index_vector_t col_ind, value_vector_t values,
+                                 index_t rows, index_t cols, index_t nnz)
+      : row_ptr_(row_ptr),
+        col_ind_(col_ind),
+        values_(values),
+        rows_(rows),
+        cols_(cols),
+        nnz_(nnz) {}
+
+  SYCL_BLAS_INLINE const index_t get_size() const { return rows_ * cols_; }
+
+  SYCL_BLAS_INLINE const index_t get_size_row() const { return rows_; }
+
+  SYCL_BLAS_INLINE const index_t get_size_col() const { return cols_; }
+
+  SYCL_BLAS_INLINE const index_t get_nnz() const { return nnz_; }
+
+  /*!
+   * @brief Offset in values of the first nonzero of row i.
+   */
+  SYCL_BLAS_INLINE index_t row_begin(index_t i) const {
+    return static_cast<index_t>(row_ptr_.eval(i));
+  }
+
+  /*!
+   * @brief Offset in values of the first nonzero after row i.
+   */
+  SYCL_BLAS_INLINE index_t row_end(index_t i) const {
+    return static_cast<index_t>(row_ptr_.eval(i + 1));
+  }
+
+  /*!
+   * @brief Column of the nonzero k.
+   */
+  SYCL_BLAS_INLINE index_t col(index_t k) const {
+    return static_cast<index_t>(col_ind_.eval(k));
+  }
+
+  /*!
+   * @brief Value of the nonzero k.
+   */
+  SYCL_BLAS_INLINE value_t value(index_t k) const { return values_.eval(k); }
+
+  SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) {
+    row_ptr_.bind(h);
+    col_ind_.bind(h);
+    values_.bind(h);
+  }
+
+  SYCL_BLAS_INLINE void adjust_access_displacement() {
+    row_ptr_.adjust_access_displacement();
+    col_ind_.adjust_access_displacement();
+    values_.adjust_access_displacement();
+  }
+};
+
 }  // namespace blas
 
 #endif  // VIEW_SYCL_HPP
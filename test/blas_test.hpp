@@ -100,4 +100,35 @@ static inline void fill_random(std::vector<scalar_t> &vec) {
   }
 }
 
+template <typename scalar_t>
+static inline void fill_random(std::vector<std::complex<scalar_t>> &vec) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> dis(-2.0, 5.0);
+  for (std::complex<scalar_t> &e : vec) {
+    e = std::complex<scalar_t>(dis(gen), dis(gen));
+  }
+}
+
+/**
+ * @fn make_device_scalar
+ * @brief Returns a buffer of one element holding value, written by a _dot of
+ * two vectors of one element, like a scalar computed by a previous kernel and
+ * passed to the next one without going through the host.
+ */
+template <typename scalar_t>
+static inline BufferIterator<scalar_t, codeplay_policy> make_device_scalar(
+    test_executor_t &ex, scalar_t value) {
+  const scalar_t one = scalar_t(1);
+  auto lhs = blas::make_sycl_iterator_buffer<scalar_t>(1);
+  auto rhs = blas::make_sycl_iterator_buffer<scalar_t>(1);
+  auto result = blas::make_sycl_iterator_buffer<scalar_t>(1);
+  auto event = ex.get_policy_handler().copy_to_device(&value, lhs, 1);
+  ex.get_policy_handler().wait(event);
+  event = ex.get_policy_handler().copy_to_device(&one, rhs, 1);
+  ex.get_policy_handler().wait(event);
+  _dot(ex, 1, lhs, 1, rhs, 1, result);
+  return result;
+}
+
 #endif /* end of include guard: BLAS_TEST_HPP */
@@ -0,0 +1,139 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_csrmv_dot_test.cpp
+ *
+ *
+#include "blas_test.hpp"
+#include "sycl_blas.hpp"
+
+// inputs combination
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, scalar_t>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  scalar_t alpha;
+  std::tie(m, n, alpha) = combi;
+
+  // CSR matrix with (i % 9) nonzeros on row i
+  std::vector<int> row_ptr(1, 0);
+  std::vector<int> col_ind;
+  for (int i = 0; i < m; i++) {
+    for (int k = 0; k < i % 9; k++) {
+      col_ind.push_back((i + k * 11) % n);
+    }
+    row_ptr.push_back(static_cast<int>(col_ind.size()));
+  }
+  const int nnz = row_ptr[m];
+  std::vector<scalar_t> values(nnz);
+  fill_random(values);
+
+  // Input vectors x, z and w, and output vector y
+  std::vector<scalar_t> v_x(n);
+  std::vector<scalar_t> v_z(m);
+  std::vector<scalar_t> v_w(m);
+  std::vector<scalar_t> v_y(m);
+  fill_random(v_x);
+  fill_random(v_z);
+  fill_random(v_w);
+
+  // Reference implementation: y = alpha * A * x + z, then dot(w, y)
+  std::vector<scalar_t> v_cpu_y(m);
+  for (int i = 0; i < m; i++) {
+    scalar_t acc = 0;
+    for (int k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+      acc += values[k] * v_x[col_ind[k]];
+    }
+    v_cpu_y[i] = alpha * acc + v_z[i];
+  }
+  scalar_t cpu_dot = reference_blas::dot(m, v_w.data(), 1, v_cpu_y.data(), 1);
+
+  // SYCL-BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_row_ptr = blas::make_sycl_iterator_buffer<int>(row_ptr, m + 1);
+  auto gpu_col_ind = blas::make_sycl_iterator_buffer<int>(col_ind, nnz);
+  auto gpu_values = blas::make_sycl_iterator_buffer<scalar_t>(values, nnz);
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(v_x, n);
+  auto gpu_z_v = blas::make_sycl_iterator_buffer<scalar_t>(v_z, m);
+  auto gpu_w_v = blas::make_sycl_iterator_buffer<scalar_t>(v_w, m);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(m);
+  auto gpu_dot = blas::make_sycl_iterator_buffer<scalar_t>(1);
+
+  // Views
+  auto view_a = make_csr_matrix_view(ex, gpu_row_ptr, gpu_col_ind, gpu_values,
+                                     m, n, nnz);
+  auto view_x = make_vector_view(ex, gpu_x_v, 1, n);
+  auto view_z = make_vector_view(ex, gpu_z_v, 1, m);
+  auto view_w = make_vector_view(ex, gpu_w_v, 1, m);
+  auto view_y = make_vector_view(ex, gpu_y_v, 1, m);
+  auto view_dot = make_vector_view(ex, gpu_dot, 1, 1);
+
+  // Assign reduction parameters
+  const auto localSize = ex.get_policy_handler().get_work_group_size();
+  const auto nWG = 2 * localSize;
+
+  // CSRMV + AXPY + DOT expressions, evaluated by the reduction kernel
+  auto csrmv_op = make_csrmv(view_a, view_x);
+  auto scal_op = make_op<ScalarOp, ProductOperator>(alpha, csrmv_op);
+  auto add_op = make_op<BinaryOp, AddOperator>(scal_op, view_z);
+  auto assign_op = make_op<Assign>(view_y, add_op);
+  auto prod_op = make_op<BinaryOp, ProductOperator>(view_w, assign_op);
+  auto dot_op = make_AssignReduction<AddOperator>(view_dot, prod_op, localSize,
+                                                  localSize * nWG);
+
+  // Execute the CSRMV+AXPY+DOT tree
+  auto event = ex.execute(dot_op);
+  ex.get_policy_handler().wait(event);
+
+  // Copy the results back to host memory
+  std::vector<scalar_t> v_dot(1);
+  auto getDotEv =
+      ex.get_policy_handler().copy_to_host(gpu_dot, v_dot.data(), 1);
+  auto getResultEv =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, v_y.data(), m);
+  ex.get_policy_handler().wait(getDotEv);
+  ex.get_policy_handler().wait(getResultEv);
+
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_y, v_y));
+  ASSERT_TRUE(utils::almost_equal(cpu_dot, v_dot[0]));
+}
+
+const auto combi = ::testing::Combine(::testing::Values(17, 1023),  // m
+                                      ::testing::Values(13, 511),   // n
+                                      ::testing::Values(1.34));     // alpha
+
+class CsrmvDotTreeFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(CsrmvDotTreeFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(csrmvdot, CsrmvDotTreeFloat, combi);
+
+#if DOUBLE_SUPPORT
+class CsrmvDotTreeDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(CsrmvDotTreeDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(csrmvdot, CsrmvDotTreeDouble, combi);
+#endif
@@ -26,7 +26,7 @@
 #include "blas_test.hpp"
 
 template <typename scalar_t>
-using combination_t = std::tuple<int, scalar_t, int, int>;
+using combination_t = std::tuple<int, scalar_t, int, int, bool>;
 
 template <typename scalar_t>
 void run_test(const combination_t<scalar_t> combi) {
@@ -34,7 +34,8 @@ void run_test(const combination_t<scalar_t> combi) {
   scalar_t alpha;
   int incX;
   int incY;
-  std::tie(size, alpha, incX, incY) = combi;
+  bool device_alpha;
+  std::tie(size, alpha, incX, incY, device_alpha) = combi;
 
   // Input vector
   std::vector<scalar_t> x_v(size * incX);
@@ -57,7 +58,12 @@ void run_test(const combination_t<scalar_t> combi) {
   auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
   ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
 
-  _axpy(ex, size, alpha, gpu_x_v, incX, gpu_y_v, incY);
+  if (device_alpha) {
+    auto gpu_alpha = make_device_scalar(ex, alpha);
+    _axpy(ex, size, gpu_alpha, gpu_x_v, incX, gpu_y_v, incY);
+  } else {
+    _axpy(ex, size, alpha, gpu_x_v, incX, gpu_y_v, incY);
+  }
   auto event =
       ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), size * incY);
   ex.get_policy_handler().wait(event);
@@ -71,14 +77,17 @@ const auto combi =
     ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
                        ::testing::Values(0.0, 1.0, 1.5),          // alpha
                        ::testing::Values(1, 4),                   // incX
-                       ::testing::Values(1, 3)                    // incY
+                       ::testing::Values(1, 3),                   // incY
+                       ::testing::Values(false, true)  // device_alpha
     );
 #else
-const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
-                                      ::testing::Values(0.0, 1.5),  // alpha
-                                      ::testing::Values(1, 4),      // incX
-                                      ::testing::Values(1, 3)       // incY
-);
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1002),    // size
+                       ::testing::Values(0.0, 1.5),    // alpha
+                       ::testing::Values(1, 4),        // incX
+                       ::testing::Values(1, 3),        // incY
+                       ::testing::Values(false, true)  // device_alpha
+    );
 #endif
 
 class AxpyFloat : public ::testing::TestWithParam<combination_t<float>> {};
@@ -0,0 +1,112 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_complex_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  using complex_t = std::complex<scalar_t>;
+  int size;
+  int incX;
+  int incY;
+  std::tie(size, incX, incY) = combi;
+
+  const complex_t alpha(1.5, -0.5);
+
+  // Input vectors
+  std::vector<complex_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<complex_t> y_v(size * incY);
+  fill_random(y_v);
+  std::vector<complex_t> y_cpu_v(y_v);
+
+  // Reference implementation, the dot products use y before the axpy
+  auto dotu_cpu_s =
+      reference_blas::dotu(size, x_v.data(), incX, y_v.data(), incY);
+  auto dotc_cpu_s =
+      reference_blas::dotc(size, x_v.data(), incX, y_v.data(), incY);
+  auto nrm2_cpu_s = reference_blas::nrm2(size, x_v.data(), incX);
+  reference_blas::axpy(size, alpha, x_v.data(), incX, y_cpu_v.data(), incY);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<complex_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<complex_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+  auto gpu_dotu_s = blas::make_sycl_iterator_buffer<complex_t>(int(1));
+  auto gpu_nrm2_s = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+
+  _dot(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_dotu_s);
+  auto dotc_s = _dotc(ex, size, gpu_x_v, incX, gpu_y_v, incY);
+  _nrm2(ex, size, gpu_x_v, incX, gpu_nrm2_s);
+  _axpy(ex, size, alpha, gpu_x_v, incX, gpu_y_v, incY);
+
+  std::vector<complex_t> dotu_s(1);
+  std::vector<scalar_t> nrm2_s(1);
+  auto event0 =
+      ex.get_policy_handler().copy_to_host(gpu_dotu_s, dotu_s.data(), 1);
+  auto event1 =
+      ex.get_policy_handler().copy_to_host(gpu_nrm2_s, nrm2_s.data(), 1);
+  auto event2 = ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(),
+                                                     size * incY);
+  ex.get_policy_handler().wait(event0);
+  ex.get_policy_handler().wait(event1);
+  ex.get_policy_handler().wait(event2);
+
+  // Validate the results
+  ASSERT_TRUE(utils::almost_equal(dotu_s[0], dotu_cpu_s));
+  ASSERT_TRUE(utils::almost_equal(dotc_s, dotc_cpu_s));
+  ASSERT_TRUE(utils::almost_equal(nrm2_s[0], nrm2_cpu_s));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3)                    // incY
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3)       // incY
+);
+#endif
+
+class ComplexBlas1Float : public ::testing::TestWithParam<combination_t> {};
+TEST_P(ComplexBlas1Float, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(complex_blas1, ComplexBlas1Float, combi);
+
+#if DOUBLE_SUPPORT
+class ComplexBlas1Double : public ::testing::TestWithParam<combination_t> {};
+TEST_P(ComplexBlas1Double, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(complex_blas1, ComplexBlas1Double, combi);
+#endif
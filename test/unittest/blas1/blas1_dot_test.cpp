@@ -66,6 +66,14 @@ void run_test(const combination_t combi) {
   // Validate the result
   ASSERT_TRUE(utils::almost_equal(out_s[0], out_cpu_s));
 
+  // Asynchronous version: both reductions are submitted before waiting
+  auto out_cpu_xx =
+      reference_blas::dot(size, x_v.data(), incX, x_v.data(), incX);
+  auto future_xy = _dot_async(ex, size, gpu_x_v, incX, gpu_y_v, incY);
+  auto future_xx = _dot_async(ex, size, gpu_x_v, incX, gpu_x_v, incX);
+  ASSERT_TRUE(utils::almost_equal(future_xx.get(), out_cpu_xx));
+  ASSERT_TRUE(utils::almost_equal(future_xy.get(), out_cpu_s));
+
   ex.get_policy_handler().get_queue().wait();
 }
 
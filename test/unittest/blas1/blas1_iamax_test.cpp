@@ -39,6 +39,10 @@ void run_test(const combination_t combi) {
   ASSERT_EQ(out_cpu_s, out_s[0].ind);
   ASSERT_EQ(x_v[out_s[0].ind * incX], out_s[0].val);
   ASSERT_EQ(x_v[out_cpu_s * incX], out_s[0].val);
+
+  // Asynchronous version, returning the index only
+  auto future = _iamax_async(ex, size, gpu_x_v, incX);
+  ASSERT_EQ(out_cpu_s, future.get());
 }
 
 class IamaxFloat : public ::testing::TestWithParam<combination_t> {};
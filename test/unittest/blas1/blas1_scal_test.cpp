@@ -26,14 +26,15 @@
 #include "blas_test.hpp"
 
 template <typename scalar_t>
-using combination_t = std::tuple<int, scalar_t, int>;
+using combination_t = std::tuple<int, scalar_t, int, bool>;
 
 template <typename scalar_t>
 void run_test(const combination_t<scalar_t> combi) {
   int size;
   scalar_t alpha;
   int incX;
-  std::tie(size, alpha, incX) = combi;
+  bool device_alpha;
+  std::tie(size, alpha, incX, device_alpha) = combi;
 
   // Input/output vector
   std::vector<scalar_t> x_v(size * incX);
@@ -50,7 +51,12 @@ void run_test(const combination_t<scalar_t> combi) {
   auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
   ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
 
-  _scal(ex, size, alpha, gpu_x_v, incX);
+  if (device_alpha) {
+    auto gpu_alpha = make_device_scalar(ex, alpha);
+    _scal(ex, size, gpu_alpha, gpu_x_v, incX);
+  } else {
+    _scal(ex, size, alpha, gpu_x_v, incX);
+  }
   auto event =
       ex.get_policy_handler().copy_to_host(gpu_x_v, x_v.data(), size * incX);
   ex.get_policy_handler().wait(event);
@@ -64,13 +70,16 @@ void run_test(const combination_t<scalar_t> combi) {
 const auto combi =
     ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
                        ::testing::Values(0.0, 1.0, 1.5),          // alpha
-                       ::testing::Values(1, 4)                    // incX
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(false, true)  // device_alpha
     );
 #else
-const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
-                                      ::testing::Values(0.0, 1.5),  // alpha
-                                      ::testing::Values(4)          // incX
-);
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1002),    // size
+                       ::testing::Values(0.0, 1.5),    // alpha
+                       ::testing::Values(4),           // incX
+                       ::testing::Values(false, true)  // device_alpha
+    );
 #endif
 
 class ScalFloat : public ::testing::TestWithParam<combination_t<float>> {};
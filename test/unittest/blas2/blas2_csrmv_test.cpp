@@ -0,0 +1,160 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_csrmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<int, int, int, bool, scalar_t, int, scalar_t, int, int>;
+
+/*!
+ * @brief Builds the structure of a CSR matrix of m rows and n columns. Row i
+ * has up to max_row_nnz nonzeros, unless skewed, where one row in 97 is full
+ * and the others have at most 4 nonzeros, to unbalance the rows.
+ */
+static inline void make_csr_structure(int m, int n, int max_row_nnz,
+                                      bool skewed, std::vector<int> &row_ptr,
+                                      std::vector<int> &col_ind) {
+  row_ptr.assign(1, 0);
+  col_ind.clear();
+  for (int i = 0; i < m; i++) {
+    int row_nnz = skewed ? ((i % 97 == 0) ? n : i % 5)
+                         : (i * 7) % (max_row_nnz + 1);
+    row_nnz = std::min(row_nnz, n);
+    // Distinct columns, in no particular order
+    for (int k = 0; k < row_nnz; k++) {
+      col_ind.push_back((i + k * (n / row_nnz)) % n);
+    }
+    row_ptr.push_back(static_cast<int>(col_ind.size()));
+  }
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int max_row_nnz;
+  bool skewed;
+  scalar_t alpha;
+  int incX;
+  scalar_t beta;
+  int incY;
+  int algorithm;
+  std::tie(m, n, max_row_nnz, skewed, alpha, incX, beta, incY, algorithm) =
+      combi;
+
+  // Input matrix
+  std::vector<int> row_ptr;
+  std::vector<int> col_ind;
+  make_csr_structure(m, n, max_row_nnz, skewed, row_ptr, col_ind);
+  const int nnz = row_ptr[m];
+  // The buffers of the indices and values hold at least one element
+  col_ind.resize(std::max(nnz, 1));
+  std::vector<scalar_t> values(std::max(nnz, 1));
+  fill_random(values);
+
+  // Input vector
+  std::vector<scalar_t> x_v(n * incX);
+  fill_random(x_v);
+
+  // Output vector, y is not read when beta is zero
+  std::vector<scalar_t> y_v(m * incY);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+  if (beta == scalar_t(0)) {
+    for (int i = 0; i < m; i++) {
+      y_v[i * incY] = std::numeric_limits<scalar_t>::quiet_NaN();
+    }
+  }
+
+  // Reference implementation
+  for (int i = 0; i < m; i++) {
+    scalar_t acc = 0;
+    for (int k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+      acc += values[k] * x_v[col_ind[k] * incX];
+    }
+    y_cpu_v[i * incY] = (beta == scalar_t(0))
+                            ? alpha * acc
+                            : alpha * acc + beta * y_cpu_v[i * incY];
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto row_ptr_gpu = blas::make_sycl_iterator_buffer<int>(row_ptr, m + 1);
+  auto col_ind_gpu =
+      blas::make_sycl_iterator_buffer<int>(col_ind, std::max(nnz, 1));
+  auto values_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(values, std::max(nnz, 1));
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, n * incX);
+  auto y_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_v, m * incY);
+
+  // SYCL CSRMV
+  _csrmv(ex, m, n, nnz, alpha, row_ptr_gpu, col_ind_gpu, values_gpu, x_v_gpu,
+         incX, beta, y_v_gpu, incY,
+         static_cast<blas::csrmv_algorithm_t>(algorithm));
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(y_v_gpu, y_v.data(), m * incY);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 14, 257, 2025),  // m
+                       ::testing::Values(1, 13, 1010),       // n
+                       ::testing::Values(0, 3, 40),          // max_row_nnz
+                       ::testing::Values(false, true),       // skewed
+                       ::testing::Values(1.5),               // alpha
+                       ::testing::Values(1, 2),              // incX
+                       ::testing::Values(0.0, 1.0, 1.5),     // beta
+                       ::testing::Values(1, 3),              // incY
+                       ::testing::Values(0, 1, 2)            // algorithm
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi =
+    ::testing::Combine(::testing::Values(2025),          // m
+                       ::testing::Values(1013),          // n
+                       ::testing::Values(40),            // max_row_nnz
+                       ::testing::Values(false, true),   // skewed
+                       ::testing::Values(1.5),           // alpha
+                       ::testing::Values(2),             // incX
+                       ::testing::Values(0.0, 1.5),      // beta
+                       ::testing::Values(3),             // incY
+                       ::testing::Values(0, 1, 2)        // algorithm
+    );
+#endif
+
+class CsrmvFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(CsrmvFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(csrmv, CsrmvFloat, combi);
+
+#if DOUBLE_SUPPORT
+class CsrmvDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(CsrmvDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(csrmv, CsrmvDouble, combi);
+#endif
@@ -0,0 +1,119 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gbmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, int, int, int, int, scalar_t, int, int,
+                                 scalar_t, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char trans;
+  int m;
+  int n;
+  int kl;
+  int ku;
+  scalar_t alpha;
+  int lda_pad;
+  int incX;
+  scalar_t beta;
+  int incY;
+  std::tie(trans, m, n, kl, ku, alpha, lda_pad, incX, beta, incY) = combi;
+  // Band storage, with padding rows which must not be read
+  int lda = kl + ku + 1 + lda_pad;
+  int x_size = (trans == 'n') ? n : m;
+  int y_size = (trans == 'n') ? m : n;
+
+  // Input matrix
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(a_m);
+
+  // Input vector
+  std::vector<scalar_t> x_v(x_size * incX);
+  fill_random(x_v);
+
+  // Output Vector
+  std::vector<scalar_t> y_v(y_size * incY, 1.0);
+  std::vector<scalar_t> y_cpu_v(y_size * incY, 1.0);
+
+  // SYSTEM GBMV
+  reference_blas::gbmv(&trans, m, n, kl, ku, alpha, a_m.data(), lda,
+                       x_v.data(), incX, beta, y_cpu_v.data(), incY);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size * incX);
+  auto y_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_v, y_size * incY);
+
+  // SYCLgbmv
+  _gbmv(ex, trans, m, n, kl, ku, alpha, a_m_gpu, lda, x_v_gpu, incX, beta,
+        y_v_gpu, incY);
+
+  auto event = ex.get_policy_handler().copy_to_host(y_v_gpu, y_v.data(),
+                                                    y_size * incY);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('n', 't'),       // TRANS
+                       ::testing::Values(14, 257, 1010),  // m
+                       ::testing::Values(14, 257, 1010),  // n
+                       ::testing::Values(0, 1, 4, 33),    // kl
+                       ::testing::Values(0, 2, 17),       // ku
+                       ::testing::Values(0.0, 1.5),       // alpha
+                       ::testing::Values(0, 3),           // lda_pad
+                       ::testing::Values(1, 2),           // incX
+                       ::testing::Values(0.0, 1.0, 1.5),  // beta
+                       ::testing::Values(1, 3)            // incY
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('n', 't'),  // TRANS
+                                      ::testing::Values(2025),      // m
+                                      ::testing::Values(1013),      // n
+                                      ::testing::Values(0, 3),      // kl
+                                      ::testing::Values(5),         // ku
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(2),         // lda_pad
+                                      ::testing::Values(2),         // incX
+                                      ::testing::Values(0.0, 1.5),  // beta
+                                      ::testing::Values(3)          // incY
+);
+#endif
+
+class GbmvFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GbmvFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gbmv, GbmvFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GbmvDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GbmvDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gbmv, GbmvDouble, combi);
+#endif
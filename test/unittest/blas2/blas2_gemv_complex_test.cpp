@@ -0,0 +1,116 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_complex_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, char, int, int, int, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  using complex_t = std::complex<scalar_t>;
+  int m;
+  int n;
+  char trans;
+  int incX;
+  int incY;
+  int lda_mul;
+  bool beta_zero;
+  std::tie(m, n, trans, incX, incY, lda_mul, beta_zero) = combi;
+
+  const char t_str[2] = {trans, '\0'};
+  const complex_t alpha(1.5, -0.5);
+  const complex_t beta = beta_zero ? complex_t(0) : complex_t(0.5, 2.0);
+
+  int lda = m * lda_mul;
+  int x = (trans == 'n') ? n : m;
+  int y = (trans == 'n') ? m : n;
+
+  // Input matrix
+  std::vector<complex_t> a_m(lda * n);
+  // Input Vector
+  std::vector<complex_t> b_v(x * incX);
+  // output Vector
+  std::vector<complex_t> c_v_gpu_result(y * incY);
+  fill_random(a_m);
+  fill_random(b_v);
+  fill_random(c_v_gpu_result);
+  // output system vector
+  std::vector<complex_t> c_v_cpu(c_v_gpu_result);
+
+  // SYSTEM GEMMV
+  reference_blas::gemv(t_str, m, n, alpha, a_m.data(), lda, b_v.data(), incX,
+                       beta, c_v_cpu.data(), incY);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<complex_t>(a_m, lda * n);
+  auto v_b_gpu = blas::make_sycl_iterator_buffer<complex_t>(b_v, x * incX);
+  auto v_c_gpu =
+      blas::make_sycl_iterator_buffer<complex_t>(c_v_gpu_result, y * incY);
+
+  // SYCLGEMV
+  _gemv(ex, trans, m, n, alpha, m_a_gpu, lda, v_b_gpu, incX, beta, v_c_gpu,
+        incY);
+  auto event = ex.get_policy_handler().copy_to_host(
+      v_c_gpu, c_v_gpu_result.data(), y * incY);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_v_gpu_result, c_v_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 255, 1023),  // m
+                       ::testing::Values(14, 63, 257, 1010),  // n
+                       ::testing::Values('n', 't', 'c'),      // trans
+                       ::testing::Values(1, 2),               // incX
+                       ::testing::Values(1, 3),               // incY
+                       ::testing::Values(1, 2),               // lda_mul
+                       ::testing::Values(true, false)         // beta_zero
+    );
+#else
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1023),         // m
+                       ::testing::Values(14, 1010),         // n
+                       ::testing::Values('n', 't', 'c'),    // trans
+                       ::testing::Values(2),                // incX
+                       ::testing::Values(3),                // incY
+                       ::testing::Values(2),                // lda_mul
+                       ::testing::Values(true, false)       // beta_zero
+    );
+#endif
+
+class GemvComplexFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemvComplexFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemv_complex, GemvComplexFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemvComplexDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GemvComplexDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemv_complex, GemvComplexDouble, combi);
+#endif
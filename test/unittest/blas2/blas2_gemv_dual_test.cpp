@@ -0,0 +1,118 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_dual_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, scalar_t, scalar_t, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  scalar_t alpha;
+  scalar_t beta;
+  int inc;
+  int lda_mul;
+  std::tie(m, n, alpha, beta, inc, lda_mul) = combi;
+  int lda = m * lda_mul;
+
+  // Input matrix
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(a_m);
+
+  // Input vectors
+  std::vector<scalar_t> x_v(n * inc);
+  fill_random(x_v);
+  std::vector<scalar_t> w_v(m * inc);
+  fill_random(w_v);
+
+  // Output vectors
+  std::vector<scalar_t> y_v(m * inc, scalar_t(10.0));
+  std::vector<scalar_t> y_cpu_v(m * inc, scalar_t(10.0));
+  std::vector<scalar_t> z_v(n * inc, scalar_t(10.0));
+  std::vector<scalar_t> z_cpu_v(n * inc, scalar_t(10.0));
+
+  // SYSTEM GEMV
+  reference_blas::gemv("n", m, n, alpha, a_m.data(), lda, x_v.data(), inc,
+                       beta, y_cpu_v.data(), inc);
+  reference_blas::gemv("t", m, n, alpha, a_m.data(), lda, w_v.data(), inc,
+                       beta, z_cpu_v.data(), inc);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, n * inc);
+  auto w_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(w_v, m * inc);
+  auto y_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_v, m * inc);
+  auto z_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(z_v, n * inc);
+
+  // SYCL dual GEMV
+  _gemv_dual(ex, m, n, alpha, a_m_gpu, lda, x_v_gpu, inc, w_v_gpu, inc, beta,
+             y_v_gpu, inc, z_v_gpu, inc);
+
+  auto event_y =
+      ex.get_policy_handler().copy_to_host(y_v_gpu, y_v.data(), m * inc);
+  auto event_z =
+      ex.get_policy_handler().copy_to_host(z_v_gpu, z_v.data(), n * inc);
+  ex.get_policy_handler().wait(event_y);
+  ex.get_policy_handler().wait(event_z);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(z_v, z_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 255, 1023, 2049),  // m
+                       ::testing::Values(14, 63, 257, 1010),        // n
+                       ::testing::Values(0.0, 1.0, 1.5),            // alpha
+                       ::testing::Values(0.0, 1.0, 1.5),            // beta
+                       ::testing::Values(1, 2),                     // inc
+                       ::testing::Values(1, 2)                      // lda_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values(11, 1023),  // m
+                                      ::testing::Values(14, 1010),  // n
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(0.0, 1.5),  // beta
+                                      ::testing::Values(2),         // inc
+                                      ::testing::Values(2)          // lda_mul
+);
+#endif
+
+class GemvDualFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemvDualFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemv_dual, GemvDualFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemvDualDouble : public ::testing::TestWithParam<combination_t<double>> {
+};
+TEST_P(GemvDualDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemv_dual, GemvDualDouble, combi);
+#endif
@@ -26,7 +26,7 @@
 #include "blas_test.hpp"
 
 template <typename T>
-using combination_t = std::tuple<int, int, T, T, bool, int, int, int>;
+using combination_t = std::tuple<int, int, T, T, bool, int, int, int, bool>;
 
 template <typename scalar_t>
 void run_test(const combination_t<scalar_t> combi) {
@@ -38,7 +38,9 @@ void run_test(const combination_t<scalar_t> combi) {
   int incX;
   int incY;
   int lda_mul;
-  std::tie(m, n, alpha, beta, trans, incX, incY, lda_mul) = combi;
+  bool device_scalars;
+  std::tie(m, n, alpha, beta, trans, incX, incY, lda_mul, device_scalars) =
+      combi;
 
   const char *t_str = trans ? "t" : "n";
 
@@ -69,8 +71,15 @@ void run_test(const combination_t<scalar_t> combi) {
       blas::make_sycl_iterator_buffer<scalar_t>(c_v_gpu_result, y * incY);
 
   // SYCLGEMV
-  _gemv(ex, *t_str, m, n, alpha, m_a_gpu, lda, v_b_gpu, incX, beta, v_c_gpu,
-        incY);
+  if (device_scalars) {
+    auto gpu_alpha = make_device_scalar(ex, alpha);
+    auto gpu_beta = make_device_scalar(ex, beta);
+    _gemv(ex, *t_str, m, n, gpu_alpha, m_a_gpu, lda, v_b_gpu, incX, gpu_beta,
+          v_c_gpu, incY);
+  } else {
+    _gemv(ex, *t_str, m, n, alpha, m_a_gpu, lda, v_b_gpu, incX, beta, v_c_gpu,
+          incY);
+  }
   auto event = ex.get_policy_handler().copy_to_host(
       v_c_gpu, c_v_gpu_result.data(), y * incY);
   ex.get_policy_handler().wait(event);
@@ -87,20 +96,23 @@ const auto combi =
                        ::testing::Values(true, false),        // trans
                        ::testing::Values(1, 2),               // incX
                        ::testing::Values(1, 3),               // incY
-                       ::testing::Values(1, 2)                // lda_mul
+                       ::testing::Values(1, 2),               // lda_mul
+                       ::testing::Values(false, true)         // device_scalars
     );
 #else
 // For the purpose of travis and other slower platforms, we need a faster test
 // (the stress_test above takes about ~5 minutes)
-const auto combi = ::testing::Combine(::testing::Values(11, 1023),     // m
-                                      ::testing::Values(14, 1010),     // n
-                                      ::testing::Values(1.5),          // alpha
-                                      ::testing::Values(0.0, 1.5),     // beta
-                                      ::testing::Values(true, false),  // trans
-                                      ::testing::Values(2),            // incX
-                                      ::testing::Values(3),            // incY
-                                      ::testing::Values(2)  // lda_mul
-);
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1023),     // m
+                       ::testing::Values(14, 1010),     // n
+                       ::testing::Values(1.5),          // alpha
+                       ::testing::Values(0.0, 1.5),     // beta
+                       ::testing::Values(true, false),  // trans
+                       ::testing::Values(2),            // incX
+                       ::testing::Values(3),            // incY
+                       ::testing::Values(2),            // lda_mul
+                       ::testing::Values(false, true)   // device_scalars
+    );
 #endif
 
 class GemvFloat : public ::testing::TestWithParam<combination_t<float>> {};
@@ -112,3 +124,80 @@ class GemvDouble : public ::testing::TestWithParam<combination_t<double>> {};
 TEST_P(GemvDouble, test) { run_test<double>(GetParam()); };
 INSTANTIATE_TEST_SUITE_P(gemv, GemvDouble, combi);
 #endif
+
+// m, n, beta, trans
+using single_kernel_combination_t = std::tuple<int, int, double, bool>;
+
+/*!
+ * @brief Checks with the kernel tracer that the default launch parameters run
+ * the single kernel Gemv. It is always taken by the transposed product, whose
+ * work groups reduce a row each, and by the non transposed one when it has a
+ * work group of rows for every compute unit, so m is raised to that number.
+ */
+template <typename scalar_t>
+void run_single_kernel_test(const single_kernel_combination_t combi) {
+  int m;
+  int n;
+  double beta_d;
+  bool trans;
+  std::tie(m, n, beta_d, trans) = combi;
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  if (!trans) {
+    m = std::max(m, static_cast<int>(
+                        ex.get_policy_handler().get_work_group_size() *
+                        ex.get_policy_handler().get_num_compute_units()));
+  }
+
+  const char *t_str = trans ? "t" : "n";
+  const scalar_t alpha = scalar_t(1.5);
+  const scalar_t beta = scalar_t(beta_d);
+  const int lda = m;
+  const int x = trans ? m : n;
+  const int y = trans ? n : m;
+
+  std::vector<scalar_t> a_m(lda * n);
+  std::vector<scalar_t> b_v(x);
+  std::vector<scalar_t> c_v_gpu_result(y, scalar_t(10.0));
+  std::vector<scalar_t> c_v_cpu(y, scalar_t(10.0));
+  fill_random(a_m);
+  fill_random(b_v);
+
+  reference_blas::gemv(t_str, m, n, alpha, a_m.data(), lda, b_v.data(), 1,
+                       beta, c_v_cpu.data(), 1);
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+  auto v_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_v, x);
+  auto v_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_v_gpu_result, y);
+
+  auto &tracer = blas::KernelTracer::get();
+  tracer.clear();
+  tracer.enable();
+  _gemv(ex, *t_str, m, n, alpha, m_a_gpu, lda, v_b_gpu, 1, beta, v_c_gpu, 1);
+  tracer.disable();
+  auto records = tracer.get_records();
+  tracer.clear();
+  ASSERT_EQ(records.size(), 1u);
+  ASSERT_EQ(records[0].name, "blas::Gemv");
+
+  auto event = ex.get_policy_handler().copy_to_host(
+      v_c_gpu, c_v_gpu_result.data(), y);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_v_gpu_result, c_v_cpu));
+}
+
+const auto single_kernel_combi =
+    ::testing::Combine(::testing::Values(11, 1023),    // m
+                       ::testing::Values(14, 63),      // n
+                       ::testing::Values(0.0, 1.5),    // beta
+                       ::testing::Values(true, false)  // trans
+    );
+
+class GemvSingleKernelFloat
+    : public ::testing::TestWithParam<single_kernel_combination_t> {};
+TEST_P(GemvSingleKernelFloat, test) {
+  run_single_kernel_test<float>(GetParam());
+};
+INSTANTIATE_TEST_SUITE_P(gemv, GemvSingleKernelFloat, single_kernel_combi);
@@ -0,0 +1,126 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_rank_update_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<char, int, int, int, int, int>;
+
+// Applies n_updates updates to A, each one through the accumulator and through
+// the reference GER, SYR or SYR2 (every third update of a symmetric matrix)
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  char uplo;
+  int m;
+  int n;
+  int max_rank;
+  int n_updates;
+  int incX;
+  std::tie(uplo, m, n, max_rank, n_updates, incX) = combi;
+  if (uplo != 'g') {
+    n = m;
+  }
+  const int lda = m;
+
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(a_m);
+  std::vector<scalar_t> a_cpu_m(a_m);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+  auto acc = (uplo == 'g')
+                 ? blas::make_ger_accumulator(ex, m, n, a_m_gpu, lda, max_rank)
+                 : blas::make_syr_accumulator(ex, uplo, n, a_m_gpu, lda,
+                                              max_rank);
+
+  // Keeps the update vectors alive until the updates are applied
+  using buffer_t = decltype(a_m_gpu);
+  std::vector<buffer_t> vectors;
+  for (int u = 0; u < n_updates; u++) {
+    const scalar_t alpha = scalar_t(u % 2 ? 0.5 : -1.5);
+    std::vector<scalar_t> x_v(m * incX);
+    std::vector<scalar_t> y_v(n * incX);
+    fill_random(x_v);
+    fill_random(y_v);
+    vectors.push_back(
+        blas::make_sycl_iterator_buffer<scalar_t>(x_v, m * incX));
+    vectors.push_back(
+        blas::make_sycl_iterator_buffer<scalar_t>(y_v, n * incX));
+    auto x_v_gpu = vectors[vectors.size() - 2];
+    auto y_v_gpu = vectors[vectors.size() - 1];
+    if (uplo == 'g') {
+      reference_blas::ger(m, n, alpha, x_v.data(), incX, y_v.data(), incX,
+                          a_cpu_m.data(), lda);
+      acc.ger(alpha, x_v_gpu, incX, y_v_gpu, incX);
+    } else if (u % 3 == 2) {
+      reference_blas::syr2(&uplo, n, alpha, x_v.data(), incX, y_v.data(),
+                           incX, a_cpu_m.data(), lda);
+      acc.syr2(alpha, x_v_gpu, incX, y_v_gpu, incX);
+    } else {
+      reference_blas::syr(&uplo, n, alpha, x_v.data(), incX, a_cpu_m.data(),
+                          lda);
+      acc.syr(alpha, x_v_gpu, incX);
+    }
+  }
+  acc.flush();
+  ASSERT_EQ(acc.get_rank(), 0);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(a_m_gpu, a_m.data(), lda * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(a_m, a_cpu_m));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('g', 'u', 'l'),  // uplo
+                       ::testing::Values(14, 257, 1010),  // m
+                       ::testing::Values(14, 63, 1010),   // n
+                       ::testing::Values(1, 8, 32),       // max_rank
+                       ::testing::Values(1, 7, 40),       // n_updates
+                       ::testing::Values(1, 2)            // incX
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi =
+    ::testing::Combine(::testing::Values('g', 'u', 'l'),  // uplo
+                       ::testing::Values(257),            // m
+                       ::testing::Values(63),             // n
+                       ::testing::Values(8),              // max_rank
+                       ::testing::Values(21),             // n_updates
+                       ::testing::Values(2)               // incX
+    );
+#endif
+
+class RankUpdateFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(RankUpdateFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(rank_update, RankUpdateFloat, combi);
+
+#if DOUBLE_SUPPORT
+class RankUpdateDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(RankUpdateDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(rank_update, RankUpdateDouble, combi);
+#endif
@@ -0,0 +1,102 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_spmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, int, scalar_t, int, scalar_t, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int n;
+  int incX;
+  int incY;
+  char uplo;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(uplo, n, alpha, incX, beta, incY) = combi;
+  int ap_size = (n * (n + 1)) / 2;
+
+  // Input matrix
+  std::vector<scalar_t> a_p(ap_size);
+  fill_random(a_p);
+
+  // Input vector
+  std::vector<scalar_t> x_v(n * incX);
+  fill_random(x_v);
+
+  // Output Vector
+  std::vector<scalar_t> y_v(n * incY, 1.0);
+  std::vector<scalar_t> y_cpu_v(n * incY, 1.0);
+
+  // SYSTEM SPMV
+  reference_blas::spmv(&uplo, n, alpha, a_p.data(), x_v.data(), incX, beta,
+                       y_cpu_v.data(), incY);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_p_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_p, ap_size);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, n * incX);
+  auto y_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_v, n * incY);
+
+  // SYCLspmv
+  _spmv(ex, uplo, n, alpha, a_p_gpu, x_v_gpu, incX, beta, y_v_gpu, incY);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(y_v_gpu, y_v.data(), n * incY);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                 // UPLO
+                       ::testing::Values(14, 63, 257, 1010, 2025),  // n
+                       ::testing::Values(0.0, 1.0, 1.5),            // alpha
+                       ::testing::Values(1, 2),                     // incX
+                       ::testing::Values(0.0, 1.0, 1.5),            // beta
+                       ::testing::Values(1, 3)                      // incY
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                                      ::testing::Values(2025),      // n
+                                      ::testing::Values(0.0, 1.5),  // alpha
+                                      ::testing::Values(2),         // incX
+                                      ::testing::Values(0.0, 1.5),  // beta
+                                      ::testing::Values(3)          // incY
+);
+#endif
+
+class SpmvFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(SpmvFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(spmv, SpmvFloat, combi);
+
+#if DOUBLE_SUPPORT
+class SpmvDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(SpmvDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(spmv, SpmvDouble, combi);
+#endif
@@ -0,0 +1,97 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_spr2_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, int, scalar_t, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int n;
+  int incX;
+  int incY;
+  char uplo;
+  scalar_t alpha;
+  std::tie(uplo, n, alpha, incX, incY) = combi;
+  int ap_size = (n * (n + 1)) / 2;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(n * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(n * incY);
+  fill_random(y_v);
+
+  // Output matrix
+  std::vector<scalar_t> a_p(ap_size, 7.0);
+  std::vector<scalar_t> a_cpu_p(ap_size, 7.0);
+
+  // SYSTEM SPR2
+  reference_blas::spr2(&uplo, n, alpha, x_v.data(), incX, y_v.data(), incY,
+                       a_cpu_p.data());
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, n * incX);
+  auto y_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_v, n * incY);
+  auto a_p_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_p, ap_size);
+
+  // SYCLspr2
+  _spr2(ex, uplo, n, alpha, x_v_gpu, incX, y_v_gpu, incY, a_p_gpu);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(a_p_gpu, a_p.data(), ap_size);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(a_p, a_cpu_p));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                 // UPLO
+                       ::testing::Values(14, 63, 257, 1010, 2025),  // n
+                       ::testing::Values(0.0, 1.0, 1.5),            // alpha
+                       ::testing::Values(1, 2),                     // incX
+                       ::testing::Values(1, 3)                      // incY
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                                      ::testing::Values(14, 1010),  // n
+                                      ::testing::Values(0.0, 1.5),  // alpha
+                                      ::testing::Values(2),         // incX
+                                      ::testing::Values(3)          // incY
+);
+#endif
+
+class Spr2Float : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(Spr2Float, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(spr2, Spr2Float, combi);
+
+#if DOUBLE_SUPPORT
+class Spr2Double : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(Spr2Double, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(spr2, Spr2Double, combi);
+#endif
@@ -0,0 +1,115 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_spr_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include <cstdint>
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, int, scalar_t, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int n;
+  int incX;
+  char uplo;
+  scalar_t alpha;
+  std::tie(uplo, n, alpha, incX) = combi;
+  int ap_size = (n * (n + 1)) / 2;
+
+  // Input vector
+  std::vector<scalar_t> x_v(n * incX);
+  fill_random(x_v);
+
+  // Output matrix
+  std::vector<scalar_t> a_p(ap_size, 7.0);
+  std::vector<scalar_t> a_cpu_p(ap_size, 7.0);
+
+  // SYSTEM SPR
+  reference_blas::spr(&uplo, n, alpha, x_v.data(), incX, a_cpu_p.data());
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, n * incX);
+  auto a_p_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_p, ap_size);
+
+  // SYCLspr
+  _spr(ex, uplo, n, alpha, x_v_gpu, incX, a_p_gpu);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(a_p_gpu, a_p.data(), ap_size);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(a_p, a_cpu_p));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                 // UPLO
+                       ::testing::Values(14, 63, 257, 1010, 2025),  // n
+                       ::testing::Values(0.0, 1.0, 1.5),            // alpha
+                       ::testing::Values(1, 2)                      // incX
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                                      ::testing::Values(14, 1010),  // n
+                                      ::testing::Values(0.0, 1.5),  // alpha
+                                      ::testing::Values(2)          // incX
+);
+#endif
+
+// The packed offsets of a matrix past n = 46340, where n * (n + 1) overflows
+// an int while the packed storage still fits, match the 64 bit formulas
+TEST(PackedIndex, large_order) {
+  for (const int n : {46341, 50000, 65535}) {
+    const int64_t n_l = n;
+    ASSERT_EQ(blas::triangular_number(n), n_l * (n_l + 1) / 2);
+    for (const int j : {0, 1, n / 3, n / 2, n - 2, n - 1}) {
+      const int64_t j_l = j;
+      ASSERT_EQ(blas::triangular_number(j), j_l * (j_l + 1) / 2);
+      // Upper triangle, i <= j
+      for (const int i : {0, j / 2, j}) {
+        ASSERT_EQ(blas::get_packed_index(i, j, n, false),
+                  i + j_l * (j_l + 1) / 2);
+      }
+      // Lower triangle, i >= j
+      for (const int i : {j, (j + n) / 2, n - 1}) {
+        ASSERT_EQ(blas::get_packed_index(i, j, n, true),
+                  i + (2 * n_l - j_l - 1) * j_l / 2);
+      }
+    }
+  }
+}
+
+class SprFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(SprFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(spr, SprFloat, combi);
+
+#if DOUBLE_SUPPORT
+class SprDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(SprDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(spr, SprDouble, combi);
+#endif
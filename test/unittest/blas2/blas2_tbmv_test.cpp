@@ -0,0 +1,101 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_tbmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<char, char, char, int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  char uplo;
+  char trans;
+  char diag;
+  int n;
+  int k;
+  int incX;
+  int lda_pad;
+  std::tie(uplo, trans, diag, n, k, incX, lda_pad) = combi;
+  // Band storage, with padding rows which must not be read
+  int lda = k + 1 + lda_pad;
+
+  // Input matrix
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(a_m);
+
+  // Input/output vector
+  std::vector<scalar_t> x_v(n * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  // SYSTEM TBMV
+  reference_blas::tbmv(&uplo, &trans, &diag, n, k, a_m.data(), lda,
+                       x_cpu_v.data(), incX);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, n * incX);
+
+  // SYCLtbmv
+  _tbmv(ex, uplo, trans, diag, n, k, a_m_gpu, lda, x_v_gpu, incX);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(x_v_gpu, x_v.data(), n * incX);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),           // UPLO
+                       ::testing::Values('n', 't'),           // TRANS
+                       ::testing::Values('u', 'n'),           // DIAG
+                       ::testing::Values(14, 63, 257, 1010),  // n
+                       ::testing::Values(0, 1, 4, 33),        // k
+                       ::testing::Values(1, 2),               // incX
+                       ::testing::Values(0, 3)                // lda_pad
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                                      ::testing::Values('n', 't'),  // TRANS
+                                      ::testing::Values('u', 'n'),  // DIAG
+                                      ::testing::Values(2025),      // n
+                                      ::testing::Values(7),         // k
+                                      ::testing::Values(2),         // incX
+                                      ::testing::Values(2)          // lda_pad
+);
+#endif
+
+class TbmvFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(TbmvFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(tbmv, TbmvFloat, combi);
+
+#if DOUBLE_SUPPORT
+class TbmvDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(TbmvDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(tbmv, TbmvDouble, combi);
+#endif
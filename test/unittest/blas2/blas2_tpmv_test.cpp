@@ -0,0 +1,94 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_tpmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<char, char, char, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int n;
+  int incX;
+  char uplo;
+  char trans;
+  char diag;
+  std::tie(uplo, trans, diag, n, incX) = combi;
+  int ap_size = (n * (n + 1)) / 2;
+
+  // Input matrix
+  std::vector<scalar_t> a_p(ap_size);
+  fill_random(a_p);
+
+  // Input/output vector
+  std::vector<scalar_t> x_v(n * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  // SYSTEM TPMV
+  reference_blas::tpmv(&uplo, &trans, &diag, n, a_p.data(), x_cpu_v.data(),
+                       incX);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_p_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_p, ap_size);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, n * incX);
+
+  // SYCLtpmv
+  _tpmv(ex, uplo, trans, diag, n, a_p_gpu, x_v_gpu, incX);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(x_v_gpu, x_v.data(), n * incX);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                     // UPLO
+                       ::testing::Values('n', 't'),                     // TRANS
+                       ::testing::Values('u', 'n'),                     // DIAG
+                       ::testing::Values(14, 63, 257, 1010, 1024 * 5),  // n
+                       ::testing::Values(1, 2)                          // incX
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                                      ::testing::Values('n', 't'),  // TRANS
+                                      ::testing::Values('u', 'n'),  // DIAG
+                                      ::testing::Values(2025),      // n
+                                      ::testing::Values(2)          // incX
+);
+#endif
+
+class TpmvFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(TpmvFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(tpmv, TpmvFloat, combi);
+
+#if DOUBLE_SUPPORT
+class TpmvDouble : public ::testing::TestWithParam<combination_t> {};
+TEST_P(TpmvDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(tpmv, TpmvDouble, combi);
+#endif
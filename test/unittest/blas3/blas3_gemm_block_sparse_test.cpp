@@ -0,0 +1,140 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_block_sparse_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<char, char, int, int, int, int, int, T, T, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char transa;
+  char transb;
+  int m;
+  int n;
+  int k;
+  int block_size;
+  int density;  // percentage of nonzero blocks
+  scalar_t alpha;
+  scalar_t beta;
+  int ld_mul;
+  std::tie(transa, transb, m, n, k, block_size, density, alpha, beta,
+           ld_mul) = combi;
+
+  const int lda = ((transa == 'n') ? m : k) * ld_mul;
+  const int ldb = ((transb == 'n') ? k : n) * ld_mul;
+  const int ldc = m * ld_mul;
+  const int size_a = lda * ((transa == 'n') ? k : m);
+  const int size_b = ldb * ((transb == 'n') ? n : k);
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> c_m(ldc * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+
+  // Mask of the blocks of op(A), in column major order, the elements of the
+  // zero blocks being set to zero
+  const int mask_rows = (m + block_size - 1) / block_size;
+  const int mask_cols = (k + block_size - 1) / block_size;
+  std::vector<int> mask(mask_rows * mask_cols);
+  int nnz_blocks = 0;
+  for (int b = 0; b < mask_rows * mask_cols; b++) {
+    mask[b] = ((b * 37 + 11) % 100) < density;
+    nnz_blocks += mask[b];
+  }
+  for (int l = 0; l < k; l++) {
+    for (int i = 0; i < m; i++) {
+      if (!mask[i / block_size + (l / block_size) * mask_rows]) {
+        a_m[(transa == 'n') ? i + l * lda : l + i * lda] = scalar_t(0);
+      }
+    }
+  }
+
+  std::vector<scalar_t> c_m_cpu(c_m);
+  reference_blas::gemm(&transa, &transb, m, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_cpu.data(), ldc);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size_a);
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto c_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m, ldc * n);
+  auto mask_gpu =
+      blas::make_sycl_iterator_buffer<int>(mask, mask_rows * mask_cols);
+
+  _gemm_block_sparse(ex, transa, transb, m, n, k, alpha, a_m_gpu, lda, b_m_gpu,
+                     ldb, beta, c_m_gpu, ldc, block_size, mask_gpu,
+                     nnz_blocks);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(c_m_gpu, c_m.data(), ldc * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_m_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('n', 't'),         // transa
+                       ::testing::Values('n', 't'),         // transb
+                       ::testing::Values(1, 33, 130, 512),  // m
+                       ::testing::Values(1, 17, 129),       // n
+                       ::testing::Values(1, 40, 257),       // k
+                       ::testing::Values(16, 32, 48),       // block_size
+                       ::testing::Values(0, 20, 100),       // density
+                       ::testing::Values(1.5),              // alpha
+                       ::testing::Values(0.0, 1.5),         // beta
+                       ::testing::Values(1, 2)              // ld_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi =
+    ::testing::Combine(::testing::Values('n', 't'),  // transa
+                       ::testing::Values('n', 't'),  // transb
+                       ::testing::Values(130),       // m
+                       ::testing::Values(67),        // n
+                       ::testing::Values(257),       // k
+                       ::testing::Values(32),        // block_size
+                       ::testing::Values(20, 90),    // density
+                       ::testing::Values(1.5),       // alpha
+                       ::testing::Values(0.0, 1.5),  // beta
+                       ::testing::Values(2)          // ld_mul
+    );
+#endif
+
+class GemmBlockSparseFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemmBlockSparseFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemm_block_sparse, GemmBlockSparseFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemmBlockSparseDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GemmBlockSparseDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemm_block_sparse, GemmBlockSparseDouble, combi);
+#endif
@@ -0,0 +1,128 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_complex_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<int, int, int, char, char, bool, int, int, int, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  using complex_t = std::complex<scalar_t>;
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  bool beta_zero;
+  int lda_mul;
+  int ldb_mul;
+  int ldc_mul;
+  bool three_m;
+  std::tie(m, n, k, transa, transb, beta_zero, lda_mul, ldb_mul, ldc_mul,
+           three_m) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+  const complex_t alpha(1.5, -0.5);
+  const complex_t beta = beta_zero ? complex_t(0) : complex_t(0.5, 2.0);
+
+  int lda = ((transa != 'n') ? k : m) * lda_mul;
+  int ldb = ((transb != 'n') ? n : k) * ldb_mul;
+  int ldc = m * ldc_mul;
+  int size_a = lda * ((transa != 'n') ? m : k);
+  int size_b = ldb * ((transb != 'n') ? k : n);
+  int size_c = ldc * n;
+
+  std::vector<complex_t> a_m(size_a);
+  std::vector<complex_t> b_m(size_b);
+  std::vector<complex_t> c_m_gpu(size_c);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<complex_t> c_m_cpu(c_m_gpu);
+
+  // Use system blas to create a reference output
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_cpu.data(), ldc);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<complex_t>(a_m, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<complex_t>(b_m, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<complex_t>(c_m_gpu, size_c);
+
+  // SYCL BLAS GEMM implementation
+  _gemm(ex, transa, transb, m, n, k, alpha, m_a_gpu, lda, m_b_gpu, ldb, beta,
+        m_c_gpu, ldc,
+        three_m ? complex_gemm_t::three_m : complex_gemm_t::four_m);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(), size_c);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(7, 65, 255),       // m
+                       ::testing::Values(9, 63, 257),       // n
+                       ::testing::Values(2, 67, 253),       // k
+                       ::testing::Values('n', 't', 'c'),    // transa
+                       ::testing::Values('n', 't', 'c'),    // transb
+                       ::testing::Values(true, false),      // beta_zero
+                       ::testing::Values(1, 2),             // lda_mul
+                       ::testing::Values(1, 2),             // ldb_mul
+                       ::testing::Values(1, 3),             // ldc_mul
+                       ::testing::Values(false, true)       // three_m
+    );
+#else
+const auto combi =
+    ::testing::Combine(::testing::Values(7, 65),            // m
+                       ::testing::Values(9, 63),            // n
+                       ::testing::Values(67),               // k
+                       ::testing::Values('n', 't', 'c'),    // transa
+                       ::testing::Values('n', 'c'),         // transb
+                       ::testing::Values(true, false),      // beta_zero
+                       ::testing::Values(2),                // lda_mul
+                       ::testing::Values(2),                // ldb_mul
+                       ::testing::Values(3),                // ldc_mul
+                       ::testing::Values(false, true)       // three_m
+    );
+#endif
+
+class GemmComplexFloat
+    : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemmComplexFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemm_complex, GemmComplexFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemmComplexDouble
+    : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GemmComplexDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemm_complex, GemmComplexDouble, combi);
+#endif
@@ -23,6 +23,8 @@
  *
  **************************************************************************/
 
+#include <limits>
+
 #include "blas3_gemm_common.hpp"
 #include "blas_test.hpp"
 
@@ -103,11 +105,21 @@ void run_test(const combination_t<scalar_t> combi) {
                                   m_c_gpu + _base(dim_c, ldc_mul, bs),
                                   _size_batch(dim_c, ldc_mul));
 
-    // SYCL BLAS GEMM implementation
-    _gemm(ex, transa, transb, m, n, k, alpha,
-          m_a_gpu + _base(dim_a, lda_mul, bs), lda,
-          m_b_gpu + _base(dim_b, ldb_mul, bs), ldb, beta,
-          m_c_gpu + _base(dim_c, ldc_mul, bs), ldc);
+    // SYCL BLAS GEMM implementation, the odd batches taking alpha and beta
+    // in device memory
+    if (bs % 2) {
+      auto gpu_alpha = make_device_scalar(ex, alpha);
+      auto gpu_beta = make_device_scalar(ex, beta);
+      _gemm(ex, transa, transb, m, n, k, gpu_alpha,
+            m_a_gpu + _base(dim_a, lda_mul, bs), lda,
+            m_b_gpu + _base(dim_b, ldb_mul, bs), ldb, gpu_beta,
+            m_c_gpu + _base(dim_c, ldc_mul, bs), ldc);
+    } else {
+      _gemm(ex, transa, transb, m, n, k, alpha,
+            m_a_gpu + _base(dim_a, lda_mul, bs), lda,
+            m_b_gpu + _base(dim_b, ldb_mul, bs), ldb, beta,
+            m_c_gpu + _base(dim_c, ldc_mul, bs), ldc);
+    }
 
     auto event =
         policy_handler.copy_to_host(m_c_gpu + _base(dim_c, ldc_mul, bs),
@@ -120,6 +132,53 @@ void run_test(const combination_t<scalar_t> combi) {
   ex.get_policy_handler().wait();
 }
 
+// A beta of zero in device memory must not read C, NaNs in C being ignored
+template <typename scalar_t>
+void run_device_beta_zero_test(const char transa, const char transb) {
+  const int m = 33;
+  const int n = 17;
+  const int k = 65;
+  const scalar_t alpha = scalar_t(1.5);
+  const scalar_t beta = scalar_t(0);
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+  const int lda = (transa != 'n') ? k : m;
+  const int ldb = (transb != 'n') ? n : k;
+  const int ldc = m;
+
+  std::vector<scalar_t> a_m(m * k);
+  std::vector<scalar_t> b_m(k * n);
+  std::vector<scalar_t> c_m_gpu(m * n,
+                                std::numeric_limits<scalar_t>::quiet_NaN());
+  std::vector<scalar_t> c_m_cpu(m * n, scalar_t(0));
+  fill_random(a_m);
+  fill_random(b_m);
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_cpu.data(), ldc);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, m * k);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, k * n);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu, m * n);
+  auto gpu_alpha = make_device_scalar(ex, alpha);
+  auto gpu_beta = make_device_scalar(ex, beta);
+  _gemm(ex, transa, transb, m, n, k, gpu_alpha, m_a_gpu, lda, m_b_gpu, ldb,
+        gpu_beta, m_c_gpu, ldc);
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    m * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+TEST(GemmDeviceScalarsFloat, beta_zero_ignores_nan) {
+  run_device_beta_zero_test<float>('n', 'n');
+  run_device_beta_zero_test<float>('t', 'n');
+  run_device_beta_zero_test<float>('n', 't');
+  run_device_beta_zero_test<float>('t', 't');
+}
+
 class GemmFloat : public ::testing::TestWithParam<combination_t<float>> {};
 TEST_P(GemmFloat, test) { run_test<float>(GetParam()); };
 INSTANTIATE_TEST_SUITE_P(gemm, GemmFloat, combi);
@@ -0,0 +1,118 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemmt_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<char, char, char, int, int, T, T, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  char transa;
+  char transb;
+  int n;
+  int k;
+  scalar_t alpha;
+  scalar_t beta;
+  int ld_mul;
+  std::tie(uplo, transa, transb, n, k, alpha, beta, ld_mul) = combi;
+
+  const int lda = ((transa == 'n') ? n : k) * ld_mul;
+  const int ldb = ((transb == 'n') ? k : n) * ld_mul;
+  const int ldc = n * ld_mul;
+  const int size_a = lda * ((transa == 'n') ? k : n);
+  const int size_b = ldb * ((transb == 'n') ? n : k);
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> c_m(ldc * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+
+  // The reference computes the whole product, of which only the triangle is
+  // kept: the other triangle must not be written
+  std::vector<scalar_t> c_m_full(c_m);
+  reference_blas::gemm(&transa, &transb, n, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_full.data(), ldc);
+  std::vector<scalar_t> c_m_cpu(c_m);
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < n; i++) {
+      if ((uplo == 'l') ? (i >= j) : (i <= j)) {
+        c_m_cpu[i + j * ldc] = c_m_full[i + j * ldc];
+      }
+    }
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size_a);
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto c_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m, ldc * n);
+
+  _gemmt(ex, uplo, transa, transb, n, k, alpha, a_m_gpu, lda, b_m_gpu, ldb,
+         beta, c_m_gpu, ldc);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(c_m_gpu, c_m.data(), ldc * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_m_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),             // uplo
+                       ::testing::Values('n', 't'),             // transa
+                       ::testing::Values('n', 't'),             // transb
+                       ::testing::Values(1, 7, 33, 129, 1025),  // n
+                       ::testing::Values(1, 14, 65),            // k
+                       ::testing::Values(0.0, 1.0, 1.5),        // alpha
+                       ::testing::Values(0.0, 1.0, 1.5),        // beta
+                       ::testing::Values(1, 2)                  // ld_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // uplo
+                                      ::testing::Values('n', 't'),  // transa
+                                      ::testing::Values('n', 't'),  // transb
+                                      ::testing::Values(75),        // n
+                                      ::testing::Values(16),        // k
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(0.0, 1.5),  // beta
+                                      ::testing::Values(2)          // ld_mul
+);
+#endif
+
+class GemmtFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GemmtFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemmt, GemmtFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GemmtDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GemmtDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(gemmt, GemmtDouble, combi);
+#endif
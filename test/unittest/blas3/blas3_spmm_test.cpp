@@ -0,0 +1,174 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_spmm_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<char, int, int, int, int, bool, scalar_t, scalar_t, int>;
+
+/*!
+ * @brief Builds the structure of a CSR matrix of m rows and k columns. Row i
+ * has up to max_row_nnz nonzeros, unless skewed, where one row in 97 is full
+ * and the others have at most 4 nonzeros, to unbalance the rows of a block.
+ */
+static inline void make_csr_structure(int m, int k, int max_row_nnz,
+                                      bool skewed, std::vector<int> &row_ptr,
+                                      std::vector<int> &col_ind) {
+  row_ptr.assign(1, 0);
+  col_ind.clear();
+  for (int i = 0; i < m; i++) {
+    int row_nnz = skewed ? ((i % 97 == 0) ? k : i % 5)
+                         : (i * 7) % (max_row_nnz + 1);
+    row_nnz = std::min(row_nnz, k);
+    // Distinct columns, in no particular order
+    for (int l = 0; l < row_nnz; l++) {
+      col_ind.push_back((i + l * (k / row_nnz)) % k);
+    }
+    row_ptr.push_back(static_cast<int>(col_ind.size()));
+  }
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char layout;
+  int m;
+  int n;
+  int k;
+  int max_row_nnz;
+  bool skewed;
+  scalar_t alpha;
+  scalar_t beta;
+  int ld_mul;
+  std::tie(layout, m, n, k, max_row_nnz, skewed, alpha, beta, ld_mul) = combi;
+
+  const bool col_major = layout == 'c';
+  const int ldb = (col_major ? k : n) * ld_mul;
+  const int ldc = (col_major ? m : n) * ld_mul;
+  const int b_size = col_major ? ldb * n : ldb * k;
+  const int c_size = col_major ? ldc * n : ldc * m;
+  auto b_idx = [=](int i, int j) {
+    return col_major ? i + j * ldb : j + i * ldb;
+  };
+  auto c_idx = [=](int i, int j) {
+    return col_major ? i + j * ldc : j + i * ldc;
+  };
+
+  // Input sparse matrix
+  std::vector<int> row_ptr;
+  std::vector<int> col_ind;
+  make_csr_structure(m, k, max_row_nnz, skewed, row_ptr, col_ind);
+  const int nnz = row_ptr[m];
+  // The buffers of the indices and values hold at least one element
+  col_ind.resize(std::max(nnz, 1));
+  std::vector<scalar_t> values(std::max(nnz, 1));
+  fill_random(values);
+
+  // Input dense matrix
+  std::vector<scalar_t> b_m(b_size);
+  fill_random(b_m);
+
+  // Output matrix, C is not read when beta is zero
+  std::vector<scalar_t> c_m(c_size);
+  fill_random(c_m);
+  std::vector<scalar_t> c_cpu_m(c_m);
+  if (beta == scalar_t(0)) {
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < m; i++) {
+        c_m[c_idx(i, j)] = std::numeric_limits<scalar_t>::quiet_NaN();
+      }
+    }
+  }
+
+  // Reference implementation
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < m; i++) {
+      scalar_t acc = 0;
+      for (int l = row_ptr[i]; l < row_ptr[i + 1]; l++) {
+        acc += values[l] * b_m[b_idx(col_ind[l], j)];
+      }
+      c_cpu_m[c_idx(i, j)] = (beta == scalar_t(0))
+                                 ? alpha * acc
+                                 : alpha * acc + beta * c_cpu_m[c_idx(i, j)];
+    }
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto row_ptr_gpu = blas::make_sycl_iterator_buffer<int>(row_ptr, m + 1);
+  auto col_ind_gpu =
+      blas::make_sycl_iterator_buffer<int>(col_ind, std::max(nnz, 1));
+  auto values_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(values, std::max(nnz, 1));
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, b_size);
+  auto c_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m, c_size);
+
+  // SYCL SPMM
+  _spmm(ex, layout, m, n, k, nnz, alpha, row_ptr_gpu, col_ind_gpu, values_gpu,
+        b_m_gpu, ldb, beta, c_m_gpu, ldc);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(c_m_gpu, c_m.data(), c_size);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_cpu_m));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('c', 'r'),          // layout
+                       ::testing::Values(1, 15, 257, 1023),  // m
+                       ::testing::Values(1, 33, 64, 511),    // n
+                       ::testing::Values(1, 17, 1000),       // k
+                       ::testing::Values(0, 3, 40),          // max_row_nnz
+                       ::testing::Values(false, true),       // skewed
+                       ::testing::Values(1.5),               // alpha
+                       ::testing::Values(0.0, 1.0, 1.5),     // beta
+                       ::testing::Values(1, 2)               // ld_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi =
+    ::testing::Combine(::testing::Values('c', 'r'),     // layout
+                       ::testing::Values(257),          // m
+                       ::testing::Values(1, 67),        // n
+                       ::testing::Values(301),          // k
+                       ::testing::Values(40),           // max_row_nnz
+                       ::testing::Values(false, true),  // skewed
+                       ::testing::Values(1.5),          // alpha
+                       ::testing::Values(0.0, 1.5),     // beta
+                       ::testing::Values(2)             // ld_mul
+    );
+#endif
+
+class SpmmFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(SpmmFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(spmm, SpmmFloat, combi);
+
+#if DOUBLE_SUPPORT
+class SpmmDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(SpmmDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(spmm, SpmmDouble, combi);
+#endif
@@ -0,0 +1,112 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_symm_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<char, char, int, int, T, T, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char side;
+  char uplo;
+  int m;
+  int n;
+  scalar_t alpha;
+  scalar_t beta;
+  int lda_mul;
+  int ldb_mul;
+  int ldc_mul;
+  std::tie(side, uplo, m, n, alpha, beta, lda_mul, ldb_mul, ldc_mul) = combi;
+
+  const int k = (side == 'l') ? m : n;
+  const int lda = k * lda_mul;
+  const int ldb = m * ldb_mul;
+  const int ldc = m * ldc_mul;
+
+  // The triangle which is not referenced keeps random values, so that reading
+  // it would make the comparison fail
+  std::vector<scalar_t> a_m(lda * k);
+  std::vector<scalar_t> b_m(ldb * n);
+  std::vector<scalar_t> c_m(ldc * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+
+  std::vector<scalar_t> c_m_cpu(c_m);
+  reference_blas::symm(&side, &uplo, m, n, alpha, a_m.data(), lda, b_m.data(),
+                       ldb, beta, c_m_cpu.data(), ldc);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * k);
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, ldb * n);
+  auto c_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m, ldc * n);
+
+  _symm(ex, side, uplo, m, n, alpha, a_m_gpu, lda, b_m_gpu, ldb, beta, c_m_gpu,
+        ldc);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(c_m_gpu, c_m.data(), ldc * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_m_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('l', 'r'),             // side
+                       ::testing::Values('u', 'l'),             // uplo
+                       ::testing::Values(1, 7, 33, 129, 1025),  // m
+                       ::testing::Values(1, 14, 65, 257),       // n
+                       ::testing::Values(0.0, 1.0, 1.5),        // alpha
+                       ::testing::Values(0.0, 1.0, 1.5),        // beta
+                       ::testing::Values(1, 2),                 // lda_mul
+                       ::testing::Values(1, 3),                 // ldb_mul
+                       ::testing::Values(1, 2)                  // ldc_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('l', 'r'),  // side
+                                      ::testing::Values('u', 'l'),  // uplo
+                                      ::testing::Values(75),        // m
+                                      ::testing::Values(41),        // n
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(0.0, 1.5),  // beta
+                                      ::testing::Values(2),         // lda_mul
+                                      ::testing::Values(3),         // ldb_mul
+                                      ::testing::Values(2)          // ldc_mul
+);
+#endif
+
+class SymmFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(SymmFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(symm, SymmFloat, combi);
+
+#if DOUBLE_SUPPORT
+class SymmDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(SymmDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(symm, SymmDouble, combi);
+#endif
@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_trmm_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<char, char, char, char, int, int, T, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char side;
+  char uplo;
+  char trans;
+  char diag;
+  int m;
+  int n;
+  scalar_t alpha;
+  int lda_mul;
+  int ldb_mul;
+  std::tie(side, uplo, trans, diag, m, n, alpha, lda_mul, ldb_mul) = combi;
+
+  const int k = (side == 'l') ? m : n;
+  const int lda = k * lda_mul;
+  const int ldb = m * ldb_mul;
+
+  // The triangle which is not referenced keeps random values, so that reading
+  // it would make the comparison fail
+  std::vector<scalar_t> a_m(lda * k);
+  std::vector<scalar_t> b_m(ldb * n);
+  fill_random(a_m);
+  fill_random(b_m);
+
+  std::vector<scalar_t> b_m_cpu(b_m);
+  reference_blas::trmm(&side, &uplo, &trans, &diag, m, n, alpha, a_m.data(),
+                       lda, b_m_cpu.data(), ldb);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * k);
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, ldb * n);
+
+  _trmm(ex, side, uplo, trans, diag, m, n, alpha, a_m_gpu, lda, b_m_gpu, ldb);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(b_m_gpu, b_m.data(), ldb * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(b_m, b_m_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('l', 'r'),             // side
+                       ::testing::Values('u', 'l'),             // uplo
+                       ::testing::Values('n', 't'),             // trans
+                       ::testing::Values('u', 'n'),             // diag
+                       ::testing::Values(1, 7, 33, 129, 1025),  // m
+                       ::testing::Values(1, 14, 65, 257),       // n
+                       ::testing::Values(0.0, 1.0, 1.5),        // alpha
+                       ::testing::Values(1, 2),                 // lda_mul
+                       ::testing::Values(1, 3)                  // ldb_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('l', 'r'),  // side
+                                      ::testing::Values('u', 'l'),  // uplo
+                                      ::testing::Values('n', 't'),  // trans
+                                      ::testing::Values('u', 'n'),  // diag
+                                      ::testing::Values(75),        // m
+                                      ::testing::Values(41),        // n
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(2),         // lda_mul
+                                      ::testing::Values(3)          // ldb_mul
+);
+#endif
+
+class TrmmFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(TrmmFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(trmm, TrmmFloat, combi);
+
+#if DOUBLE_SUPPORT
+class TrmmDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(TrmmDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(trmm, TrmmDouble, combi);
+#endif
@@ -0,0 +1,143 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_trsm_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<char, char, char, char, int, int, T, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char side;
+  char uplo;
+  char trans;
+  char diag;
+  int m;
+  int n;
+  scalar_t alpha;
+  int lda_mul;
+  int ldb_mul;
+  int block_size;
+  std::tie(side, uplo, trans, diag, m, n, alpha, lda_mul, ldb_mul,
+           block_size) = combi;
+
+  const int k = (side == 'l') ? m : n;
+  const int lda = k * lda_mul;
+  const int ldb = m * ldb_mul;
+
+  std::vector<scalar_t> a_m(lda * k);
+  std::vector<scalar_t> b_m(ldb * n);
+  fill_random(a_m);
+  fill_random(b_m);
+
+  // Scale the off-diagonal values down and make the diagonal dominant so that
+  // the solve stays well conditioned, including with a unit diagonal. The
+  // other triangle keeps its values and must not be read.
+  for (auto &e : a_m) {
+    e /= static_cast<scalar_t>(k);
+  }
+  for (int i = 0; i < k; i++) {
+    a_m[i * lda + i] += scalar_t{3};
+  }
+
+  std::vector<scalar_t> b_m_cpu(b_m);
+  reference_blas::trsm(&side, &uplo, &trans, &diag, m, n, alpha, a_m.data(),
+                       lda, b_m_cpu.data(), ldb);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * k);
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, ldb * n);
+
+  _trsm(ex, side, uplo, trans, diag, m, n, alpha, a_m_gpu, lda, b_m_gpu, ldb,
+        block_size);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(b_m_gpu, b_m.data(), ldb * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(b_m, b_m_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('l', 'r'),             // side
+                       ::testing::Values('u', 'l'),             // uplo
+                       ::testing::Values('n', 't'),             // trans
+                       ::testing::Values('u', 'n'),             // diag
+                       ::testing::Values(1, 7, 33, 129, 1025),  // m
+                       ::testing::Values(1, 14, 65, 257),       // n
+                       ::testing::Values(0.0, 1.0, 1.5),        // alpha
+                       ::testing::Values(1, 2),                 // lda_mul
+                       ::testing::Values(1, 3),                 // ldb_mul
+                       ::testing::Values(0, 8, 16, 64)          // block_size
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('l', 'r'),  // side
+                                      ::testing::Values('u', 'l'),  // uplo
+                                      ::testing::Values('n', 't'),  // trans
+                                      ::testing::Values('u', 'n'),  // diag
+                                      ::testing::Values(75),        // m
+                                      ::testing::Values(41),        // n
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(2),         // lda_mul
+                                      ::testing::Values(3),         // ldb_mul
+                                      ::testing::Values(0, 16)  // block_size
+);
+#endif
+
+class TrsmFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(TrsmFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(trsm, TrsmFloat, combi);
+
+#if DOUBLE_SUPPORT
+class TrsmDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(TrsmDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(trsm, TrsmDouble, combi);
+#endif
+
+// A diagonal block which doesn't fit in the local memory with one right-hand
+// side is rejected before any kernel is launched
+TEST(Trsm, block_size_exceeds_local_memory) {
+  auto q = make_queue();
+  test_executor_t ex(q);
+  const size_t local_memory = ex.get_policy_handler().get_local_memory_size();
+  int k = 1;
+  while (k <= 4096 && size_t(k) * (k + 1) * sizeof(float) <= local_memory) {
+    k *= 2;
+  }
+  if (k > 4096) {
+    GTEST_SKIP() << "the local memory holds blocks of order 4096";
+  }
+  std::vector<float> a_m(k * k, 1.0f);
+  std::vector<float> b_m(k, 1.0f);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<float>(a_m, k * k);
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<float>(b_m, k);
+  ASSERT_THROW(_trsm(ex, 'l', 'l', 'n', 'n', k, 1, 1.0f, a_m_gpu, k, b_m_gpu,
+                     k, k),
+               std::invalid_argument);
+}
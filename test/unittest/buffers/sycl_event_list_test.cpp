@@ -0,0 +1,81 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_event_list_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+using combination_t = std::tuple<int, int>;
+
+void run_test(const combination_t combi) {
+  int n_first;
+  int n_second;
+  std::tie(n_first, n_second) = combi;
+  using event_t = blas::codeplay_policy::event_t;
+
+  const int size = n_first + n_second;
+  std::vector<float> v(size);
+  fill_random(v);
+  std::vector<float> v_gpu(size, 10.0f);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto gpu_v = blas::make_sycl_iterator_buffer<float>(v, size);
+
+  // One copy per element, the events being split in two lists
+  std::vector<cl::sycl::event> all_events;
+  event_t first;
+  event_t second;
+  for (int i = 0; i < size; i++) {
+    auto event =
+        ex.get_policy_handler().copy_to_host(gpu_v + i, v_gpu.data() + i, 1);
+    all_events.push_back(event[0]);
+    (i < n_first ? first : second).push_back(event[0]);
+  }
+  auto events = blas::concatenate_vectors(first, second);
+
+  ASSERT_EQ(static_cast<int>(events.size()), size);
+  ASSERT_EQ(events.on_heap(),
+            static_cast<size_t>(size) > event_t::inline_size);
+  for (int i = 0; i < size; i++) {
+    ASSERT_TRUE(events[i] == all_events[i]);
+  }
+
+  // Moving and converting keep the events
+  event_t moved(std::move(events));
+  ASSERT_TRUE(events.empty());
+  std::vector<cl::sycl::event> converted = moved;
+  ASSERT_EQ(static_cast<int>(converted.size()), size);
+
+  ex.get_policy_handler().wait(moved);
+  ASSERT_TRUE(utils::compare_vectors(v_gpu, v));
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(0, 1, 5),  // events in first
+                       ::testing::Values(1, 3, 12)  // events in second
+    );
+
+class SyclEventList : public ::testing::TestWithParam<combination_t> {};
+TEST_P(SyclEventList, test) { run_test(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(event_list, SyclEventList, combi);
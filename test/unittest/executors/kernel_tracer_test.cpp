@@ -0,0 +1,121 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename kernel_tracer_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include <sstream>
+
+using combination_t = std::tuple<int>;
+
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int size;
+  std::tie(size) = combi;
+
+  std::vector<scalar_t> a_m(size * size);
+  std::vector<scalar_t> b_m(size * size);
+  std::vector<scalar_t> c_m(size * size);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size * size);
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size * size);
+  auto c_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m, size * size);
+
+  auto &tracer = blas::KernelTracer::get();
+  tracer.clear();
+  tracer.enable();
+  auto axpy_event = _axpy(ex, size, scalar_t(2), a_m_gpu, 1, b_m_gpu, 1);
+  auto gemm_event = _gemm(ex, 'n', 'n', size, size, size, scalar_t(1),
+                          a_m_gpu, size, b_m_gpu, size, scalar_t(0), c_m_gpu,
+                          size);
+  tracer.disable();
+  ex.get_policy_handler().wait(axpy_event, gemm_event);
+
+  // Not recorded
+  _axpy(ex, size, scalar_t(2), a_m_gpu, 1, b_m_gpu, 1);
+
+  auto records = tracer.get_records();
+  ASSERT_EQ(records.size(), axpy_event.size() + gemm_event.size());
+  for (auto &record : records) {
+    ASSERT_FALSE(record.name.empty());
+    ASSERT_GT(record.global_size, 0u);
+    ASSERT_GT(record.local_size, 0u);
+    ASSERT_EQ(record.global_size % record.local_size, 0u);
+    ASSERT_LE(record.submit_begin_us, record.submit_end_us);
+  }
+  ASSERT_TRUE(std::any_of(records.begin(), records.end(), [](
+      const blas::KernelTracer::Record &record) {
+    return record.tree.find("GemmFactory") != std::string::npos;
+  }));
+
+  std::ostringstream trace;
+  tracer.write_chrome_trace(trace);
+  ASSERT_NE(trace.str().find("\"traceEvents\""), std::string::npos);
+  ASSERT_NE(trace.str().find("GemmFactory"), std::string::npos);
+
+  tracer.clear();
+  ex.get_policy_handler().wait();
+}
+
+const auto combi = ::testing::Combine(::testing::Values(33, 128)  // size
+);
+
+class KernelTracerFloat : public ::testing::TestWithParam<combination_t> {};
+TEST_P(KernelTracerFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(kernel_tracer, KernelTracerFloat, combi);
+
+// Past its capacity, the tracer keeps the most recent kernels
+TEST(KernelTracer, capacity) {
+  auto &tracer = blas::KernelTracer::get();
+  tracer.clear();
+  tracer.set_capacity(3);
+  const auto now = blas::KernelTracer::clock_t::now();
+  for (size_t i = 1; i <= 5; i++) {
+    tracer.record<int, void>(cl::sycl::event{}, 1, i, 0, now, now);
+  }
+  auto records = tracer.get_records();
+  ASSERT_EQ(records.size(), 3u);
+  for (size_t i = 0; i < records.size(); i++) {
+    ASSERT_EQ(records[i].global_size, i + 3);
+  }
+  ASSERT_EQ(tracer.get_dropped(), 2u);
+
+  // A smaller capacity keeps the last kernels
+  tracer.set_capacity(2);
+  records = tracer.get_records();
+  ASSERT_EQ(records.size(), 2u);
+  ASSERT_EQ(records[0].global_size, 4u);
+  ASSERT_EQ(records[1].global_size, 5u);
+  ASSERT_EQ(tracer.get_dropped(), 3u);
+
+  tracer.set_capacity(blas::KernelTracer::default_capacity);
+  tracer.clear();
+  ASSERT_TRUE(tracer.get_records().empty());
+  ASSERT_EQ(tracer.get_dropped(), 0u);
+}
@@ -0,0 +1,198 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename runtime_statistics_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+#include <thread>
+
+using combination_t = std::tuple<int, int, int, int>;
+
+// The counters of the routines called with a host or a device beta, and
+// batched, follow the formulas of the benchmarks
+template <typename scalar_t>
+void run_test(const combination_t combi) {
+  int m;
+  int n;
+  int k;
+  int batch_size;
+  std::tie(m, n, k, batch_size) = combi;
+
+  std::vector<scalar_t> a_m(m * k * batch_size);
+  std::vector<scalar_t> b_m(k * n * batch_size);
+  std::vector<scalar_t> c_m(m * n * batch_size);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(a_m, m * k * batch_size);
+  auto b_m_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(b_m, k * n * batch_size);
+  auto c_m_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(c_m, m * n * batch_size);
+  // Created before the reset, as they are computed by a _dot
+  auto gpu_alpha = make_device_scalar(ex, scalar_t(1));
+  auto gpu_beta = make_device_scalar(ex, scalar_t(0));
+
+  auto &statistics = ex.get_statistics();
+  statistics.reset();
+  const double m_d = static_cast<double>(m);
+  const double n_d = static_cast<double>(n);
+  const double k_d = static_cast<double>(k);
+  const double batch = static_cast<double>(batch_size);
+  const double scalar_size = sizeof(scalar_t);
+  const double gemm_flops = (2 * k_d - 1) * m_d * n_d + m_d * n_d;
+  const double gemm_bytes = (m_d * k_d + k_d * n_d + m_d * n_d) * scalar_size;
+  const double beta_flops = 2 * m_d * n_d;
+  const double beta_bytes = m_d * n_d * scalar_size;
+
+  // A zero beta on the host does not add its work
+  _gemm(ex, 'n', 'n', m, n, k, scalar_t(1), a_m_gpu, m, b_m_gpu, k,
+        scalar_t(0), c_m_gpu, m);
+  auto routines = statistics.get_routines();
+  ASSERT_EQ(routines.size(), 1u);
+  ASSERT_EQ(routines["_gemm"].calls, 1u);
+  ASSERT_EQ(routines["_gemm"].flops, gemm_flops);
+  ASSERT_EQ(routines["_gemm"].bytes, gemm_bytes);
+
+  // A beta in device memory is not read on the host, and counted as nonzero
+  _gemm(ex, 'n', 'n', m, n, k, gpu_alpha, a_m_gpu, m, b_m_gpu, k, gpu_beta,
+        c_m_gpu, m);
+  routines = statistics.get_routines();
+  ASSERT_EQ(routines.size(), 1u);
+  ASSERT_EQ(routines["_gemm"].calls, 2u);
+  ASSERT_EQ(routines["_gemm"].flops, 2 * gemm_flops + beta_flops);
+  ASSERT_EQ(routines["_gemm"].bytes, 2 * gemm_bytes + beta_bytes);
+
+  // The batched routine counts every product of the batch
+  auto event = _gemm_batched(ex, 'n', 'n', m, n, k, scalar_t(1), a_m_gpu, m,
+                             b_m_gpu, k, scalar_t(2), c_m_gpu, m, batch_size);
+  ex.get_policy_handler().wait(event);
+  routines = statistics.get_routines();
+  ASSERT_EQ(routines.size(), 2u);
+  ASSERT_EQ(routines["_gemm_batched"].calls, 1u);
+  ASSERT_EQ(routines["_gemm_batched"].flops,
+            batch * (gemm_flops + beta_flops));
+  ASSERT_EQ(routines["_gemm_batched"].bytes,
+            batch * (gemm_bytes + beta_bytes));
+  // The calls of _gemm are unchanged
+  ASSERT_EQ(routines["_gemm"].calls, 2u);
+
+  // The GEMM kernels of the host scalar routines are also counted under
+  // their configuration
+  size_t gemm_kernels = 0;
+  for (auto &configuration : statistics.get_gemm_configurations()) {
+    gemm_kernels += configuration.second.calls;
+  }
+  ASSERT_GE(gemm_kernels, 2u);
+
+  // The device time is only read from a profiling queue
+  for (auto &routine : routines) {
+    ASSERT_GE(routine.second.device_time_ns, 0);
+  }
+}
+
+#ifdef STRESS_TESTING
+const auto combi = ::testing::Combine(::testing::Values(7, 65, 255),  // m
+                                      ::testing::Values(9, 127),      // n
+                                      ::testing::Values(1, 33, 128),  // k
+                                      ::testing::Values(1, 5)  // batch_size
+);
+#else
+const auto combi = ::testing::Combine(::testing::Values(65),   // m
+                                      ::testing::Values(127),  // n
+                                      ::testing::Values(33),   // k
+                                      ::testing::Values(5)     // batch_size
+);
+#endif
+
+class RuntimeStatisticsFloat : public ::testing::TestWithParam<combination_t> {
+};
+TEST_P(RuntimeStatisticsFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(runtime_statistics, RuntimeStatisticsFloat, combi);
+
+// The counters restart from zero after a reset, and the JSON only holds the
+// routines called since
+TEST(RuntimeStatistics, reset) {
+  blas::RuntimeStatistics statistics;
+  const std::vector<cl::sycl::event> no_events;
+  statistics.record_routine("_axpy", 2, 12, no_events);
+  statistics.record_gemm("gemm", 4, 24, no_events);
+  statistics.reset();
+  ASSERT_TRUE(statistics.get_routines().empty());
+  ASSERT_TRUE(statistics.get_gemm_configurations().empty());
+  ASSERT_EQ(statistics.to_json(),
+            "{\"routines\":{},\"gemm_configurations\":{}}");
+
+  statistics.record_routine("_dot", 2, 8, no_events);
+  auto routines = statistics.get_routines();
+  ASSERT_EQ(routines.size(), 1u);
+  ASSERT_EQ(routines["_dot"].calls, 1u);
+  ASSERT_EQ(routines["_dot"].flops, 2);
+  ASSERT_EQ(routines["_dot"].bytes, 8);
+  ASSERT_EQ(statistics.to_json().find("\"_axpy\""), std::string::npos);
+  ASSERT_NE(statistics.to_json().find("\"_dot\""), std::string::npos);
+}
+
+// The calls recorded from several threads, which also read the counters, are
+// all counted
+TEST(RuntimeStatistics, concurrent_recording) {
+  blas::RuntimeStatistics statistics;
+  const std::vector<cl::sycl::event> no_events;
+  const int n_threads = 8;
+  const int n_calls = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < n_threads; t++) {
+    threads.emplace_back([&statistics, &no_events, t]() {
+      const std::string routine = (t % 2 == 0) ? "_axpy" : "_scal";
+      for (int i = 0; i < n_calls; i++) {
+        statistics.record_routine(routine, 1, 2, no_events);
+        statistics.record_gemm("gemm", 3, 4, no_events);
+        if (i % 100 == 0) {
+          statistics.get_routines();
+          statistics.to_json();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  const size_t calls_per_routine = n_threads / 2 * n_calls;
+  auto routines = statistics.get_routines();
+  ASSERT_EQ(routines.size(), 2u);
+  for (auto &routine : routines) {
+    ASSERT_EQ(routine.second.calls, calls_per_routine);
+    ASSERT_EQ(routine.second.flops, calls_per_routine);
+    ASSERT_EQ(routine.second.bytes, 2 * calls_per_routine);
+  }
+  auto configurations = statistics.get_gemm_configurations();
+  ASSERT_EQ(configurations.size(), 1u);
+  ASSERT_EQ(configurations["gemm"].calls, 2 * calls_per_routine);
+  ASSERT_EQ(configurations["gemm"].flops, 6 * calls_per_routine);
+  ASSERT_EQ(configurations["gemm"].bytes, 8 * calls_per_routine);
+}
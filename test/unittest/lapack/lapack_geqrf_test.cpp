@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_geqrf_test.cpp
+ *
+ **************************************************************************/
+
+#include "lapack_qr_common.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int lda_mul;
+  int block_size;
+  std::tie(m, n, lda_mul, block_size) = combi;
+
+  const int lda = m * lda_mul;
+  const int k = std::min(m, n);
+
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(a_m);
+  std::vector<scalar_t> a_m_in(a_m);
+  std::vector<scalar_t> tau(k);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+
+  _geqrf(ex, m, n, a_m_gpu, lda, tau.data(), block_size);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(a_m_gpu, a_m.data(), lda * n);
+  ex.get_policy_handler().wait(event);
+
+  // The padding of the matrix must not be modified
+  for (int j = 0; j < n; j++) {
+    for (int i = m; i < lda; i++) {
+      ASSERT_EQ(a_m[i + j * lda], a_m_in[i + j * lda]);
+    }
+  }
+
+  // Q * R must give back A
+  std::vector<scalar_t> q_m = form_q(m, k, a_m.data(), lda, tau.data());
+  std::vector<scalar_t> r_m(m * n, scalar_t{0});
+  std::vector<scalar_t> expected(m * n);
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < m; i++) {
+      if (i <= j) {
+        r_m[i + j * m] = a_m[i + j * lda];
+      }
+      expected[i + j * m] = a_m_in[i + j * lda];
+    }
+  }
+  const char trans_n = 'n';
+  std::vector<scalar_t> qr_m(m * n);
+  reference_blas::gemm(&trans_n, &trans_n, m, n, m, scalar_t{1}, q_m.data(), m,
+                       r_m.data(), m, scalar_t{0}, qr_m.data(), m);
+  ASSERT_TRUE(utils::compare_vectors(qr_m, expected));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 7, 33, 129, 513),  // m
+                       ::testing::Values(1, 14, 65, 257),      // n
+                       ::testing::Values(1, 2),                // lda_mul
+                       ::testing::Values(0, 1, 8, 64)          // block_size
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values(41, 75),  // m
+                                      ::testing::Values(41, 75),  // n
+                                      ::testing::Values(2),       // lda_mul
+                                      ::testing::Values(0, 16)  // block_size
+);
+#endif
+
+class GeqrfFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GeqrfFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(geqrf, GeqrfFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GeqrfDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GeqrfDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(geqrf, GeqrfDouble, combi);
+#endif
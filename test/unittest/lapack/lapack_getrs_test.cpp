@@ -0,0 +1,108 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_getrs_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<char, int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char trans;
+  int n;
+  int nrhs;
+  int lda_mul;
+  int ldb_mul;
+  std::tie(trans, n, nrhs, lda_mul, ldb_mul) = combi;
+
+  const int lda = n * lda_mul;
+  const int ldb = n * ldb_mul;
+
+  // Make the matrix diagonally dominant so that the system is well
+  // conditioned
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(a_m);
+  for (int i = 0; i < n; i++) {
+    a_m[i + i * lda] += scalar_t(n);
+  }
+  std::vector<scalar_t> x_m(n * nrhs);
+  fill_random(x_m);
+
+  // B = op(A) * X
+  std::vector<scalar_t> b_m(ldb * nrhs);
+  fill_random(b_m);
+  const char trans_n = 'n';
+  reference_blas::gemm(&trans, &trans_n, n, nrhs, n, scalar_t{1}, a_m.data(),
+                       lda, x_m.data(), n, scalar_t{0}, b_m.data(), ldb);
+
+  std::vector<int> ipiv(n, -1);
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+  auto b_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, ldb * nrhs);
+
+  _getrf(ex, n, n, a_m_gpu, lda, ipiv.data());
+  _getrs(ex, trans, n, nrhs, a_m_gpu, lda, ipiv.data(), b_m_gpu, ldb);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(b_m_gpu, b_m.data(), ldb * nrhs);
+  ex.get_policy_handler().wait(event);
+
+  std::vector<scalar_t> result(n * nrhs);
+  for (int j = 0; j < nrhs; j++) {
+    for (int i = 0; i < n; i++) {
+      result[i + j * n] = b_m[i + j * ldb];
+    }
+  }
+  ASSERT_TRUE(utils::compare_vectors(result, x_m));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('n', 't'),         // trans
+                       ::testing::Values(1, 7, 33, 1025),   // n
+                       ::testing::Values(1, 14, 257),       // nrhs
+                       ::testing::Values(1, 2),             // lda_mul
+                       ::testing::Values(1, 3)              // ldb_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('n', 't'),  // trans
+                                      ::testing::Values(75),        // n
+                                      ::testing::Values(41),        // nrhs
+                                      ::testing::Values(2),         // lda_mul
+                                      ::testing::Values(3)          // ldb_mul
+);
+#endif
+
+class GetrsFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(GetrsFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(getrs, GetrsFloat, combi);
+
+#if DOUBLE_SUPPORT
+class GetrsDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(GetrsDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(getrs, GetrsDouble, combi);
+#endif
@@ -0,0 +1,115 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_ormqr_test.cpp
+ *
+ **************************************************************************/
+
+#include "lapack_qr_common.hpp"
+
+template <typename T>
+using combination_t = std::tuple<char, char, int, int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char side;
+  char trans;
+  int m;
+  int n;
+  int k;
+  int ldc_mul;
+  int block_size;
+  std::tie(side, trans, m, n, k, ldc_mul, block_size) = combi;
+
+  const int nq = (side == 'l') ? m : n;
+  k = std::min(k, nq);
+  const int lda = nq;
+  const int ldc = m * ldc_mul;
+
+  std::vector<scalar_t> a_m(lda * k);
+  std::vector<scalar_t> c_m(ldc * n);
+  fill_random(a_m);
+  fill_random(c_m);
+  std::vector<scalar_t> tau(k);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * k);
+  auto c_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m, ldc * n);
+
+  _geqrf(ex, nq, k, a_m_gpu, lda, tau.data());
+  _ormqr(ex, side, trans, m, n, k, a_m_gpu, lda, tau.data(), c_m_gpu, ldc,
+         block_size);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(a_m_gpu, a_m.data(), lda * k);
+  ex.get_policy_handler().wait(event);
+  std::vector<scalar_t> c_m_out(ldc * n);
+  event = ex.get_policy_handler().copy_to_host(c_m_gpu, c_m_out.data(),
+                                               ldc * n);
+  ex.get_policy_handler().wait(event);
+
+  // Reference: op(Q) * C or C * op(Q), with Q formed explicitly
+  std::vector<scalar_t> q_m = form_q(nq, k, a_m.data(), lda, tau.data());
+  std::vector<scalar_t> c_m_cpu(c_m);
+  const char trans_n = 'n';
+  if (side == 'l') {
+    reference_blas::gemm(&trans, &trans_n, m, n, m, scalar_t{1}, q_m.data(),
+                         m, c_m.data(), ldc, scalar_t{0}, c_m_cpu.data(), ldc);
+  } else {
+    reference_blas::gemm(&trans_n, &trans, m, n, n, scalar_t{1}, c_m.data(),
+                         ldc, q_m.data(), n, scalar_t{0}, c_m_cpu.data(), ldc);
+  }
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_out, c_m_cpu));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('l', 'r'),      // side
+                       ::testing::Values('n', 't'),      // trans
+                       ::testing::Values(1, 33, 129),    // m
+                       ::testing::Values(1, 14, 257),    // n
+                       ::testing::Values(1, 16, 65),     // k
+                       ::testing::Values(1, 2),          // ldc_mul
+                       ::testing::Values(0, 1, 8, 64)    // block_size
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('l', 'r'),  // side
+                                      ::testing::Values('n', 't'),  // trans
+                                      ::testing::Values(75),        // m
+                                      ::testing::Values(41),        // n
+                                      ::testing::Values(37),        // k
+                                      ::testing::Values(2),         // ldc_mul
+                                      ::testing::Values(0, 16)  // block_size
+);
+#endif
+
+class OrmqrFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(OrmqrFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(ormqr, OrmqrFloat, combi);
+
+#if DOUBLE_SUPPORT
+class OrmqrDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(OrmqrDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(ormqr, OrmqrDouble, combi);
+#endif
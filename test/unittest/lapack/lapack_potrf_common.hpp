@@ -0,0 +1,88 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_potrf_common.hpp
+ *
+ **************************************************************************/
+
+
+#ifndef SYCL_BLAS_LAPACK_POTRF_COMMON_HPP
+#define SYCL_BLAS_LAPACK_POTRF_COMMON_HPP
+
+#include "blas_test.hpp"
+
+/**
+ * Fills the triangle given by uplo of the n x n matrix a (leading dimension
+ * lda) with the symmetric positive definite matrix R * R^T + n * I. The other
+ * triangle and the padding are left untouched, so that reading them gives
+ * wrong results.
+ */
+template <typename scalar_t>
+static inline void fill_spd(char uplo, std::vector<scalar_t> &a, int n,
+                            int lda) {
+  std::vector<scalar_t> r(n * n);
+  fill_random(r);
+  const char trans_n = 'n';
+  const char trans_t = 't';
+  std::vector<scalar_t> spd(n * n);
+  reference_blas::gemm(&trans_n, &trans_t, n, n, n, scalar_t{1}, r.data(), n,
+                       r.data(), n, scalar_t{0}, spd.data(), n);
+  for (int j = 0; j < n; j++) {
+    for (int i = (uplo == 'l') ? j : 0; i < ((uplo == 'l') ? n : j + 1); i++) {
+      a[i + j * lda] = spd[i + j * n] + ((i == j) ? scalar_t(n) : scalar_t{0});
+    }
+  }
+}
+
+/**
+ * Checks the factor computed in place in a_out against the original matrix
+ * a_in: the triangle given by uplo, multiplied by its transpose, must give
+ * back the original matrix, and the other triangle must not be modified.
+ */
+template <typename scalar_t>
+static inline bool check_potrf(char uplo, int n, int lda,
+                               const scalar_t *a_in, const scalar_t *a_out) {
+  const bool lower = (uplo == 'l');
+  std::vector<scalar_t> factor(n * n, scalar_t{0});
+  std::vector<scalar_t> expected(n * n);
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < n; i++) {
+      const bool in_triangle = lower ? (i >= j) : (i <= j);
+      if (in_triangle) {
+        factor[i + j * n] = a_out[i + j * lda];
+      } else if (a_out[i + j * lda] != a_in[i + j * lda]) {
+        return false;
+      }
+      // The original matrix is only known through the referenced triangle
+      expected[i + j * n] = in_triangle ? a_in[i + j * lda] : a_in[j + i * lda];
+    }
+  }
+
+  const char trans_n = 'n';
+  const char trans_t = 't';
+  std::vector<scalar_t> product(n * n);
+  reference_blas::gemm(lower ? &trans_n : &trans_t, lower ? &trans_t : &trans_n,
+                       n, n, n, scalar_t{1}, factor.data(), n, factor.data(),
+                       n, scalar_t{0}, product.data(), n);
+  return utils::compare_vectors(product, expected);
+}
+
+#endif  // SYCL_BLAS_LAPACK_POTRF_COMMON_HPP
@@ -0,0 +1,83 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_potrf_test.cpp
+ *
+ **************************************************************************/
+
+#include "lapack_potrf_common.hpp"
+
+template <typename T>
+using combination_t = std::tuple<char, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  int n;
+  int lda_mul;
+  int block_size;
+  std::tie(uplo, n, lda_mul, block_size) = combi;
+
+  const int lda = n * lda_mul;
+
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(a_m);
+  fill_spd(uplo, a_m, n, lda);
+  std::vector<scalar_t> a_m_in(a_m);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+
+  _potrf(ex, uplo, n, a_m_gpu, lda, block_size);
+
+  auto event =
+      ex.get_policy_handler().copy_to_host(a_m_gpu, a_m.data(), lda * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(check_potrf(uplo, n, lda, a_m_in.data(), a_m.data()));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                 // uplo
+                       ::testing::Values(1, 7, 32, 33, 129, 1025),  // n
+                       ::testing::Values(1, 2),                     // lda_mul
+                       ::testing::Values(0, 8, 16, 64)  // block_size
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // uplo
+                                      ::testing::Values(75),        // n
+                                      ::testing::Values(2),         // lda_mul
+                                      ::testing::Values(0, 16)  // block_size
+);
+#endif
+
+class PotrfFloat : public ::testing::TestWithParam<combination_t<float>> {};
+TEST_P(PotrfFloat, test) { run_test<float>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(potrf, PotrfFloat, combi);
+
+#if DOUBLE_SUPPORT
+class PotrfDouble : public ::testing::TestWithParam<combination_t<double>> {};
+TEST_P(PotrfDouble, test) { run_test<double>(GetParam()); };
+INSTANTIATE_TEST_SUITE_P(potrf, PotrfDouble, combi);
+#endif
@@ -0,0 +1,62 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename lapack_qr_common.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_LAPACK_QR_COMMON_HPP
+#define SYCL_BLAS_LAPACK_QR_COMMON_HPP
+
+#include "blas_test.hpp"
+
+/**
+ * Forms explicitly the m x m orthogonal matrix Q = H(0) * ... * H(k - 1) from
+ * the reflectors stored below the diagonal of a (leading dimension lda) and
+ * from tau, as returned by _geqrf.
+ */
+template <typename scalar_t>
+static inline std::vector<scalar_t> form_q(int m, int k, const scalar_t *a,
+                                           int lda, const scalar_t *tau) {
+  std::vector<scalar_t> q(m * m, scalar_t{0});
+  for (int i = 0; i < m; i++) {
+    q[i + i * m] = scalar_t{1};
+  }
+  // Q = H(0) * (H(1) * (... * H(k - 1))), applied from the last reflector
+  std::vector<scalar_t> v(m);
+  for (int r = k - 1; r >= 0; r--) {
+    for (int i = 0; i < m; i++) {
+      v[i] = (i < r) ? scalar_t{0} : ((i == r) ? scalar_t{1} : a[i + r * lda]);
+    }
+    for (int j = 0; j < m; j++) {
+      scalar_t dot{0};
+      for (int i = r; i < m; i++) {
+        dot += v[i] * q[i + j * m];
+      }
+      for (int i = r; i < m; i++) {
+        q[i + j * m] -= tau[r] * v[i] * dot;
+      }
+    }
+  }
+  return q;
+}
+
+#endif  // SYCL_BLAS_LAPACK_QR_COMMON_HPP
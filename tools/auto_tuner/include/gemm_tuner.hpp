@@ -35,41 +35,11 @@
 #include "blas_meta.h"
 #include "reference_gemm.hpp"
 #include "sycl_blas.hpp"
+#include "tuner_utils.hpp"
 
 using namespace cl::sycl;
 using namespace blas;
 
-struct TestResultEntry {
-  std::string name;
-  double sec;
-  double gflops;
-  double error;
-
-  TestResultEntry(std::string name) : name(name) {}
-
-  void print() const {
-    std::cout << gflops << " gflops: " << name << " - Time: " << sec
-              << " ms, Error: " << error << "\n";
-  }
-
-  bool operator<(const TestResultEntry &other) const {
-    return gflops < other.gflops;
-  }
-  bool operator>(const TestResultEntry &other) const {
-    return gflops > other.gflops;
-  }
-};
-
-class TestResult : public std::vector<TestResultEntry> {
- public:
-  void print_all() const {
-    std::cout << "== Performance Results ==\n";
-    for (auto &r : *this) {
-      r.print();
-    }
-  }
-};
-
 template <bool _TransA, bool _TransB, typename _data_t,
           gemm_memory_t _MemoryMode, gemm_algorithm_t _ShapeMode>
 struct GemmConfig {
@@ -99,44 +69,6 @@ struct GemmArgs {
   TestResult &results;
 };
 
-template <typename T, typename RndEngine>
-std::vector<T> gen_matrix(int size, T lo, T hi, RndEngine rnd) {
-  std::uniform_real_distribution<T> dst(lo, hi);
-  std::vector<T> v(size);
-  for (auto &e : v) {
-    e = dst(rnd);
-  }
-  return v;
-}
-
-template <typename T>
-T relative_diff(const std::vector<T> &ref, const std::vector<T> &obt) {
-  T mag(0);
-  for (auto x : ref) {
-    mag += x * x;
-  }
-  T diff = std::inner_product(std::begin(ref), std::end(ref), std::begin(obt),
-                              T(0), std::plus<T>(),
-                              [](T x, T y) { return (x - y) * (x - y); });
-  return std::sqrt(diff / mag);
-}
-
-template <typename TestOperator>
-void run_tune(int rep, double flop_cnt, TestResultEntry &result,
-              TestOperator op = TestOperator()) {
-  // warmup
-  op();
-  auto start = std::chrono::steady_clock::now();
-  for (int i = 0; i < rep; ++i) {
-    op();
-  }
-  auto end = std::chrono::steady_clock::now();
-  std::chrono::duration<double> sec_d = end - start;
-  double sec = sec_d.count() / rep;
-  result.sec = sec * 1e3;
-  result.gflops = flop_cnt / sec / 1e9;
-}
-
 template <int Cls, typename Tile, bool DoubleBuffer, bool Nbca, bool Nbcb,
           typename Config, typename T, typename Container, typename Executor>
 // a should not be a reference, the C buffer needs copied
@@ -0,0 +1,211 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2018 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_tuner.hpp
+ *
+ **************************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "blas_meta.h"
+#include "reference_gemv.hpp"
+#include "sycl_blas.hpp"
+#include "tuner_utils.hpp"
+
+using namespace cl::sycl;
+using namespace blas;
+
+/*!
+ * @brief Launch parameters of _gemv_impl, as set by the GemvParams of the
+ * GEMV backends of src/interface/blas2/backend/
+ */
+struct GemvParams {
+  int local_size;
+  int scratch_pad_size;
+  int n_rows_wg;
+  int n_cols_wg;
+
+  std::string get_type_string() const {
+    std::ostringstream str{};
+    str << "GemvParams<" << local_size << ", " << scratch_pad_size << ", "
+        << n_rows_wg << ", " << n_cols_wg << ">";
+    return str.str();
+  }
+};
+
+template <typename element_t, typename container_t, typename executor_t>
+struct GemvArgs {
+  int m;
+  int n;
+  element_t alpha;
+  container_t &a;
+  int lda;
+  container_t &x;
+  element_t beta;
+  container_t y;  // Not a reference - need new copy every time
+  container_t &refY;
+  executor_t &ex;
+  TestResult &results;
+};
+
+/*!
+ * @brief Builds the list of launch parameters to try. A single kernel is
+ * tried for every work group size, and the columns of the matrix are split
+ * in blocks of several sizes for the two kernel version.
+ */
+template <bool Trans>
+std::vector<GemvParams> get_gemv_params(int m, int n, int max_local_size) {
+  std::vector<GemvParams> params;
+  const int n_cols = Trans ? m : n;
+  for (int ls = 32; ls <= max_local_size && ls <= 1024; ls *= 2) {
+    params.push_back({ls, ls, 0, 0});
+    for (int cols = 256; cols < n_cols && cols <= 8192; cols *= 2) {
+      if (Trans) {
+        // One or four rows per work group, the local memory holding the
+        // partial sums of one row per work item
+        params.push_back({ls, ls, 1, cols});
+        params.push_back({ls, 4 * ls, 4, cols});
+      } else {
+        params.push_back({ls, ls, ls, cols});
+        params.push_back({ls, 2 * ls, ls, cols});
+      }
+    }
+  }
+  return params;
+}
+
+template <bool Trans, typename T, typename Container, typename Executor>
+// a should not be a reference, the y buffer needs copied
+void tune(int r, GemvParams p, GemvArgs<T, Container, Executor> a) {
+  static constexpr auto trn =
+      Trans ? transpose_type::Transposed : transpose_type::Normal;
+  a.results.emplace_back(p.get_type_string());
+  TestResultEntry &result = a.results.back();
+  {
+    auto m_a_gpu = blas::make_sycl_iterator_buffer<T>(
+        const_cast<T *>(a.a.data()), a.a.size());
+    auto v_x_gpu = blas::make_sycl_iterator_buffer<T>(
+        const_cast<T *>(a.x.data()), a.x.size());
+    auto v_y_gpu = blas::make_sycl_iterator_buffer<T>(
+        const_cast<T *>(a.y.data()), a.y.size());
+    run_tune(r, 2.0 * a.m * a.n, result, [&] {
+      auto event = blas::internal::_gemv_impl<trn>(
+          a.ex, a.m, a.n, a.alpha, m_a_gpu, a.lda, v_x_gpu, 1, a.beta, v_y_gpu,
+          1, p.local_size, p.scratch_pad_size, p.n_rows_wg, p.n_cols_wg);
+      a.ex.get_policy_handler().wait(event);
+    });
+  }
+  result.error = relative_diff(a.refY, a.y);
+}
+
+template <typename T, typename Container, typename Executor>
+void tune_syclblas(int r, char trans, GemvArgs<T, Container, Executor> a) {
+  a.results.emplace_back("SYCL-BLAS gemv");
+  TestResultEntry &result = a.results.back();
+  {
+    auto m_a_gpu = blas::make_sycl_iterator_buffer<T>(
+        const_cast<T *>(a.a.data()), a.a.size());
+    auto v_x_gpu = blas::make_sycl_iterator_buffer<T>(
+        const_cast<T *>(a.x.data()), a.x.size());
+    auto v_y_gpu = blas::make_sycl_iterator_buffer<T>(
+        const_cast<T *>(a.y.data()), a.y.size());
+    run_tune(r, 2.0 * a.m * a.n, result, [&] {
+      auto event = _gemv(a.ex, trans, a.m, a.n, a.alpha, m_a_gpu, a.lda,
+                         v_x_gpu, 1, a.beta, v_y_gpu, 1);
+      a.ex.get_policy_handler().wait(event);
+    });
+  }
+  result.error = relative_diff(a.refY, a.y);
+}
+
+template <bool Trans, typename E>
+void run_tune_gemv(int seed, int m, int n, int rep) {
+  std::cout << std::scientific;
+
+  std::mt19937 rnd(seed);
+
+  const int xlen = Trans ? m : n;
+  const int ylen = Trans ? n : m;
+
+  auto dataA = gen_matrix<E>(m * n, -1, 1, rnd);
+  auto dataX = gen_matrix<E>(xlen, -1, 1, rnd);
+  auto origY = gen_matrix<E>(ylen, -1, 1, rnd);
+  auto refY = origY;
+
+  const char *t_str = Trans ? "T" : "N";
+  const int lda = m;
+
+  TestResult results{};
+
+  results.emplace_back("System GEMV implementation");
+  TestResultEntry &ref_result = results.back();
+  run_tune(rep, 2.0 * m * n, ref_result, [&] {
+    // system gemv implementation
+    reference_gemv::gemv(t_str, m, n, E(1), dataA.data(), lda, dataX.data(),
+                         1, E(1), refY.data(), 1);
+  });
+  ref_result.error = 0.0;
+
+  cl::sycl::queue q([=](cl::sycl::exception_list eL) {
+    try {
+      for (auto &e : eL) {
+        std::rethrow_exception(e);
+      }
+    } catch (cl::sycl::exception &e) {
+      std::cout << " E " << e.what() << std::endl;
+    } catch (...) {
+      std::cout << " An exception " << std::endl;
+    }
+  });
+  std::cout << "\nDevice: "
+            << q.get_device().get_info<cl::sycl::info::device::name>()
+            << std::endl;
+
+  Executor<PolicyHandler<codeplay_policy>> ex(q);
+
+  GemvArgs<E, decltype(dataA), decltype(ex)> args{
+      m, n, E(1), dataA, lda, dataX, E(1), origY, refY, ex, results};
+
+  tune_syclblas(rep, *t_str, args);
+
+  const int max_local_size = static_cast<int>(
+      q.get_device().get_info<cl::sycl::info::device::max_work_group_size>());
+  for (auto p : get_gemv_params<Trans>(m, n, max_local_size)) {
+    tune<Trans>(rep, p, args);
+  }
+
+  std::sort(results.begin(), results.end());
+  results.print_all();
+
+  // The best configuration, as a row of the table of the GEMV backends
+  for (auto it = results.rbegin(); it != results.rend(); ++it) {
+    if (it->name.compare(0, 10, "GemvParams") == 0) {
+      std::cout << "\n== Best configuration ==\n"
+                << "| trans | M | N | parameters | gflops |\n"
+                << "| " << (Trans ? "t" : "n") << " | " << m << " | " << n
+                << " | " << it->name << " | " << it->gflops << " |\n";
+      break;
+    }
+  }
+}
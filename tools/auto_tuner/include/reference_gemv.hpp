@@ -0,0 +1,41 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2018 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename reference_gemv.hpp
+ *
+ **************************************************************************/
+
+namespace reference_gemv {
+#define ENABLE_SYSTEM_GEMV(_type, _system_name)                              \
+  extern "C" void _system_name(const char *, const int *, const int *,       \
+                               const _type *, const _type *, const int *,    \
+                               const _type *, const int *, const _type *,    \
+                               _type *, const int *);                        \
+  void gemv(const char *trans, int m, int n, _type alpha, const _type a[],   \
+            int lda, const _type x[], int incx, _type beta, _type y[],       \
+            int incy) {                                                      \
+    _system_name(trans, &m, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy); \
+  }
+
+ENABLE_SYSTEM_GEMV(float, sgemv_)
+ENABLE_SYSTEM_GEMV(double, dgemv_)
+#undef ENABLE_SYSTEM_GEMV
+}  // namespace reference_gemv
@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2018 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename tuner_utils.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_TOOLS_TUNER_UTILS_HPP
+#define SYCL_BLAS_TOOLS_TUNER_UTILS_HPP
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+struct TestResultEntry {
+  std::string name;
+  double sec;
+  double gflops;
+  double error;
+
+  TestResultEntry(std::string name) : name(name) {}
+
+  void print() const {
+    std::cout << gflops << " gflops: " << name << " - Time: " << sec
+              << " ms, Error: " << error << "\n";
+  }
+
+  bool operator<(const TestResultEntry &other) const {
+    return gflops < other.gflops;
+  }
+  bool operator>(const TestResultEntry &other) const {
+    return gflops > other.gflops;
+  }
+};
+
+class TestResult : public std::vector<TestResultEntry> {
+ public:
+  void print_all() const {
+    std::cout << "== Performance Results ==\n";
+    for (auto &r : *this) {
+      r.print();
+    }
+  }
+};
+
+template <typename T, typename RndEngine>
+std::vector<T> gen_matrix(int size, T lo, T hi, RndEngine rnd) {
+  std::uniform_real_distribution<T> dst(lo, hi);
+  std::vector<T> v(size);
+  for (auto &e : v) {
+    e = dst(rnd);
+  }
+  return v;
+}
+
+template <typename T>
+T relative_diff(const std::vector<T> &ref, const std::vector<T> &obt) {
+  T mag(0);
+  for (auto x : ref) {
+    mag += x * x;
+  }
+  T diff = std::inner_product(std::begin(ref), std::end(ref), std::begin(obt),
+                              T(0), std::plus<T>(),
+                              [](T x, T y) { return (x - y) * (x - y); });
+  return std::sqrt(diff / mag);
+}
+
+template <typename TestOperator>
+void run_tune(int rep, double flop_cnt, TestResultEntry &result,
+              TestOperator op = TestOperator()) {
+  // warmup
+  op();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rep; ++i) {
+    op();
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double> sec_d = end - start;
+  double sec = sec_d.count() / rep;
+  result.sec = sec * 1e3;
+  result.gflops = flop_cnt / sec / 1e9;
+}
+
+#endif  // SYCL_BLAS_TOOLS_TUNER_UTILS_HPP